@@ -75,6 +75,10 @@ Full documentation can be found in:
   \-V, \-\-verbose:    Turn on initial welcome message.
   \-c, \-\-color:      Use colored highlighting of output.
   \-m, \-\-monochrome: Turn off coloured highlighting.
+  \-b, \-\-bytecode:   Keep compiled scripts in cache files alongside them.
+  \-\-profile\-startup: Report the time taken by each phase of startup.
+  \-\-latex\-cache <dir>: Cache typeset text items in the directory <dir>.
+  \-\-server <socket>: Run scripts received on a Unix domain socket.
 .SH AUTHORS
 %s.
 .SH BUGS AND USER FORUMS
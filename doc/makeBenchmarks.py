@@ -0,0 +1,48 @@
+# makeBenchmarks.py
+#
+# The code in this file is part of PyXPlot
+# <http://www.pyxplot.org.uk>
+#
+# Copyright (C) 2006-2012 Dominic Ford <coders@pyxplot.org.uk>
+#
+# $Id$
+#
+# PyXPlot is free software; you can redistribute it and/or modify it under the
+# terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 2 of the License, or (at your option) any later
+# version.
+#
+# You should have received a copy of the GNU General Public License along with
+# PyXPlot; if not, write to the Free Software Foundation, Inc., 51 Franklin
+# Street, Fifth Floor, Boston, MA  02110-1301, USA
+
+# ----------------------------------------------------------------------------
+
+# Time the benchmark scripts listed in examples.benchlist
+
+# Each line of examples.benchlist gives the name of a script in examples/, the
+# number of operations it is to time, which it reads from the variable ops, and
+# any further variable assignments it needs. The time taken is reported,
+# together with the rate of operations per second. Scripts may write scratch
+# files named examples/bench_*.tmp, which are deleted afterwards.
+
+import glob,os,sys,time
+
+if len(sys.argv)>=2: pyxplot = sys.argv[1]
+else               : pyxplot = "../bin/pyxplot"
+
+preamble = "examples/bench_preamble.tmp"
+
+for line in open("examples.benchlist"):
+  words = line.split()
+  if (len(words)<2) or words[0].startswith("#"): continue
+  name,ops = words[0],int(words[1])
+  open(preamble,"w").write("ops = %d\n"%ops + "".join(["%s\n"%i for i in words[2:]]))
+  t0     = time.time()
+  status = os.system("%s %s examples/%s.ppl"%(pyxplot,preamble,name))
+  t      = time.time() - t0
+  if (status): raise RuntimeError("pyxplot failed")
+  print("%-40s %8.3f s %14.0f per second"%(" ".join(words[0:1]+words[2:]),t,ops/t))
+
+# Remove the preamble, and any scratch files which the scripts have written
+for f in glob.glob("examples/bench_*.tmp"): os.unlink(f)
@@ -24,6 +24,7 @@
 #include <string.h>
 #include <unistd.h>
 #include <errno.h>
+#include <fcntl.h>
 #include <signal.h>
 #include <time.h>
 #include <sys/stat.h>
@@ -61,6 +62,17 @@ static int  *HelperPIDs;                    // A list of helper processes forked
 static int   GhostView_pid = 0;             // pid of any running gv process launched under X11_singlewindow
 static int   PyxplotRunning = 1;            // Flag which we drop in the CSP when the main process stops running
 
+// A resident latex process, started in advance of the next plot, which has already loaded a format file containing
+// our LaTeX preamble and is waiting for the name of a document to typeset on its stdin
+
+static int   LatexResidentPid      = 0;
+static int   LatexResidentStdIn    = -1;
+static int   LatexResidentStdOut   = -1;
+static long  LatexResidentCount    = 0;
+static char *LatexResidentPreamble = NULL;
+static char  LatexResidentJob[FNAME_LENGTH];
+static int   LatexResidentOff      = 0;
+
 // Functions to be called from main Pyxplot process
 
 void  pplcsp_init(ppl_context *context)
@@ -670,3 +682,175 @@ void pplcsp_forkKpseWhich(ppl_context *context, const char *ftype, int *fstdout)
   return;
  }
 
+// Dispose of the resident latex process, if there is one. The process is not in HelperPIDs, so that it survives
+// pplcsp_killAllHelpers() between commands, and so we reap it here.
+void pplcsp_killLaTeXResident(ppl_context *context)
+ {
+  if (LatexResidentPid<=0) return;
+  close(LatexResidentStdIn);
+  close(LatexResidentStdOut);
+  kill(LatexResidentPid, SIGTERM);
+  waitpid(LatexResidentPid, NULL, 0);
+  LatexResidentPid = 0;
+  if (LatexResidentPreamble!=NULL) { free(LatexResidentPreamble); LatexResidentPreamble=NULL; }
+  return;
+ }
+
+// Start a latex process which will typeset the next document to be produced with a given preamble. The first time
+// that each preamble is seen, it is compiled into a format file in our temporary directory, so that the resident
+// process does not have to load LaTeX's packages once it has been given a document. Nothing is started if this
+// preamble has previously failed to compile, in which case canvas_CallLaTeX() will fork latex afresh each time.
+void pplcsp_forkLaTeXResident(ppl_context *context, const char *preamble)
+ {
+  char           *tempdir = context->errcontext.session_default.tempdir;
+  char            fmt[FNAME_LENGTH], job[FNAME_LENGTH], fname[FNAME_LENGTH];
+  unsigned long   hash=5381;
+  int             fd0[2], fd1[2];
+  int             i, pid;
+  FILE           *f;
+  sigset_t        sigs;
+
+  pplcsp_killLaTeXResident(context);
+  if (LatexResidentOff) return;
+  for (i=0; preamble[i]!='\0'; i++) hash = ((hash << 5) + hash) + (unsigned char)preamble[i];
+  snprintf(fmt, FNAME_LENGTH, "pyxplot_fmt_%lx", hash);
+  snprintf(fname, FNAME_LENGTH, "%s%s%s.failed", tempdir, PATHLINK, fmt);
+  if (access(fname, F_OK)==0) return;
+  snprintf(fname, FNAME_LENGTH, "%s%s%s.fmt", tempdir, PATHLINK, fmt);
+  if (access(fname, F_OK)!=0)
+   {
+    snprintf(fname, FNAME_LENGTH, "%s%s%s.tex", tempdir, PATHLINK, fmt);
+    if ((f=fopen(fname, "w"))==NULL) return;
+    fprintf(f, "%s\n\\dump\n", preamble);
+    fclose(f);
+   }
+
+  LatexResidentCount++;
+  snprintf(job, FNAME_LENGTH, "pyxplot_%d_resident%ld", getpid(), LatexResidentCount);
+  if (pipe(fd0)<0) return;
+  if (pipe(fd1)<0) { close(fd0[0]); close(fd0[1]); return; }
+
+  sigemptyset(&sigs);
+  sigaddset(&sigs,SIGCHLD);
+  sigprocmask(SIG_BLOCK, &sigs, NULL);
+
+  if ((pid=fork()) < 0)
+   {
+    close(fd0[0]); close(fd0[1]); close(fd1[0]); close(fd1[1]);
+    sigprocmask(SIG_UNBLOCK, &sigs, NULL);
+    return;
+   }
+  else if (pid != 0)
+   {
+    // Parent process
+    close(fd0[0]); LatexResidentStdIn  = fd0[1];
+    close(fd1[1]); LatexResidentStdOut = fd1[0];
+    fcntl(LatexResidentStdIn , F_SETFD, FD_CLOEXEC); // Other helpers must not hold latex's stdin open, or it will never see EOF
+    fcntl(LatexResidentStdOut, F_SETFD, FD_CLOEXEC);
+    LatexResidentPid = pid;
+    snprintf(LatexResidentJob, FNAME_LENGTH, "%s%s%s", tempdir, PATHLINK, job);
+    LatexResidentPreamble = (char *)malloc(strlen(preamble)+1);
+    if (LatexResidentPreamble==NULL) pplcsp_killLaTeXResident(context);
+    else                             strcpy(LatexResidentPreamble, preamble);
+    sigprocmask(SIG_UNBLOCK, &sigs, NULL);
+    return;
+   }
+  else
+   {
+    // Child process
+    char fmtOpt[FNAME_LENGTH], jobOpt[FNAME_LENGTH];
+    int  status;
+    close(fd0[1]); close(fd1[0]);
+    close(PipeCSP2MAIN[0]);
+    close(PipeMAIN2CSP[1]);
+    signal(SIGCHLD, SIG_DFL); // We wait for latex -ini ourselves, below
+    sigprocmask(SIG_UNBLOCK, &sigs, NULL);
+    sprintf(context->errcontext.error_source, "TEX%6d", getpid());
+    context->errcontext.session_default.color = SW_ONOFF_OFF;
+    if (dup2(fd0[0], STDIN_FILENO ) != STDIN_FILENO ) exit(1);
+    if (dup2(fd1[1], STDOUT_FILENO) != STDOUT_FILENO) exit(1);
+    if (dup2(fd1[1], STDERR_FILENO) != STDERR_FILENO) exit(1);
+    close(fd0[0]); close(fd1[1]);
+    if (chdir(tempdir) < 0) exit(1);
+
+    // Compile the preamble into a format file, under a temporary name so that no other process sees it half-written
+    snprintf(fname, FNAME_LENGTH, "%s.fmt", fmt);
+    if (access(fname, F_OK)!=0)
+     {
+      char fmtTmp[FNAME_LENGTH], fmtTex[FNAME_LENGTH];
+      snprintf(fmtTmp, FNAME_LENGTH, "%s_%d", fmt, getpid());
+      snprintf(jobOpt, FNAME_LENGTH, "-jobname=%s", fmtTmp);
+      snprintf(fmtTex, FNAME_LENGTH, "%s.tex", fmt);
+      if      ((pid=fork()) < 0) exit(1);
+      else if ( pid        == 0)
+       {
+        int devnull = open("/dev/null", O_RDWR);
+        if (devnull>=0) { dup2(devnull, STDIN_FILENO); dup2(devnull, STDOUT_FILENO); dup2(devnull, STDERR_FILENO); }
+        execl(LATEX_COMMAND, LATEX_COMMAND, "-ini", "-interaction=batchmode", "-halt-on-error", jobOpt, "&latex", fmtTex, NULL);
+        exit(1);
+       }
+      strcat(fmtTmp, ".fmt");
+      if ((waitpid(pid, &status, 0)!=pid) || (!WIFEXITED(status)) || (WEXITSTATUS(status)!=0) || (rename(fmtTmp, fname)!=0))
+       {
+        snprintf(fname, FNAME_LENGTH, "%s.failed", fmt);
+        if ((f=fopen(fname, "w"))!=NULL) fclose(f);
+        exit(1);
+       }
+     }
+
+    // Load the format, and wait for a document
+    if (DEBUG) { sprintf(context->errcontext.tempErrStr, "New resident latex process alive; using format \"%s\".", fmt); ppl_log(&context->errcontext,NULL); }
+    snprintf(fmtOpt, FNAME_LENGTH, "-fmt=%s", fmt);
+    snprintf(jobOpt, FNAME_LENGTH, "-jobname=%s", job);
+    if (execl(LATEX_COMMAND, LATEX_COMMAND, "-file-line-error", fmtOpt, jobOpt, NULL)!=0) if (DEBUG) ppl_log(&context->errcontext,"Attempt to execute latex returned error code.");
+    exit(1);
+   }
+  return;
+ }
+
+// Hand over the resident latex process to the caller, if it is still alive and was started with the given preamble.
+// The caller should write the pathname of a document, without preamble, to *fstdin, and is responsible for closing
+// both pipes and reaping *PidOut. The document should be written to <jobOut>.tex, and latex will write <jobOut>.dvi.
+// Returns zero if there is no suitable resident process.
+int pplcsp_takeLaTeXResident(ppl_context *context, const char *preamble, char *jobOut, int *PidOut, int *fstdin, int *fstdout)
+ {
+  int w;
+  if (LatexResidentPid<=0) return 0;
+  w = waitpid(LatexResidentPid, NULL, WNOHANG);
+  if ((w>0) || ((w<0) && ((errno!=ECHILD) || (kill(LatexResidentPid, 0)!=0)))) // It has already exited, for example because the format failed to compile. A process inherited from server mode is not our child, so we can only check that it still exists.
+   {
+    close(LatexResidentStdIn);
+    close(LatexResidentStdOut);
+    LatexResidentPid = 0;
+    free(LatexResidentPreamble); LatexResidentPreamble=NULL;
+    return 0;
+   }
+  if (strcmp(LatexResidentPreamble, preamble)!=0) { pplcsp_killLaTeXResident(context); return 0; }
+  strcpy(jobOut, LatexResidentJob);
+  *PidOut  = LatexResidentPid;
+  *fstdin  = LatexResidentStdIn;
+  *fstdout = LatexResidentStdOut;
+  LatexResidentPid = 0;
+  free(LatexResidentPreamble); LatexResidentPreamble=NULL;
+  return 1;
+ }
+
+// Give up the resident latex process, without killing it, once a forked child has inherited it. Returns its pid, which
+// the caller must reap once the child has finished, or zero if there was none.
+int pplcsp_releaseLaTeXResident(ppl_context *context)
+ {
+  const int pid = LatexResidentPid;
+  if (pid<=0) return 0;
+  close(LatexResidentStdIn);
+  close(LatexResidentStdOut);
+  LatexResidentPid = 0;
+  free(LatexResidentPreamble); LatexResidentPreamble=NULL;
+  return pid;
+ }
+
+// Stop this process from starting resident latex processes. Used by the children which run scripts in server mode,
+// which may use the resident process inherited from the server, but exit before another would be of any use.
+void pplcsp_disableLaTeXResident(ppl_context *context)
+ {
+  LatexResidentOff = 1;
+ }
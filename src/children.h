@@ -48,6 +48,11 @@ void  pplcsp_forkSed               (ppl_context *context, char *cmd, int *fstdin
 void  pplcsp_forkLaTeX             (ppl_context *context, char *filename, int *PidOut, int *fstdin, int *fstdout);
 void  pplcsp_forkInputFilter       (ppl_context *context, char **cmd, int *fstdout);
 void  pplcsp_forkKpseWhich         (ppl_context *context, const char *ftype, int *fstdout);
+void  pplcsp_killLaTeXResident     (ppl_context *context);
+void  pplcsp_forkLaTeXResident     (ppl_context *context, const char *preamble);
+int   pplcsp_takeLaTeXResident     (ppl_context *context, const char *preamble, char *jobOut, int *PidOut, int *fstdin, int *fstdout);
+int   pplcsp_releaseLaTeXResident  (ppl_context *context);
+void  pplcsp_disableLaTeXResident  (ppl_context *context);
 
 #endif
 
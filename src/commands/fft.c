@@ -443,6 +443,7 @@ void ppl_directive_fft(ppl_context *c, parserLine *pl, parserOutput *in, int int
   funcPtr->realOnly        = 0;
   funcPtr->dimlessOnly     = 0;
   funcPtr->needSelfThis    = 0;
+  funcPtr->stateful        = 0;
   funcPtr->functionPtr     = (void *)output;
   funcPtr->argList         = NULL;
   funcPtr->min             = funcPtr->max       = NULL;
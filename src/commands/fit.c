@@ -35,8 +35,10 @@
 #include <gsl/gsl_vector.h>
 
 #include "commands/fit.h"
+#include "coreUtils/dict.h"
 #include "coreUtils/errorReport.h"
 #include "coreUtils/memAlloc.h"
+#include "coreUtils/workerPool.h"
 #include "expressions/expCompile_fns.h"
 #include "expressions/expEval.h"
 #include "expressions/fnCall.h"
@@ -57,6 +59,16 @@
 
 #include "datafile.h"
 
+// Residuals are summed over chunks of this many data points, and then the chunk sums are added together pairwise, so
+// that the result is the same however many threads the chunks are shared between
+#define FIT_CHUNK 256
+#define FIT_NCHUNKS(p) (((p)->NDataPoints + FIT_CHUNK - 1) / FIT_CHUNK)
+
+// Maximum depth of nested user-defined function calls which fitFunctionIsPure() will follow
+#define FIT_PURE_MAXDEPTH 8
+
+struct fitWorker;
+
 // Structure used for passing data around
 typedef struct fitComm {
  ppl_context      *c;
@@ -79,8 +91,19 @@ typedef struct fitComm {
  double            sigmaData; // The assumed errorbar (uniform for all datapoints) on the supplied target values if errorbars are not supplied. We fit this.
  int               diff1    , diff2; // The numbers of the free parameters currently being differentiated inside GetHessian()
  double            diff1step, diff2step; // The step size which GetHessian() recommends using for each of the parameters being differentiated
+ double           *chunkSums; // Sums of the residuals of each chunk of FIT_CHUNK data points
+ struct fitWorker *workers; // Private evaluation contexts for each thread, if residuals are being evaluated in parallel
+ int               Nworkers;
 } fitComm;
 
+// Private state for one thread evaluating residuals concurrently with others
+typedef struct fitWorker {
+ ppl_context  c; // Copy of the interpreter's context, with its own stack and a private innermost namespace
+ fitComm      p; // Copy of the fitComm structure, pointing to this worker's context and copies of the fitting variables
+ pplObj      *varObj[USING_ITEMS_MAX];
+ char         errtext[LSTR_LENGTH];
+} fitWorker;
+
 #define STACK_POP \
    { \
     c->stackPtr--; \
@@ -109,15 +132,28 @@ static char *matrixPrint(ppl_context *c, const gsl_matrix *m, const size_t size,
   return out;
  }
 
-// Low-level routine for working out the mismatch between function and data for a given set of free parameter values
-static double fitResidual(fitComm *p)
+// Set the variables in the user's variable space which we are fitting to a set of free parameter values
+static void fitSetParams(fitComm *p, const gsl_vector *x)
+ {
+  int i;
+  for (i=0; i<p->NFitVars; i++)
+   if (p->c->set->term_current.ComplexNumbers == SW_ONOFF_OFF)   p->varObj[i]->real = gsl_vector_get(x,   i  );
+   else                                                        { p->varObj[i]->real = gsl_vector_get(x, 2*i  );
+                                                                 p->varObj[i]->imag = gsl_vector_get(x, 2*i+1);
+                                                               }
+ }
+
+// Evaluate the function being fitted at the j-th data point, returning the real part of its value and setting *imag to
+// its imaginary part. On error, returns NAN and puts an error message in p->errtext. Caller must check stack space.
+// This is not done with ppl_expBatchRun(), as the function is called through ppl_fnCall() and is normally
+// user-defined, and its free parameters may be complex; neither can be expressed as a batch program.
+static double fitCallFunction(fitComm *p, long int j, double *imag)
  {
   ppl_context *c = p->c;
   char        *errText = p->errtext;
   const int    stkLevelOld = c->stackPtr;
-  int          i, k;
-  long int     j;
-  double       accumulator, residual;
+  int          k;
+  double       real;
   pplObj      *out;
   pplExpr      dummy;
 
@@ -127,52 +163,222 @@ static double fitResidual(fitComm *p)
   dummy.srcFname = "<dummy>";
   dummy.ascii    = NULL;
 
-  // Set free parameter values
-  for (i=0; i<p->NFitVars; i++)
-   if (c->set->term_current.ComplexNumbers == SW_ONOFF_OFF)   p->varObj[i]->real = gsl_vector_get(p->paramVals,   i  ); // This is setting variables in the user's variable space
-   else                                                     { p->varObj[i]->real = gsl_vector_get(p->paramVals, 2*i  );
-                                                              p->varObj[i]->imag = gsl_vector_get(p->paramVals, 2*i+1);
-                                                            }
+  // Push function object
+  pplObjCpy(&c->stack[c->stackPtr], p->functionObj, 1, 0, 1);
+  c->stack[c->stackPtr].refCount=1;
+  c->stackPtr++;
+
+  // Push each argument in turn
+  for (k=0; k<p->NArgs; k++)
+   {
+    pplObjNum(&c->stack[c->stackPtr], 0 , p->dataTable[j*p->NExpect+k], 0);
+    ppl_unitsDimCpy(&c->stack[c->stackPtr], &p->firstVals[k]);
+    c->stack[c->stackPtr].refCount = 1;
+    c->stackPtr++;
+   }
 
-  accumulator = 0.0; // Add up sum of square residuals
+  // Call function
+  c->errStat.errMsgExpr[0]='\0';
+  ppl_fnCall(c, &dummy, 0, 1, 1, 1);
+  out = &c->stack[c->stackPtr-1];
+
+  if (c->errStat.status) { strcpy(errText, c->errStat.errMsgExpr); ppl_tbClear(c); STACK_CLEAN; return GSL_NAN; }
+  if (out->objType!=PPLOBJ_NUM) { sprintf(errText, "The supplied function to fit produces a value which is not a number but has type <%s>.", pplObjTypeNames[out->objType]); STACK_CLEAN; return GSL_NAN; }
+  if (!ppl_unitsDimEqual(out, p->firstVals+p->NArgs)) { sprintf(errText, "The supplied function to fit produces a value which is dimensionally incompatible with its target value. The function produces a result with dimensions of <%s>, while its target value has dimensions of <%s>.", ppl_printUnit(c,out,NULL,NULL,0,1,0), ppl_printUnit(c,p->firstVals+p->NArgs,NULL,NULL,1,1,0)); STACK_CLEAN; return GSL_NAN; }
+  real  = out->real;
+  *imag = out->imag;
+  STACK_CLEAN;
+  return real;
+ }
+
+// The standard error on the target value of the j-th data point
+#define FIT_SIGMA(p,j) ((p)->flagYErrorBars ? (p)->dataTable[(j)*(p)->NExpect+(p)->NArgs+1] : (p)->sigmaData)
+
+// Work out the mismatch between function and data for chunks chunkMin <= k < chunkMax of the data, putting the sum for
+// each chunk into p->chunkSums. After an error, the sums for this and all subsequent chunks are set to NAN.
+static void fitResidualChunks(fitComm *p, long int chunkMin, long int chunkMax)
+ {
+  ppl_context *c = p->c;
+  long int     j, jMax, k;
+  double       accumulator, residual, real, imag;
 
   // Check there's enough space on the stack
   STACK_MUSTHAVE(c,p->NArgs);
-  if (c->stackFull) { strcpy(errText, "stack overflow in the fit command."); return GSL_NAN; }
+  if (c->stackFull) { strcpy(p->errtext, "stack overflow in the fit command."); chunkMax=chunkMin; }
 
-  for (j=0; j<p->NDataPoints; j++) // Loop over all of the data points in the file that we're fitting
+  for (k=chunkMin; k<chunkMax; k++)
    {
-    // Push function object
-    pplObjCpy(&c->stack[c->stackPtr], p->functionObj, 1, 0, 1);
-    c->stack[c->stackPtr].refCount=1;
-    c->stackPtr++;
-
-    // Push each argument in turn
-    for (k=0; k<p->NArgs; k++)
+    accumulator = 0.0; // Add up sum of square residuals
+    jMax = GSL_MIN((k+1)*FIT_CHUNK, p->NDataPoints);
+    for (j=k*FIT_CHUNK; j<jMax; j++) // Loop over all of the data points in this chunk
      {
-      pplObjNum(&c->stack[c->stackPtr], 0 , p->dataTable[j*p->NExpect+k], 0);
-      ppl_unitsDimCpy(&c->stack[c->stackPtr], &p->firstVals[k]);
-      c->stack[c->stackPtr].refCount = 1;
-      c->stackPtr++;
+      real = fitCallFunction(p, j, &imag);
+      if (gsl_isnan(real)) { accumulator=GSL_NAN; break; }
+      residual = pow(real - p->dataTable[j*p->NExpect+p->NArgs] , 2) + pow(imag , 2); // Calculate squared deviation of function result from desired result
+      residual /= 2 * pow(FIT_SIGMA(p,j), 2); // Divide square residual by 2 sigma squared.
+      accumulator += residual; // ... and sum
      }
+    p->chunkSums[k] = accumulator;
+    if (gsl_isnan(accumulator)) break;
+   }
+  for (k++; k<chunkMax; k++) p->chunkSums[k] = GSL_NAN;
+ }
+
+// Thread entry point: each worker w sums the residuals of its own contiguous range of chunks
+static void fitResidualWorkers(void *arg, int wMin, int wMax)
+ {
+  fitComm *p = (fitComm *)arg;
+  long int Nchunks = FIT_NCHUNKS(p);
+  int      w;
+  for (w=wMin; w<wMax; w++)
+   {
+    fitWorker *fw = &p->workers[w];
+    fw->errtext[0] = '\0';
+    fw->p.sigmaData = p->sigmaData;
+    fitSetParams(&fw->p, p->paramVals);
+    fitResidualChunks(&fw->p, Nchunks*w/p->Nworkers, Nchunks*(w+1)/p->Nworkers);
+   }
+ }
+
+static double fitPairwiseSum(const double *x, long int n)
+ {
+  if (n<=2) return (n==2) ? (x[0]+x[1]) : ((n==1) ? x[0] : 0.0);
+  return fitPairwiseSum(x, n/2) + fitPairwiseSum(x+n/2, n-n/2);
+ }
+
+// Low-level routine for working out the mismatch between function and data for a given set of free parameter values
+static double fitResidual(fitComm *p)
+ {
+  int w;
+
+  fitSetParams(p, p->paramVals); // This is setting variables in the user's variable space
+
+  if (p->Nworkers<2)
+   {
+    fitResidualChunks(p, 0, FIT_NCHUNKS(p));
+   }
+  else
+   {
+    ppl_workerRunRows(p->Nworkers, p->Nworkers, fitResidualWorkers, (void *)p);
+    for (w=0; w<p->Nworkers; w++) if (p->workers[w].errtext[0]!='\0') { strcpy(p->errtext, p->workers[w].errtext); break; } // Report the error in the earliest chunk
+   }
+
+  return fitPairwiseSum(p->chunkSums, FIT_NCHUNKS(p));
+ }
 
-    // Call function
-    c->errStat.errMsgExpr[0]='\0';
-    ppl_fnCall(c, &dummy, 0, 1, 1, 1);
-    out = &c->stack[c->stackPtr-1];
+// Decide whether a function can be evaluated by several threads at once, each with a private namespace holding the
+// function's arguments and the fitting variables. It may use only numeric literals, arithmetic, branching, lookups of
+// numbers, and calls to numeric system functions or to user-defined functions which are themselves pure. It may not
+// make assignments, read the members of objects, or call functions with state such as splines, subroutines or the
+// functions of the random module, which share a single random number generator.
+static int fitFunctionIsPure(ppl_context *c, pplFunc *fn, int depth)
+ {
+  pplFunc *f;
+  if ((fn==NULL) || (depth>FIT_PURE_MAXDEPTH)) return 0;
+  if (fn->functionType==PPL_FUNC_SYSTEM) return fn->numOnly && (fn->maxArgs>0) && (!fn->needSelfThis) && (!fn->stateful);
+  if (fn->functionType!=PPL_FUNC_USERDEF) return 0;
+
+  for (f=fn; f!=NULL; f=f->next) // Check each spliced definition of the function
+   {
+    pplExpr         *e = (pplExpr *)f->functionPtr;
+    pplExprBytecode *in;
+    int              j, k, isArg;
+    char            *name, *a;
+    pplObj          *obj;
+
+    if (e==NULL) continue; // Function is undefined in this region, and evaluates to NAN
+    in = (pplExprBytecode *)e->bytecode;
+    for (j=0; in[j].opcode!=0; j+=in[j].len)
+     {
+      const int o = in[j].opcode;
+      if ((o==1)||(o==10)||(o==11)||(o==17)||(o==18)||(o==19)||(o==20)) continue; // Literals, calls, operators, branches
+      if (o!=3) return 0;
+
+      // Variable lookup: arguments are held in the private namespace; anything else must be a number or a pure function
+      name = (char *)&in[j+1];
+      for (a=fn->argList, k=0, isArg=0; (k<fn->maxArgs)&&(!isArg); a+=strlen(a)+1, k++) isArg = (strcmp(a,name)==0);
+      if (isArg) continue;
+      ppl_contextVarLookup(c, name, &obj, 0);
+      if (obj==NULL) return 0;
+      if ((obj->objType==PPLOBJ_NUM)||(obj->objType==PPLOBJ_BOOL)) continue;
+      if ((obj->objType!=PPLOBJ_FUNC) || (!fitFunctionIsPure(c, (pplFunc *)obj->auxil, depth+1))) return 0;
+     }
+   }
+  return 1;
+ }
 
-    if (c->errStat.status) { strcpy(errText, c->errStat.errMsgExpr); ppl_tbClear(c); STACK_CLEAN; return GSL_NAN; }
-    if (out->objType!=PPLOBJ_NUM) { sprintf(errText, "The supplied function to fit produces a value which is not a number but has type <%s>.", pplObjTypeNames[out->objType]); STACK_CLEAN; return GSL_NAN; }
-    if (!ppl_unitsDimEqual(out, p->firstVals+p->NArgs)) { sprintf(errText, "The supplied function to fit produces a value which is dimensionally incompatible with its target value. The function produces a result with dimensions of <%s>, while its target value has dimensions of <%s>.", ppl_printUnit(c,out,NULL,NULL,0,1,0), ppl_printUnit(c,p->firstVals+p->NArgs,NULL,NULL,1,1,0)); STACK_CLEAN; return GSL_NAN; }
-    residual = pow(out->real - p->dataTable[j*p->NExpect+k] , 2) + pow(out->imag , 2); // Calculate squared deviation of function result from desired result
-    if (p->flagYErrorBars) residual /= 2 * pow(p->dataTable[j*p->NExpect+k+1]    , 2); // Divide square residual by 2 sigma squared.
-    else                   residual /= 2 * pow(p->sigmaData                      , 2);
-    accumulator += residual; // ... and sum
+static void fitWorkersFree(fitComm *p);
 
-    STACK_CLEAN;
+// Set up private contexts in which worker threads can evaluate residuals concurrently. These share all namespaces with
+// the interpreter except the innermost, which holds copies of the fitting variables, so that each thread can vary them
+// independently. This is only done if the function being fitted is pure and the fit command was issued from the global
+// namespace. Otherwise, or if memory is short, p->Nworkers is left as one and residuals are evaluated serially.
+static void fitWorkersInit(fitComm *p, char **fitVars)
+ {
+  ppl_context *c = p->c;
+  long int     Nchunks = FIT_NCHUNKS(p);
+  int          Nworkers = ppl_workerCount(c->set->term_current.threads);
+  int          i, w;
+
+  p->workers  = NULL;
+  p->Nworkers = 1;
+  if (Nworkers>Nchunks) Nworkers = (int)Nchunks;
+  if ((Nworkers<2) || (c->ns_ptr!=1) || (!fitFunctionIsPure(c, (pplFunc *)p->functionObj->auxil, 0))) return;
+  p->workers = (fitWorker *)malloc(Nworkers * sizeof(fitWorker));
+  if (p->workers==NULL) return;
+
+  for (w=0; w<Nworkers; w++)
+   {
+    fitWorker *fw = &p->workers[w];
+    dict      *d  = ppl_dictInit(1);
+    memcpy(&fw->c, c, sizeof(ppl_context));
+    fw->c.namespaces[++fw->c.ns_ptr] = d;
+    fw->c.errStat.tracebackDepth = 0; // Traceback strings belong to the interpreter's context
+    ppl_tbClear(&fw->c);
+    fw->c.tokenBuff      = NULL; fw->c.tokenBuffLen   = 0;
+    fw->c.parserStack    = NULL; fw->c.parserStackLen = 0;
+    fw->c.stackSize      = STACK_DEFAULT;
+    fw->c.stack          = (pplObj *)malloc(STACK_DEFAULT * sizeof(pplObj));
+    fw->c.stackPtr       = 0;
+    fw->c.stackFull      = 0;
+    fw->c.inlineCacheOff = 1;
+    fw->c.macroCacheOff  = 1;
+    p->Nworkers = w+1; // From here on, this worker needs freeing if we fail
+    if ((d==NULL) || (fw->c.stack==NULL)) { fitWorkersFree(p); return; }
+    for (i=0; i<p->NFitVars; i++)
+     {
+      pplObj v;
+      v.refCount = 1;
+      pplObjCpy(&v, p->varObj[i], 0, 1, 1);
+      ppl_dictAppendCpy(d, fitVars[i], &v, sizeof(pplObj));
+      fw->varObj[i] = (pplObj *)ppl_dictLookup(d, fitVars[i]);
+      if (fw->varObj[i]==NULL) { fitWorkersFree(p); return; }
+     }
+    memcpy(&fw->p, p, sizeof(fitComm));
+    fw->p.c        = &fw->c;
+    fw->p.varObj   = fw->varObj;
+    fw->p.errtext  = fw->errtext;
+    fw->p.workers  = NULL;
+    fw->p.Nworkers = 1;
    }
+  p->Nworkers = Nworkers;
+ }
 
-  return accumulator;
+static void fitWorkersFree(fitComm *p)
+ {
+  int w;
+  if (p->workers==NULL) return;
+  for (w=0; w<p->Nworkers; w++)
+   {
+    fitWorker *fw = &p->workers[w];
+    if (fw->c.stack!=NULL) while (fw->c.stackPtr>0) { fw->c.stackPtr--; ppl_garbageObject(&fw->c.stack[fw->c.stackPtr]); }
+    ppl_tbClear(&fw->c);
+    ppl_garbageNamespace(fw->c.namespaces[fw->c.ns_ptr]);
+    free(fw->c.stack);
+   }
+  free(p->workers);
+  p->workers  = NULL;
+  p->Nworkers = 1;
  }
 
 // Slave routines called by the differentiation operation when working out the Hessian matrix
@@ -351,6 +557,138 @@ static int FitMinimiseIterate(fitComm *commlink, double(*slave)(const gsl_vector
   return 0;
  }
 
+// Routines for the Levenberg-Marquardt minimiser, which is used by <fit ... via ... method lm>
+
+#define FIT_LM_STEP    1e-7  // Fractional change in each parameter used to differentiate residuals
+#define FIT_LM_TOL     1e-12 // Fractional change in chi-squared at which we consider the fit to have converged
+#define FIT_LM_MAXITER 1000
+
+static void fitSetParam(fitComm *p, int k, double v)
+ {
+  if      (p->c->set->term_current.ComplexNumbers == SW_ONOFF_OFF) p->varObj[k  ]->real = v;
+  else if ((k%2)==0)                                               p->varObj[k/2]->real = v;
+  else                                                             p->varObj[k/2]->imag = v;
+ }
+
+// Return the sum of the squares of the weighted residuals (f-y)/sigma for a set of free parameter values. If JTJ and
+// JTr are not NULL, also accumulate into them the products of the Jacobian of the residuals with itself and with the
+// residuals. The Jacobian is found by forward differences, evaluated in the same pass over the data as the residuals.
+static double fitLMSweep(fitComm *p, const gsl_vector *x, const double *step, gsl_matrix *JTJ, gsl_vector *JTr)
+ {
+  ppl_context *c = p->c;
+  const int    Np = p->NParams;
+  long int     j;
+  int          k, l, m;
+  double       chi2=0.0, sigma, f0[2], fk[2], r[2], J[2][2*USING_ITEMS_MAX];
+
+  // Without the Jacobian, this is just twice the residual evaluated by fitResidual(), which may run in parallel
+  if (JTJ==NULL) { p->paramVals = x; return 2.0 * fitResidual(p); }
+
+  fitSetParams(p, x);
+  gsl_matrix_set_zero(JTJ);
+  gsl_vector_set_zero(JTr);
+
+  // Check there's enough space on the stack
+  STACK_MUSTHAVE(c,p->NArgs);
+  if (c->stackFull) { strcpy(p->errtext, "stack overflow in the fit command."); return GSL_NAN; }
+
+  for (j=0; j<p->NDataPoints; j++)
+   {
+    sigma = FIT_SIGMA(p,j);
+    f0[0] = fitCallFunction(p, j, &f0[1]);
+    if (gsl_isnan(f0[0])) return GSL_NAN;
+    r[0]  = (f0[0] - p->dataTable[j*p->NExpect+p->NArgs]) / sigma;
+    r[1]  =  f0[1] / sigma;
+    chi2 += r[0]*r[0] + r[1]*r[1];
+
+    for (k=0; k<Np; k++)
+     {
+      fitSetParam(p, k, gsl_vector_get(x,k) + step[k]);
+      fk[0] = fitCallFunction(p, j, &fk[1]);
+      fitSetParam(p, k, gsl_vector_get(x,k));
+      if (gsl_isnan(fk[0])) return GSL_NAN;
+      J[0][k] = (fk[0] - f0[0]) / step[k] / sigma;
+      J[1][k] = (fk[1] - f0[1]) / step[k] / sigma;
+     }
+    for (m=0; m<2; m++) for (k=0; k<Np; k++)
+     {
+      if (J[m][k]==0.0) continue; // The imaginary parts are all zero unless complex arithmetic is enabled
+      for (l=0; l<=k; l++) *gsl_matrix_ptr(JTJ,k,l) += J[m][k] * J[m][l];
+      *gsl_vector_ptr(JTr,k) += J[m][k] * r[m];
+     }
+   }
+  for (k=0; k<Np; k++) for (l=0; l<k; l++) gsl_matrix_set(JTJ, l, k, gsl_matrix_get(JTJ, k, l));
+  return chi2;
+ }
+
+// Minimise the sum of the squares of the weighted residuals using the Levenberg-Marquardt algorithm. On success, returns
+// zero with the fitting variables set to their best-fit values, *chi2Out set to the minimum sum of squared residuals,
+// and *JTJout set to J^T J at the best fit, from which the covariance matrix follows without further differentiation.
+// Returns one if the minimiser fails, in which case the fitting variables are restored to their initial values.
+static int FitLevenbergMarquardt(fitComm *p, gsl_matrix **JTJout, double *chi2Out)
+ {
+  const int   Np = p->NParams;
+  int         i, iter, accepted, converged=0;
+  double      step[2*USING_ITEMS_MAX], chi2=0, chi2Trial=0, lambda=1e-3, d;
+  gsl_vector *x0, *x, *xTrial, *delta, *JTr;
+  gsl_matrix *JTJ, *A;
+
+  x0     = gsl_vector_alloc(Np);
+  x      = gsl_vector_alloc(Np);
+  xTrial = gsl_vector_alloc(Np);
+  delta  = gsl_vector_alloc(Np);
+  JTr    = gsl_vector_alloc(Np);
+  JTJ    = gsl_matrix_alloc(Np, Np);
+  A      = gsl_matrix_alloc(Np, Np);
+
+  if (p->c->set->term_current.ComplexNumbers == SW_ONOFF_OFF) for(i=0;i<p->NFitVars;i++) gsl_vector_set(x0,  i,p->varObj[i]->real);
+  else                                                        for(i=0;i<p->NFitVars;i++){gsl_vector_set(x0,2*i,p->varObj[i]->real); gsl_vector_set(x0,2*i+1,p->varObj[i]->imag); }
+  gsl_vector_memcpy(x, x0);
+
+  for (iter=0; (iter<FIT_LM_MAXITER) && (!converged); iter++)
+   {
+    // Evaluate residuals and Jacobian at the current position
+    for (i=0; i<Np; i++) { d=fabs(gsl_vector_get(x,i)); step[i] = (d>1e-100) ? (d*FIT_LM_STEP) : FIT_LM_STEP; }
+    chi2 = fitLMSweep(p, x, step, JTJ, JTr);
+    if (!gsl_finite(chi2)) break;
+
+    // Solve (J^T J + lambda diag(J^T J)) delta = -J^T r, increasing lambda until chi-squared goes down
+    for (accepted=0; (!accepted) && (lambda<1e16); )
+     {
+      gsl_matrix_memcpy(A, JTJ);
+      for (i=0; i<Np; i++) { d=gsl_matrix_get(JTJ,i,i); *gsl_matrix_ptr(A,i,i) += lambda * ((d>0.0)?d:1.0); }
+      gsl_vector_memcpy(delta, JTr);
+      gsl_vector_scale(delta, -1.0);
+      if ((gsl_linalg_cholesky_decomp(A)!=0) || (gsl_linalg_cholesky_svx(A, delta)!=0)) { lambda*=10; continue; }
+      gsl_vector_memcpy(xTrial, x);
+      gsl_vector_add(xTrial, delta);
+      chi2Trial = fitLMSweep(p, xTrial, step, NULL, NULL);
+      if (gsl_finite(chi2Trial) && (chi2Trial<=chi2)) accepted=1;
+      else                                             lambda*=10;
+     }
+
+    // If no step downhill can be found, we are already at the minimum
+    if (!accepted) { converged=1; break; }
+    converged = ((chi2-chi2Trial) <= FIT_LM_TOL*chi2);
+    gsl_vector_memcpy(x, xTrial);
+    lambda = GSL_MAX(lambda/10, 1e-12);
+   }
+
+  // Evaluate J^T J at the best-fit position
+  if (converged)
+   {
+    for (i=0; i<Np; i++) { d=fabs(gsl_vector_get(x,i)); step[i] = (d>1e-100) ? (d*FIT_LM_STEP) : FIT_LM_STEP; }
+    chi2 = fitLMSweep(p, x, step, JTJ, JTr);
+    converged = gsl_finite(chi2);
+   }
+
+  if (converged) { *JTJout = JTJ; *chi2Out = chi2; }
+  else           { gsl_matrix_free(JTJ); fitSetParams(p, x0); }
+  gsl_vector_free(x0); gsl_vector_free(x); gsl_vector_free(xTrial); gsl_vector_free(delta); gsl_vector_free(JTr);
+  gsl_matrix_free(A);
+  return !converged;
+ }
+
 // Main entry point for the implementation of the fit command
 void ppl_directive_fit(ppl_context *c, parserLine *pl, parserOutput *in, int interactive, int iterDepth)
  {
@@ -369,14 +707,18 @@ void ppl_directive_fit(ppl_context *c, parserLine *pl, parserOutput *in, int int
   parserLine *spool=NULL, **dataSpool = &spool;
   double     *localDataTable, val;
   gsl_vector *bestFitParamVals;
-  gsl_matrix *hessian, *hessian_lu, *hessian_inv;
+  gsl_matrix *hessian, *hessian_lu, *hessian_inv, *JTJ=NULL;
   int         sgn;
+  double      chi2=0;
   double      stdDev[2*USING_ITEMS_MAX], tmp1, tmp2, tmp3;
   fitComm     dataComm; // Structure which we fill with variables we need to pass to the minimiser
   pplFunc    *funcDef;
   pplObj     *funcObj;
   gsl_permutation *perm;
 
+  dataComm.workers  = NULL;
+  dataComm.Nworkers = 1;
+
   // Get list of fitting variables
   {
    int pos = PARSE_fit_fit_variables;
@@ -580,12 +922,25 @@ void ppl_directive_fit(ppl_context *c, parserLine *pl, parserOutput *in, int int
   dataComm.flagYErrorBars = (NExpect == Nargs+2);
   dataComm.sigmaData    = 1.0;
   dataComm.errtext      = (char *)ppl_memAlloc_incontext(LSTR_LENGTH, contextLocalVec);
+  dataComm.chunkSums    = (double *)ppl_memAlloc_incontext(GSL_MAX(FIT_NCHUNKS(&dataComm),1) * sizeof(double), contextLocalVec);
   scratchPad            = (char *)ppl_memAlloc_incontext(LSTR_LENGTH, contextLocalVec);
-  if ((scratchPad==NULL)||(dataComm.errtext==NULL)) { sprintf(c->errStat.errBuff, "Out of memory."); TBADD2(ERR_MEMORY,0); goto cleanup; }
+  if ((scratchPad==NULL)||(dataComm.errtext==NULL)||(dataComm.chunkSums==NULL)) { sprintf(c->errStat.errBuff, "Out of memory."); TBADD2(ERR_MEMORY,0); goto cleanup; }
   dataComm.errtext[0]   = '\0';
 
-  // Set up a minimiser
-  status = FitMinimiseIterate(&dataComm, &ResidualMinimiserSlave, 0);
+  // If the function being fitted is pure, evaluate residuals for chunks of data in parallel
+  fitWorkersInit(&dataComm, fitVars);
+
+  // Set up a minimiser. The Levenberg-Marquardt minimiser falls back to the simplex minimiser if it fails to converge.
+  if ((stk[PARSE_fit_method].objType==PPLOBJ_STR) && (strcmp((char *)stk[PARSE_fit_method].auxil,"lm")==0))
+   {
+    status = FitLevenbergMarquardt(&dataComm, &JTJ, &chi2);
+    if (status)
+     {
+      dataComm.errtext[0] = '\0';
+      ppl_report(&c->errcontext,"\n# The Levenberg-Marquardt minimiser failed to converge; using the simplex minimiser instead.");
+     }
+   }
+  if (JTJ==NULL) status = FitMinimiseIterate(&dataComm, &ResidualMinimiserSlave, 0);
   if (status) { sprintf(c->errStat.errBuff, "%s", dataComm.errtext); TBADD2(ERR_NUMERICAL,0); goto cleanup; }
 
   // Display the results of the minimiser
@@ -600,6 +955,7 @@ void ppl_directive_fit(ppl_context *c, parserLine *pl, parserOutput *in, int int
   // If 'withouterrors' is specified, stop now
   if (stk[PARSE_fit_withouterrors].objType==PPLOBJ_STR)
    {
+    if (JTJ!=NULL) gsl_matrix_free(JTJ);
     ppl_memAlloc_AscendOutOfContext(contextLocalVec);
     goto cleanup;
    }
@@ -616,10 +972,18 @@ void ppl_directive_fit(ppl_context *c, parserLine *pl, parserOutput *in, int int
   // Estimate the size of the errorbars on the supplied data if no errorbars were supplied (this doesn't affect best fit position, but does affect error estimates)
   if (!dataComm.flagYErrorBars)
    {
-    sprintf(c->errcontext.tempErrStr, "\n# Estimating the size of the error bars on supplied data.\n# This may take a while.\n# The fit command can be made to run very substantially faster if the 'withouterrors' option is set.");
-    ppl_report(&c->errcontext,NULL);
-    status = FitMinimiseIterate(&dataComm, &FitsigmaData, 1);
-    if (status) { sprintf(c->errStat.errBuff, "%s", dataComm.errtext); TBADD2(ERR_NUMERICAL,0); gsl_vector_free(bestFitParamVals); goto cleanup; }
+    if ((JTJ!=NULL) && (NDataPoints > dataComm.NParams))
+     {
+      // When the Hessian is approximated by J^T J / sigma^2, the evidence is maximised by the residual standard deviation
+      dataComm.sigmaData = sqrt(chi2 / (NDataPoints - dataComm.NParams));
+     }
+    else
+     {
+      sprintf(c->errcontext.tempErrStr, "\n# Estimating the size of the error bars on supplied data.\n# This may take a while.\n# The fit command can be made to run very substantially faster if the 'withouterrors' option is set.");
+      ppl_report(&c->errcontext,NULL);
+      status = FitMinimiseIterate(&dataComm, &FitsigmaData, 1);
+      if (status) { sprintf(c->errStat.errBuff, "%s", dataComm.errtext); TBADD2(ERR_NUMERICAL,0); gsl_vector_free(bestFitParamVals); if (JTJ!=NULL) gsl_matrix_free(JTJ); goto cleanup; }
+     }
     firstVals[Nargs].real = dataComm.sigmaData;
     firstVals[Nargs].imag = 0.0;
     firstVals[Nargs].flagComplex = 0;
@@ -627,7 +991,12 @@ void ppl_directive_fit(ppl_context *c, parserLine *pl, parserOutput *in, int int
    }
 
   // Calculate and print the Hessian matrix
-  hessian = GetHessian(&dataComm);
+  if (JTJ!=NULL)
+   {
+    hessian = JTJ; // Residuals were weighted by unit error bars if none were supplied
+    gsl_matrix_scale(hessian, -1.0 / gsl_pow_2(dataComm.flagYErrorBars ? 1.0 : dataComm.sigmaData));
+   }
+  else hessian = GetHessian(&dataComm);
   matrixPrint(c, hessian, dataComm.NParams, scratchPad);
   sprintf(c->errcontext.tempErrStr, "\n# Hessian matrix of log-probability distribution:\n# -----------------------------------------------\n\nhessian = %s", scratchPad);
   ppl_report(&c->errcontext,NULL);
@@ -779,6 +1148,7 @@ void ppl_directive_fit(ppl_context *c, parserLine *pl, parserOutput *in, int int
   ppl_memAlloc_AscendOutOfContext(contextLocalVec);
 
 cleanup:
+  fitWorkersFree(&dataComm);
   __sync_sub_and_fetch(&funcDef->refCount,1);
   return;
  }
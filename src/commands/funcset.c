@@ -96,6 +96,7 @@ void ppl_directive_funcset(ppl_context *c, parserLine *pl, parserOutput *in, int
   f->realOnly     = 0;
   f->dimlessOnly  = 0;
   f->needSelfThis = 0;
+  f->stateful     = 0;
   f->next         = NULL;
   f->LaTeX        = NULL;
   f->description  = NULL;
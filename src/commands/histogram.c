@@ -35,6 +35,7 @@
 #include "parser/parser.h"
 #include "settings/settings.h"
 #include "settings/settingTypes.h"
+#include "stringTools/strConstants.h"
 #include "userspace/context.h"
 #include "userspace/contextVarDef.h"
 #include "userspace/garbageCollector.h"
@@ -47,8 +48,10 @@
 
 #define TBADD2(et,pos) ppl_tbAdd(c,pl->srcLineN,pl->srcId,pl->srcFname,0,et,pos,pl->linetxt,"")
 
-#define COUNTEDERR1 if (errCount >0) { errCount--;
-#define COUNTEDERR2 if (errCount==0) { sprintf(c->errcontext.tempErrStr, "%s: Too many errors: no more errors will be shown.",filenameOut); ppl_warning(&c->errcontext,ERR_STACKED,NULL); } }
+#define COUNTEDERR1 if (*errCount >0) { (*errCount)--;
+#define COUNTEDERR2 if (*errCount==0) { sprintf(c->errcontext.tempErrStr, "%s: Too many errors: no more errors will be shown.",filenameOut); ppl_warning(&c->errcontext,ERR_STACKED,NULL); } }
+
+#define HISTOGRAM_MAXBINS 1e7
 
 static int hcompare(const void *x, const void *y)
  {
@@ -57,23 +60,245 @@ static int hcompare(const void *x, const void *y)
   else                                                  return  0.0;
  }
 
+// State of a histogram which is built up as its data are read, a block at a time. Only the bin counts are stored,
+// so files which are much larger than the available memory may be histogrammed.
+typedef struct histogramStream
+ {
+  ppl_context  *c;
+  pplObj       *stk;
+  int           ready, failed, logAxis, gotBinList;
+  int           minSet, maxSet, *errCount;
+  double        min, max, dmin, dmax;
+  pplObj        firstEntry, rangeUnit;
+  char         *filenameOut;
+  long          Nused;
+  double       *bins, *binCounts; // Explicitly specified bin boundaries, and the number of points between each pair
+  long          Nbins;
+  double        binOrigin, binWidth;
+  double       *counts;           // For regular bins, counts[m-mBase] is the number of points in the bin with upper limit binOrigin + m*binWidth
+  long          mBase, Ncounts;
+  char          errText[LSTR_LENGTH];
+ } histogramStream;
+
+// Decide whether datapoint x should be included in the histogram, and if so, return in xout the value to bin
+static int histogram_accept(histogramStream *h, double x, double *xout)
+ {
+  ppl_context *c           = h->c;
+  int         *errCount    = h->errCount;
+  char        *filenameOut = h->filenameOut;
+  pplObj       v;
+  if ( !gsl_finite(x)               ) return 0; // Ignore non-finite datapoints
+  if ( (h->minSet) && (x < h->min)  ) return 0; // Ignore out-of-range datapoints
+  if ( (h->maxSet) && (x > h->max)  ) return 0; // Ignore out-of-range datapoints
+
+  if (h->logAxis)
+   {
+    if (x<=0.0) { COUNTEDERR1; v=h->firstEntry; v.real=x; sprintf(c->errcontext.tempErrStr,"Negative or zero values are not allowed in the construction of histograms in log space; value of x=%s will be ignored.",ppl_unitsNumericDisplay(c,&v, 0, 0, 0)); ppl_warning(&c->errcontext,ERR_NUMERICAL,NULL); COUNTEDERR2; return 0; }
+    x = log(x); // If we're constructing histogram in log space, log data now
+    if (!gsl_finite(x)) return 0;
+   }
+  *xout = x;
+  return 1;
+ }
+
+// Work out the range of x spanned by regularly spaced bins, given the range spanned by the data
+static void histogram_range(histogramStream *h, double dmin, double dmax, double *xbinmin, double *xbinmax)
+ {
+  *xbinmin = dmin;
+  *xbinmax = dmax;
+  if (h->minSet) *xbinmin = h->logAxis ? log(h->min) : h->min;
+  if (h->maxSet) *xbinmax = h->logAxis ? log(h->max) : h->max;
+  if (*xbinmax < *xbinmin) { double temp=*xbinmax; *xbinmax=*xbinmin; *xbinmin=temp; }
+ }
+
+// Work out the width and origin of regularly spaced bins, and check them against the units of the data. The range
+// xbinmin to xbinmax is only used if the bin width is to be chosen automatically.
+static int histogram_binSpacing(histogramStream *h, double xbinmin, double xbinmax)
+ {
+  ppl_context *c = h->c;
+  pplObj      *stk = h->stk;
+  pplObj      *BinWidth, *BinOrigin, tempValObj, rangeVal;
+  int          BinOriginSet;
+  double       BinOriginDbl=0, BinWidthDbl;
+  pplObj      *inbinWidth  = &stk[PARSE_histogram_binwidth];
+  pplObj      *inbinOrigin = &stk[PARSE_histogram_binorigin];
+  const int    logAxis = h->logAxis;
+  pplObj       firstEntry = h->firstEntry;
+  char        *errText = h->errText;
+
+  if (DEBUG) { sprintf(c->errcontext.tempErrStr, "Prior to application of BinOrigin, histogram command using range [%e:%e]",xbinmin,xbinmax); ppl_log(&c->errcontext,NULL); }
+
+  if (inbinWidth->objType == PPLOBJ_NUM)
+   { BinWidth = inbinWidth; }
+  else if (c->set->term_current.BinWidthAuto)
+   {
+    BinWidth               = &tempValObj;
+    tempValObj             = firstEntry;
+    tempValObj.flagComplex = 0;
+    tempValObj.imag        = 0.0;
+    tempValObj.real        = (xbinmax-xbinmin)/100;
+    if (logAxis) tempValObj.real = exp(tempValObj.real);
+   }
+  else
+   { BinWidth  = &(c->set->term_current.BinWidth); }
+
+  if (inbinOrigin->objType == PPLOBJ_NUM) { BinOrigin = inbinOrigin;                       BinOriginSet = 1;                                   }
+  else                                    { BinOrigin = &(c->set->term_current.BinOrigin); BinOriginSet = !c->set->term_current.BinOriginAuto; }
+
+  rangeVal = h->rangeUnit;
+  if ((!logAxis) && (!ppl_unitsDimEqual(&firstEntry,BinWidth))) { sprintf(errText,"The bin width supplied to the histogram command has conflicting physical dimensions with the data supplied. The former has units of <%s>, whilst the latter has units of <%s>.", ppl_printUnit(c,BinWidth,NULL,NULL,0,1,0), ppl_printUnit(c,&firstEntry,NULL,NULL,1,1,0)); return 1; }
+  if ((logAxis) && (BinWidth->dimensionless==0)) { sprintf(errText, "For logarithmically spaced bins, the multiplicative spacing between bins must be dimensionless. The supplied spacing has units of <%s>.", ppl_printUnit(c,BinWidth,NULL,NULL,0,1,0)); return 1; }
+  if ((BinOriginSet) && (!ppl_unitsDimEqual(&firstEntry,BinOrigin))) { sprintf(errText, "The bin origin supplied to the histogram command has conflicting physical dimensions with the data supplied. The former has units of <%s>, whilst the latter has units of <%s>.", ppl_printUnit(c,BinOrigin,NULL,NULL,0,1,0), ppl_printUnit(c,&firstEntry,NULL,NULL,1,1,0)); return 1; }
+  if ((logAxis) && (BinWidth->real <= 1.0)) { sprintf(errText, "For logarithmically spaced bins, the multiplicative spacing between bins must be greater than 1.0. Value supplied was %s.", ppl_unitsNumericDisplay(c,BinWidth,0,0,0)); return 1; }
+  if (BinWidth->real <= 0.0) { sprintf(errText, "The bin width supplied to the histogram command must be greater than zero. Value supplied was %s.", ppl_unitsNumericDisplay(c,BinWidth,0,0,0)); return 1; }
+  if ((logAxis) && (BinOriginSet) && (BinOrigin->real <= 0.0)) { sprintf(errText, "For logarithmically spaced bins, the specified bin origin must be greater than zero. Value supplied was %s.", ppl_unitsNumericDisplay(c,BinOrigin,0,0,0)); return 1; }
+  if ((logAxis) && (h->minSet) && (h->min <= 0.0)) { rangeVal.real=h->min; sprintf(errText, "For logarithmically spaced bins, the specified minimum must be greater than zero. Value supplied was %s.", ppl_unitsNumericDisplay(c,&rangeVal,0,0,0)); return 1; }
+  if ((logAxis) && (h->maxSet) && (h->max <= 0.0)) { rangeVal.real=h->max; sprintf(errText, "For logarithmically spaced bins, the specified maximum must be greater than zero. Value supplied was %s.", ppl_unitsNumericDisplay(c,&rangeVal,0,0,0)); return 1; }
+  if ((h->minSet||h->maxSet)&&(!ppl_unitsDimEqual(&firstEntry,&rangeVal))) { sprintf(errText, "The range supplied to the histogram command has conflicting physical dimensions with the data supplied. The former has units of <%s>, whilst the latter has units of <%s>.", ppl_printUnit(c,&rangeVal,NULL,NULL,0,1,0), ppl_printUnit(c,&firstEntry,NULL,NULL,1,1,0)); return 1; }
+  if (!gsl_finite(BinWidth->real)) { sprintf(errText, "The bin width specified to the histogram command is not a finite number."); return 1; }
+  if (BinOriginSet && !gsl_finite(BinOrigin->real)) { sprintf(errText, "The bin origin specified to the histogram command is not a finite number."); return 1; }
+
+  if (logAxis) { if (BinOriginSet) BinOriginDbl = log(BinOrigin->real); BinWidthDbl = log(BinWidth->real); }
+  else         { if (BinOriginSet) BinOriginDbl =     BinOrigin->real ; BinWidthDbl =     BinWidth->real ; }
+
+  if (DEBUG) { sprintf(c->errcontext.tempErrStr, "Histogram command using a bin width of %e and a bin origin of %e.", BinWidthDbl, BinOriginDbl); ppl_log(&c->errcontext,NULL); }
+
+  // Bins lie at BinOriginDbl + m*BinWidthDbl for integer m
+  if (BinOriginSet) BinOriginDbl = BinOriginDbl - BinWidthDbl * floor(BinOriginDbl / BinWidthDbl);
+  else              BinOriginDbl = 0.0;
+  h->binOrigin = BinOriginDbl;
+  h->binWidth  = BinWidthDbl;
+  return 0;
+ }
+
+// Read an explicitly specified list of bin boundaries, and sort them into ascending order
+static int histogram_binList(histogramStream *h)
+ {
+  ppl_context *c = h->c;
+  pplObj      *stk = h->stk;
+  int          binListLen=0, j=0;
+  int          pos=PARSE_histogram_bin_list;
+  while (stk[pos].objType == PPLOBJ_NUM)
+   {
+    pos = (int)round(stk[pos].real);
+    if (pos<=0) break;
+    binListLen++;
+   }
+  h->bins      = (double *)malloc((binListLen+1)*sizeof(double));
+  h->binCounts = (double *)malloc((binListLen+1)*sizeof(double));
+  if ((h->bins == NULL) || (h->binCounts == NULL)) { sprintf(h->errText, "Out of memory."); return 1; }
+  pos=PARSE_histogram_bin_list;
+  while (stk[pos].objType == PPLOBJ_NUM)
+   {
+    pplObj *val;
+    pos = (int)round(stk[pos].real);
+    if (pos<=0) break;
+    val = &stk[pos+PARSE_histogram_x_bin_list];
+    if (!ppl_unitsDimEqual(&h->firstEntry,val)) { sprintf(c->errcontext.tempErrStr, "The supplied bin boundary at x=%s has conflicting physical dimensions with the data supplied, which has units of <%s>. Ignoring this bin boundary.", ppl_printUnit(c,val,NULL,NULL,0,1,0), ppl_printUnit(c,&h->firstEntry,NULL,NULL,1,1,0)); ppl_warning(&c->errcontext,ERR_NUMERICAL,NULL); }
+    else { h->bins[j++] = val->real; }
+   }
+  h->Nbins = j; // some of the bins may have been rejected
+  qsort((void *)h->bins, h->Nbins, sizeof(double), hcompare); // Make sure that bins are in ascending order
+  for (j=0; j<=h->Nbins; j++) h->binCounts[j]=0.0;
+  return 0;
+ }
+
+// Add a datapoint, which has already been through histogram_accept(), to the bin counts
+static int histogram_add(histogramStream *h, double x)
+ {
+  if ((h->Nused==0) || (x<h->dmin)) h->dmin = x;
+  if ((h->Nused==0) || (x>h->dmax)) h->dmax = x;
+  h->Nused++;
+
+  if (h->gotBinList) // Find the first boundary which x does not exceed; x lies in the bin below it
+   {
+    long lo=0, hi=h->Nbins;
+    while (lo<hi) { long mid=(lo+hi)/2; if (x > h->bins[mid]) lo=mid+1; else hi=mid; }
+    if ((lo>0) && (lo<h->Nbins)) h->binCounts[lo-1] += 1.0;
+   }
+  else // Regular bins are counted in a window of bin numbers, which grows as data arrive outside it
+   {
+    const double dm = ceil((x - h->binOrigin) / h->binWidth);
+    long         m;
+    if (fabs(dm) > 1e18) { sprintf(h->errText, "The supplied value of BinWidth produces a binning scheme with more than 1e7 bins. This is probably not sensible."); return 1; }
+    m = (long)dm;
+    if      (x >  h->binOrigin +  m   *h->binWidth) m++; // Correct for rounding, so that x is counted against the same
+    else if (x <= h->binOrigin + (m-1)*h->binWidth) m--; // bin boundaries as are finally returned
+    if ((h->Ncounts==0) || (m<h->mBase) || (m>=h->mBase+h->Ncounts))
+     {
+      const long needLo = (h->Ncounts==0) ? m   : ((m<h->mBase) ? m : h->mBase);
+      const long needHi = (h->Ncounts==0) ? m+1 : ((m>=h->mBase+h->Ncounts) ? m+1 : h->mBase+h->Ncounts);
+      long       newLen = (needHi-needLo > 2*h->Ncounts) ? (needHi-needLo) : (2*h->Ncounts);
+      long       newLo  = (m<h->mBase) ? (needHi-newLen) : needLo;
+      double    *newCounts;
+      long       i;
+      if (needHi-needLo > HISTOGRAM_MAXBINS) { sprintf(h->errText, "The supplied value of BinWidth produces a binning scheme with more than 1e7 bins. This is probably not sensible."); return 1; }
+      if (newLen < 64) newLen = 64;
+      newCounts = (double *)malloc(newLen*sizeof(double));
+      if (newCounts == NULL) { sprintf(h->errText, "Out of memory."); return 1; }
+      for (i=0; i<newLen; i++) newCounts[i]=0.0;
+      if (h->Ncounts>0) memcpy(newCounts + (h->mBase-newLo), h->counts, h->Ncounts*sizeof(double));
+      if (h->counts!=NULL) free(h->counts);
+      h->counts  = newCounts;
+      h->mBase   = newLo;
+      h->Ncounts = newLen;
+     }
+    h->counts[m-h->mBase] += 1.0;
+   }
+  return 0;
+ }
+
+// Work out the binning scheme once the units of the data are known
+static int histogram_setup(histogramStream *h, double dmin, double dmax)
+ {
+  double xbinmin, xbinmax;
+  h->ready = 1;
+  if (h->gotBinList) return histogram_binList(h);
+  histogram_range(h, dmin, dmax, &xbinmin, &xbinmax);
+  return histogram_binSpacing(h, xbinmin, xbinmax);
+ }
+
+// Consumer of data blocks, passed to the datafile reader via c->dataBlockFn
+static void histogram_block(void *arg, dataTable *t, dataBlock *blk)
+ {
+  histogramStream *h = (histogramStream *)arg;
+  long j;
+  double x;
+  if ((h->failed) || (blk->blockPosition<1)) return;
+  if (!h->ready)
+   {
+    h->firstEntry = t->firstEntries[0];
+    if (histogram_setup(h, 0, 0)) { h->failed=1; return; }
+   }
+  for (j=0; j<blk->blockPosition; j++)
+   if (histogram_accept(h, blk->data_real[j*t->Ncolumns_real], &x))
+    if (histogram_add(h, x)) { h->failed=1; return; }
+ }
+
+static void histogram_free(histogramStream *h)
+ {
+  if (h->bins     !=NULL) free(h->bins);
+  if (h->binCounts!=NULL) free(h->binCounts);
+  if (h->counts   !=NULL) free(h->counts);
+  h->bins = h->binCounts = h->counts = NULL;
+ }
+
 void ppl_directive_histogram(ppl_context *c, parserLine *pl, parserOutput *in, int interactive, int iterDepth)
  {
   pplObj        *stk = in->stk;
   dataTable     *data;
-  dataBlock     *blk;
-  long int       i=0, j, k;
+  long int       i=0, j;
   int            contextLocalVec, contextDataTab, errCount=DATAFILE_NERRS;
-  int            gotBinList, logAxis;
+  int            gotBinList, logAxis, streamed;
   pplFunc       *funcPtr;
-  pplObj         v, firstEntry;
+  pplObj         firstEntry;
   char           filenameOut[FNAME_LENGTH]="";
   pplObj         unit  [USING_ITEMS_MAX];
   int            minSet[USING_ITEMS_MAX], maxSet[USING_ITEMS_MAX];
   double         min   [USING_ITEMS_MAX], max   [USING_ITEMS_MAX];
-  double        *xdata;
   parserLine    *spool=NULL, **dataSpool = &spool;
   histogramDescriptor *output;
+  histogramStream      hs;
 
   // Read ranges
   {
@@ -120,6 +345,27 @@ void ppl_directive_histogram(ppl_context *c, parserLine *pl, parserOutput *in, i
     }
   }
 
+  // Work out whether we are constructing histogram in linear space or log space
+  gotBinList = (stk[PARSE_histogram_bin_list].objType==PPLOBJ_NUM);
+  logAxis = ((!gotBinList) && (c->set->XAxes[1].log == SW_BOOL_TRUE)); // Read from axis x1
+
+  // The bins can be worked out before any data are read, unless their width is to be chosen automatically to suit
+  // the range of the data. In that case, the data must be read in full before they can be binned.
+  streamed = gotBinList || (stk[PARSE_histogram_binwidth].objType == PPLOBJ_NUM) || (!c->set->term_current.BinWidthAuto) || (minSet[0]&&maxSet[0]);
+
+  memset(&hs, 0, sizeof(hs));
+  hs.c           = c;
+  hs.stk         = stk;
+  hs.logAxis     = logAxis;
+  hs.gotBinList  = gotBinList;
+  hs.minSet      = minSet[0];
+  hs.maxSet      = maxSet[0];
+  hs.min         = min[0];
+  hs.max         = max[0];
+  hs.errCount    = &errCount;
+  hs.filenameOut = filenameOut;
+  if (minSet[0]||maxSet[0]) hs.rangeUnit = unit[0];
+
   // Allocate a new memory context for the data file we're about to read
   contextLocalVec= ppl_memAlloc_DescendIntoNewContext();
   contextDataTab = ppl_memAlloc_DescendIntoNewContext();
@@ -128,12 +374,15 @@ void ppl_directive_histogram(ppl_context *c, parserLine *pl, parserOutput *in, i
    {
     const int NcolRequired=1;
     int status=0, j;
+    if (streamed) { c->dataBlockFn = (void *)histogram_block; c->dataBlockArg = (void *)&hs; }
     ppldata_fromCmd(c, &data, pl, in, 0, filenameOut, dataSpool, PARSE_TABLE_histogram_, 0, NcolRequired, 0, min, minSet, max, maxSet, unit, 0, &status, c->errStat.errBuff, &errCount, iterDepth);
+    c->dataBlockFn = c->dataBlockArg = NULL;
 
     // Exit on error
     if ((status)||(data==NULL))
      {
       TBADD2(ERR_GENERIC,0);
+      histogram_free(&hs);
       ppl_memAlloc_AscendOutOfContext(contextLocalVec);
       return;
      }
@@ -142,177 +391,93 @@ void ppl_directive_histogram(ppl_context *c, parserLine *pl, parserOutput *in, i
     for (j=0; j<NcolRequired; j++)
      if (minSet[j] || maxSet[j])
       {
-       if (!ppl_unitsDimEqual(&unit[j],data->firstEntries+j)) { sprintf(c->errStat.errBuff, "The minimum and maximum limits specified in range %d in the fit command have conflicting physical dimensions with the data returned from the data file. The limits have units of <%s>, whilst the data have units of <%s>.", j+1, ppl_printUnit(c,unit+j,NULL,NULL,0,1,0), ppl_printUnit(c,data->firstEntries+j,NULL,NULL,1,1,0)); TBADD2(ERR_NUMERICAL,0); return; }
+       if (!ppl_unitsDimEqual(&unit[j],data->firstEntries+j)) { sprintf(c->errStat.errBuff, "The minimum and maximum limits specified in range %d in the fit command have conflicting physical dimensions with the data returned from the data file. The limits have units of <%s>, whilst the data have units of <%s>.", j+1, ppl_printUnit(c,unit+j,NULL,NULL,0,1,0), ppl_printUnit(c,data->firstEntries+j,NULL,NULL,1,1,0)); TBADD2(ERR_NUMERICAL,0); histogram_free(&hs); ppl_memAlloc_AscendOutOfContext(contextLocalVec); return; }
       }
 
-    // Check that we have at least three datapoints
-    if (data->Nrows < 3)
-     {
-      sprintf(c->errStat.errBuff, "Histogram construction is only possible on data sets with members at at least three values of x.");
-      TBADD2(ERR_NUMERICAL,0); return;
-     }
-
     firstEntry = data->firstEntries[0];
    }
 
-  // Transfer data from multiple data tables into a single vector
-  xdata = (double *)ppl_memAlloc_incontext(data->Nrows * sizeof(double), contextLocalVec);
-
-  if (xdata==NULL) { sprintf(c->errStat.errBuff, "Out of memory."); TBADD2(ERR_MEMORY,0); return; }
-
-  // Copy data table into an array of x values
-  blk = data->first; i=0;
-  while (blk != NULL)
+  if (data->blockFn != NULL)
    {
-    for (j=0; j<blk->blockPosition; j++) xdata[i++] = blk->data_real[j];
-    blk=blk->next;
+    // Pass the last, partially-filled, block of data to the histogram
+    histogram_block(&hs, data, data->current);
    }
-
-  // Free original data table which is no longer needed
-  ppl_memAlloc_AscendOutOfContext(contextDataTab);
-
-  // Sort data vector
-  qsort((void *)xdata, i, sizeof(double), hcompare);
-
-  // Work out whether we are constructing histogram in linear space or log space
-  gotBinList = (stk[PARSE_histogram_bin_list].objType==PPLOBJ_NUM);
-  logAxis = ((!gotBinList) && (c->set->XAxes[1].log == SW_BOOL_TRUE)); // Read from axis x1
-
-  // Filter out any values of x which are out-of-range
-  for (j=k=0; j<i; j++)
+  else
    {
-    if ( !gsl_finite(xdata[j])            ) continue; // Ignore non-finite datapoints
-    if ( (minSet[0]) && (xdata[j]<min[0]) ) continue; // Ignore out-of-range datapoints
-    if ( (maxSet[0]) && (xdata[j]>max[0]) ) continue; // Ignore out-of-range datapoints
-
-    if (logAxis)
+    // Data weren't streamed, so bin them now, once their range is known
+    dataBlock *blk;
+    double    *xdata, x;
+    xdata = (double *)ppl_memAlloc_incontext(data->Nrows * sizeof(double) + 1, contextLocalVec);
+    if (xdata==NULL) { sprintf(c->errStat.errBuff, "Out of memory."); TBADD2(ERR_MEMORY,0); ppl_memAlloc_AscendOutOfContext(contextLocalVec); return; }
+    hs.firstEntry = firstEntry;
+    for (blk=data->first, i=0; blk!=NULL; blk=blk->next)
+     for (j=0; j<blk->blockPosition; j++)
+      if (histogram_accept(&hs, blk->data_real[j*data->Ncolumns_real], &x))
+       {
+        if ((i==0) || (x<hs.dmin)) hs.dmin = x;
+        if ((i==0) || (x>hs.dmax)) hs.dmax = x;
+        xdata[i++] = x;
+       }
+    if (i>0)
      {
-      if (xdata[j]<=0.0) { COUNTEDERR1; v=firstEntry; v.real=xdata[j]; sprintf(c->errcontext.tempErrStr,"Negative or zero values are not allowed in the construction of histograms in log space; value of x=%s will be ignored.",ppl_unitsNumericDisplay(c,&v, 0, 0, 0)); ppl_warning(&c->errcontext,ERR_NUMERICAL,NULL); COUNTEDERR2; continue; }
-      xdata[k]=log(xdata[j]); // If we're constructing histogram in log space, log data now
-      if (!gsl_finite(xdata[k])) continue;
-     } else {
-      xdata[k]=xdata[j];
+      hs.failed = histogram_setup(&hs, hs.dmin, hs.dmax);
+      for (j=0; (j<i) && (!hs.failed); j++) hs.failed = histogram_add(&hs, xdata[j]);
      }
-    k++;
    }
 
+  // Free original data table which is no longer needed
+  ppl_memAlloc_AscendOutOfContext(contextDataTab);
+
+  if (hs.failed) { strcpy(c->errStat.errBuff, hs.errText); TBADD2(ERR_NUMERICAL,0); histogram_free(&hs); ppl_memAlloc_AscendOutOfContext(contextLocalVec); return; }
+
   // Check that we have at least three points to interpolate
-  if (k<3) { sprintf(c->errStat.errBuff, "Histogram construction is only possible on data sets with members at at least three values of x."); TBADD2(ERR_NUMERICAL,0); return; }
+  if (hs.Nused<3) { sprintf(c->errStat.errBuff, "Histogram construction is only possible on data sets with members at at least three values of x."); TBADD2(ERR_NUMERICAL,0); histogram_free(&hs); ppl_memAlloc_AscendOutOfContext(contextLocalVec); return; }
 
   // Make histogramDescriptor data structure
   output = (histogramDescriptor *)malloc(sizeof(histogramDescriptor));
-  if (output == NULL) { sprintf(c->errStat.errBuff, "Out of memory."); TBADD2(ERR_MEMORY,0); return; }
+  if (output == NULL) { sprintf(c->errStat.errBuff, "Out of memory."); TBADD2(ERR_MEMORY,0); histogram_free(&hs); return; }
   output->unit     = firstEntry;
   output->log      = logAxis;
   output->filename = (char *)malloc(strlen(filenameOut)+1);
-  if (output->filename == NULL) { sprintf(c->errStat.errBuff, "Out of memory."); TBADD2(ERR_MEMORY,0); free(output); return; }
+  if (output->filename == NULL) { sprintf(c->errStat.errBuff, "Out of memory."); TBADD2(ERR_MEMORY,0); free(output); histogram_free(&hs); return; }
   strcpy(output->filename , filenameOut);
 
-  // Now need to work out what bins we're going to use
   if (gotBinList)
    {
-    int binListLen=0, j;
-    int pos=PARSE_histogram_bin_list;
-    while (stk[pos].objType == PPLOBJ_NUM)
-     {
-      pos = (int)round(stk[pos].real);
-      if (pos<=0) break;
-      binListLen++;
-     }
-    output->bins  = (double *)malloc(binListLen*sizeof(double));
-    if (output->bins == NULL) { sprintf(c->errStat.errBuff, "Out of memory."); TBADD2(ERR_MEMORY,0); free(output); free(output->filename); return; }
-    j=0;
-    pos=PARSE_histogram_bin_list;
-    while (stk[pos].objType == PPLOBJ_NUM)
-     {
-      pplObj *val;
-      pos = (int)round(stk[pos].real);
-      if (pos<=0) break;
-      val = &stk[pos+PARSE_histogram_x_bin_list];
-      if (!ppl_unitsDimEqual(&firstEntry,val)) { sprintf(c->errcontext.tempErrStr, "The supplied bin boundary at x=%s has conflicting physical dimensions with the data supplied, which has units of <%s>. Ignoring this bin boundary.", ppl_printUnit(c,val,NULL,NULL,0,1,0), ppl_printUnit(c,&firstEntry,NULL,NULL,1,1,0)); ppl_warning(&c->errcontext,ERR_NUMERICAL,NULL); }
-      else { output->bins[j++] = val->real; }
-     }
-    binListLen = j; // some of the bins may have been rejected
-    output->Nbins = binListLen;
-    qsort((void *)output->bins, binListLen, sizeof(double), hcompare); // Make sure that bins are in ascending order
+    // The counts were accumulated directly against the supplied list of bins
+    output->Nbins   = hs.Nbins;
+    output->bins    = hs.bins;
+    output->binvals = hs.binCounts;
+    hs.bins = hs.binCounts = NULL;
    }
   else
    {
-    pplObj *BinWidth, *BinOrigin, tempValObj;
-    int     BinOriginSet;
-    double  BinOriginDbl=0, BinWidthDbl, xbinmin, xbinmax;
-    pplObj *inbinWidth  = &stk[PARSE_histogram_binwidth];
-    pplObj *inbinOrigin = &stk[PARSE_histogram_binorigin];
-    xbinmin = xdata[0];
-    xbinmax = xdata[k-1];
-    if (minSet[0]) xbinmin = logAxis ? log(min[0]) : min[0];
-    if (maxSet[0]) xbinmax = logAxis ? log(max[0]) : max[0];
-    if (xbinmax < xbinmin) { double temp=xbinmax; xbinmax=xbinmin; xbinmin=temp; }
-    if (DEBUG) { sprintf(c->errcontext.tempErrStr, "Prior to application of BinOrigin, histogram command using range [%e:%e]",xbinmin,xbinmax); ppl_log(&c->errcontext,NULL); }
-
-    if (inbinWidth->objType == PPLOBJ_NUM)
-     { BinWidth = inbinWidth; }
-    else if (c->set->term_current.BinWidthAuto)
-     {
-      BinWidth               = &tempValObj;
-      tempValObj             = firstEntry;
-      tempValObj.flagComplex = 0;
-      tempValObj.imag        = 0.0;
-      tempValObj.real        = (xbinmax-xbinmin)/100;
-      if (logAxis) tempValObj.real = exp(tempValObj.real);
-     }
-    else
-     { BinWidth  = &(c->set->term_current.BinWidth); }
-
-    if (inbinOrigin->objType == PPLOBJ_NUM) { BinOrigin = inbinOrigin;                       BinOriginSet = 1;                                   }
-    else                                    { BinOrigin = &(c->set->term_current.BinOrigin); BinOriginSet = !c->set->term_current.BinOriginAuto; }
-
-    if ((!logAxis) && (!ppl_unitsDimEqual(&firstEntry,BinWidth))) { sprintf(c->errStat.errBuff,"The bin width supplied to the histogram command has conflicting physical dimensions with the data supplied. The former has units of <%s>, whilst the latter has units of <%s>.", ppl_printUnit(c,BinWidth,NULL,NULL,0,1,0), ppl_printUnit(c,&firstEntry,NULL,NULL,1,1,0)); TBADD2(ERR_NUMERICAL,0); free(output); free(output->filename); return; }
-    if ((logAxis) && (BinWidth->dimensionless==0)) { sprintf(c->errStat.errBuff, "For logarithmically spaced bins, the multiplicative spacing between bins must be dimensionless. The supplied spacing has units of <%s>.", ppl_printUnit(c,BinWidth,NULL,NULL,0,1,0)); TBADD2(ERR_NUMERICAL,0); free(output); free(output->filename); return; }
-    if ((BinOriginSet) && (!ppl_unitsDimEqual(&firstEntry,BinOrigin))) { sprintf(c->errStat.errBuff, "The bin origin supplied to the histogram command has conflicting physical dimensions with the data supplied. The former has units of <%s>, whilst the latter has units of <%s>.", ppl_printUnit(c,BinOrigin,NULL,NULL,0,1,0), ppl_printUnit(c,&firstEntry,NULL,NULL,1,1,0)); TBADD2(ERR_NUMERICAL,0); free(output); free(output->filename); return; }
-    if ((logAxis) && (BinWidth->real <= 1.0)) { sprintf(c->errStat.errBuff, "For logarithmically spaced bins, the multiplicative spacing between bins must be greater than 1.0. Value supplied was %s.", ppl_unitsNumericDisplay(c,BinWidth,0,0,0)); TBADD2(ERR_NUMERICAL,0); free(output); free(output->filename); return; }
-    if (BinWidth->real <= 0.0) { sprintf(c->errStat.errBuff, "The bin width supplied to the histogram command must be greater than zero. Value supplied was %s.", ppl_unitsNumericDisplay(c,BinWidth,0,0,0)); TBADD2(ERR_NUMERICAL,0); free(output); free(output->filename); return; }
-    if ((logAxis) && (BinOriginSet) && (BinOrigin->real <= 0.0)) { sprintf(c->errStat.errBuff, "For logarithmically spaced bins, the specified bin origin must be greater than zero. Value supplied was %s.", ppl_unitsNumericDisplay(c,BinOrigin,0,0,0)); TBADD2(ERR_NUMERICAL,0); free(output); free(output->filename); return; }
-    if ((logAxis) && (minSet[0]) && (min[0] <= 0.0)) { unit[0].real=min[0]; sprintf(c->errStat.errBuff, "For logarithmically spaced bins, the specified minimum must be greater than zero. Value supplied was %s.", ppl_unitsNumericDisplay(c,&unit[0],0,0,0)); TBADD2(ERR_NUMERICAL,0); free(output); free(output->filename); return; }
-    if ((logAxis) && (maxSet[0]) && (max[0] <= 0.0)) { unit[0].real=max[0]; sprintf(c->errStat.errBuff, "For logarithmically spaced bins, the specified maximum must be greater than zero. Value supplied was %s.", ppl_unitsNumericDisplay(c,&unit[0],0,0,0)); TBADD2(ERR_NUMERICAL,0); free(output); free(output->filename); return; }
-    if ((minSet[0]||maxSet[0])&&(!ppl_unitsDimEqual(&firstEntry,&unit[0]))) { sprintf(c->errStat.errBuff, "The range supplied to the histogram command has conflicting physical dimensions with the data supplied. The former has units of <%s>, whilst the latter has units of <%s>.", ppl_printUnit(c,&unit[0],NULL,NULL,0,1,0), ppl_printUnit(c,&firstEntry,NULL,NULL,1,1,0)); TBADD2(ERR_NUMERICAL,0); free(output); free(output->filename); return; }
-    if (!gsl_finite(BinWidth->real)) { sprintf(c->errStat.errBuff, "The bin width specified to the histogram command is not a finite number."); TBADD2(ERR_NUMERICAL,0); free(output); free(output->filename); return; }
-    if (BinOriginSet && !gsl_finite(BinOrigin->real)) { sprintf(c->errStat.errBuff, "The bin origin specified to the histogram command is not a finite number."); TBADD2(ERR_NUMERICAL,0); free(output); free(output->filename); return; }
-
-    if (logAxis) { if (BinOriginSet) BinOriginDbl = log(BinOrigin->real); BinWidthDbl = log(BinWidth->real); }
-    else         { if (BinOriginSet) BinOriginDbl =     BinOrigin->real ; BinWidthDbl =     BinWidth->real ; }
-
-    if (DEBUG) { sprintf(c->errcontext.tempErrStr, "Histogram command using a bin width of %e and a bin origin of %e.", BinWidthDbl, BinOriginDbl); ppl_log(&c->errcontext,NULL); }
-
-    // Generate a series of bins to use based on supplied BinWidth and BinOrigin
-    if (BinOriginSet) BinOriginDbl = BinOriginDbl - BinWidthDbl * floor(BinOriginDbl / BinWidthDbl);
-    else              BinOriginDbl = 0.0;
-    xbinmin = floor((xbinmin-BinOriginDbl)/BinWidthDbl)*BinWidthDbl + BinOriginDbl;
-    xbinmax = ceil ((xbinmax-BinOriginDbl)/BinWidthDbl)*BinWidthDbl + BinOriginDbl;
-    if (DEBUG) { sprintf(c->errcontext.tempErrStr, "After application of BinOrigin, histogram command using range [%e:%e]",xbinmin,xbinmax); ppl_log(&c->errcontext,NULL); }
-
-    if (((xbinmax-xbinmin)/BinWidthDbl + 1.0001) > 1e7) { sprintf(c->errStat.errBuff, "The supplied value of BinWidth produces a binning scheme with more than 1e7 bins. This is probably not sensible."); TBADD2(ERR_GENERIC,0); return; }
-    output->Nbins = (long)((xbinmax-xbinmin)/BinWidthDbl + 1.0001);
+    // Generate a series of bins based on the BinWidth and BinOrigin, spanning the data
+    const double BinOriginDbl = hs.binOrigin;
+    const double BinWidthDbl  = hs.binWidth;
+    double       xbinmin, xbinmax;
+    long         kmin;
+    histogram_range(&hs, hs.dmin, hs.dmax, &xbinmin, &xbinmax);
+    xbinmin = floor((xbinmin-BinOriginDbl)/BinWidthDbl);
+    xbinmax = ceil ((xbinmax-BinOriginDbl)/BinWidthDbl);
+    if (((xbinmax-xbinmin) + 1.0001) > HISTOGRAM_MAXBINS) { sprintf(c->errStat.errBuff, "The supplied value of BinWidth produces a binning scheme with more than 1e7 bins. This is probably not sensible."); TBADD2(ERR_GENERIC,0); free(output->filename); free(output); histogram_free(&hs); return; }
+    kmin          = (long)xbinmin;
+    output->Nbins = (long)((xbinmax-xbinmin) + 1.0001);
+    xbinmin       = xbinmin*BinWidthDbl + BinOriginDbl;
+    if (DEBUG) { sprintf(c->errcontext.tempErrStr, "After application of BinOrigin, histogram command using range [%e:%e]",xbinmin,xbinmax*BinWidthDbl + BinOriginDbl); ppl_log(&c->errcontext,NULL); }
     if (DEBUG) { sprintf(c->errcontext.tempErrStr, "Histogram command using %ld bins",output->Nbins); ppl_log(&c->errcontext,NULL); }
-    output->bins = (double *)malloc(output->Nbins*sizeof(double));
-    if (output->bins == NULL) { sprintf(c->errStat.errBuff, "Out of memory."); TBADD2(ERR_MEMORY,0); return; }
-
-    for (j=0; j<output->Nbins; j++) output->bins[j] = xbinmin + j*BinWidthDbl;
-   }
-
-  // Allocate vector for storing histogram values
-  output->binvals = (double *)malloc(output->Nbins * sizeof(double));
-  if (output->binvals == NULL) { sprintf(c->errStat.errBuff, "Out of memory."); TBADD2(ERR_MEMORY,0); free(output->bins); return; }
-  for (i=0; i<output->Nbins; i++) output->binvals[i]=0.0;
+    output->bins    = (double *)malloc(output->Nbins*sizeof(double));
+    output->binvals = (double *)malloc(output->Nbins*sizeof(double));
+    if ((output->bins == NULL) || (output->binvals == NULL)) { sprintf(c->errStat.errBuff, "Out of memory."); TBADD2(ERR_MEMORY,0); if (output->bins!=NULL) free(output->bins); if (output->binvals!=NULL) free(output->binvals); free(output->filename); free(output); histogram_free(&hs); return; }
 
-  // Count number of data values in each histogram bin
-  i=0;
-  for (j=0; j<k; j++) // Loop over all of the data points we have read in
-   {
-    while ((i < output->Nbins) && (xdata[j] > output->bins[i])) i++;
-    if (i>=output->Nbins) break; // We gone off the top of the last bin
-    if (i==0) continue; // We've not yet arrived in the bottom bin
-    output->binvals[i-1] += 1.0;
+    // Bin j spans bins[j] to bins[j+1], and so holds the counts accumulated against the bin number of its upper limit
+    for (j=0; j<output->Nbins; j++)
+     {
+      const long m = kmin + j + 1;
+      output->bins[j]    = BinOriginDbl + (kmin+j)*BinWidthDbl;
+      output->binvals[j] = ((j<output->Nbins-1) && (m>=hs.mBase) && (m<hs.mBase+hs.Ncounts)) ? hs.counts[m-hs.mBase] : 0.0;
+     }
+    histogram_free(&hs);
    }
 
   // If this is a logarithmic set of bins, unlog bin boundaries now
@@ -341,6 +506,7 @@ void ppl_directive_histogram(ppl_context *c, parserLine *pl, parserOutput *in, i
   funcPtr->numOnly         = 1;
   funcPtr->dimlessOnly     = 0;
   funcPtr->needSelfThis    = 0;
+  funcPtr->stateful        = 0;
   funcPtr->functionPtr     = (void *)output;
   funcPtr->argList         = NULL;
   funcPtr->min             = funcPtr->max       = NULL;
@@ -438,6 +438,7 @@ void ppl_directive_interpolate(ppl_context *c, parserLine *pl, parserOutput *in,
   funcPtr->numOnly         = 1;
   funcPtr->dimlessOnly     = 0;
   funcPtr->needSelfThis    = 0;
+  funcPtr->stateful        = 0;
   funcPtr->functionPtr     = (void *)desc;
   funcPtr->argList         = NULL;
   funcPtr->min             = funcPtr->max       = NULL;
@@ -573,7 +574,7 @@ void ppl_interp2d_evaluate(ppl_context *c, const char *FuncName, splineDescripto
 
   if (!bmp)
    {
-    ppl_interp2d_eval(c, &dblout, &c->set->graph_current, (double *)desc->splineObj, desc->sizeX, 2, 3, dblin1, dblin2);
+    ppl_interp2d_eval(c, &dblout, &c->set->graph_current, (double *)desc->splineObj, desc->sizeX, 2, 3, NULL, dblin1, dblin2);
    } else {
     int x = floor(dblin1);
     int y = floor(dblin2);
@@ -29,6 +29,7 @@
 
 #include "commands/interpolate_2d_engine.h"
 #include "coreUtils/memAlloc.h"
+#include "coreUtils/workerPool.h"
 #include "coreUtils/errorReport.h"
 #include "settings/axes_fns.h"
 #include "settings/settings.h"
@@ -38,7 +39,121 @@
 
 #include "datafile.h"
 
-void ppl_interp2d_eval(ppl_context *c, double *output, const pplset_graph *sg, const double *in, const long InSize, const int ColNum, const int NCols, const double x, const double y)
+// Datasets smaller than this are searched exhaustively, without building a spatial index
+#define INTERP2D_INDEX_MINPOINTS 64
+
+// Maximum number of cells along each side of the grid of a spatial index
+#define INTERP2D_INDEX_MAXGRID 4096
+
+// Return the column (or row) of an Ngrid x Ngrid index grid which contains the position u, which is measured as
+// a fraction of the span of the data. Positions outside the span of the data are placed in the edge cells.
+static int ppl_interp2d_cell(const double u, const int Ngrid)
+ {
+  if (!(u>0.0)) return 0;
+  if (u>=1.0)   return Ngrid-1;
+  return GSL_MIN((int)(u*Ngrid), Ngrid-1);
+ }
+
+// Build a spatial index of the points in the array <in>, which has the layout used by ppl_interp2d_eval. Returns
+// NULL if no index is worth building, in which case ppl_interp2d_eval searches through every point.
+ppl_interp2d_index *ppl_interp2d_indexMake(ppl_context *c, const double *in, const long InSize, const int NCols)
+ {
+  long  i, Ncells, *cellOf;
+  int   Ngrid;
+  ppl_interp2d_index *out;
+
+  const double *inX = in;
+  const double *inY = in + InSize;
+
+  const double Xmin = in[NCols*InSize     ];
+  const double Ymin = in[NCols*InSize + 1 ];
+  const double Xscl = in[NCols*(InSize+1)     ] - Xmin;
+  const double Yscl = in[NCols*(InSize+1) + 1 ] - Ymin;
+
+  if (InSize < INTERP2D_INDEX_MINPOINTS) return NULL;
+  if ((!gsl_finite(Xscl)) || (!gsl_finite(Yscl)) || (Xscl<=0) || (Yscl<=0)) return NULL;
+  for (i=0; i<InSize; i++) if ((!gsl_finite(inX[i])) || (!gsl_finite(inY[i]))) return NULL;
+
+  // Aim for an average of two points per cell
+  Ngrid  = (int)GSL_MIN(ceil(sqrt(InSize/2.0)), INTERP2D_INDEX_MAXGRID);
+  Ncells = ((long)Ngrid)*Ngrid;
+
+  out    = (ppl_interp2d_index *)ppl_memAlloc(sizeof(ppl_interp2d_index));
+  cellOf = (long *)ppl_memAlloc(InSize * sizeof(long));
+  if ((out==NULL)||(cellOf==NULL)) return NULL;
+  out->Ngrid     = Ngrid;
+  out->cellStart = (long *)ppl_memAlloc((Ncells+1) * sizeof(long));
+  out->pointList = (long *)ppl_memAlloc(InSize * sizeof(long));
+  if ((out->cellStart==NULL)||(out->pointList==NULL)) return NULL;
+
+  // Count the points in each cell, then sort the point indices by cell
+  for (i=0; i<=Ncells; i++) out->cellStart[i] = 0;
+  for (i=0; i<InSize; i++)
+   {
+    cellOf[i] = ppl_interp2d_cell((inX[i]-Xmin)/Xscl, Ngrid) + ((long)Ngrid) * ppl_interp2d_cell((inY[i]-Ymin)/Yscl, Ngrid);
+    out->cellStart[cellOf[i]+1]++;
+   }
+  for (i=1; i<=Ncells; i++) out->cellStart[i] += out->cellStart[i-1];
+  for (i=0; i<InSize; i++) out->pointList[out->cellStart[cellOf[i]]++] = i;
+  for (i=Ncells; i>0; i--) out->cellStart[i] = out->cellStart[i-1];
+  out->cellStart[0] = 0;
+  return out;
+ }
+
+// Use a spatial index to find the point nearest to (x,y), searching outwards in square rings of cells until no
+// unsearched cell can contain a closer point. Ties go to the point which appears first in the input, as they
+// would in an exhaustive search.
+static long ppl_interp2d_nearest(const double *in, const long InSize, const int NCols, const ppl_interp2d_index *idx, const double x, const double y)
+ {
+  const double *inX = in;
+  const double *inY = in + InSize;
+
+  const double Xmin = in[NCols*InSize     ];
+  const double Ymin = in[NCols*InSize + 1 ];
+  const double Xscl = in[NCols*(InSize+1)     ] - Xmin;
+  const double Yscl = in[NCols*(InSize+1) + 1 ] - Ymin;
+
+  const int    Ngrid = idx->Ngrid;
+  const double u     = (x-Xmin)/Xscl;
+  const double v     = (y-Ymin)/Yscl;
+  const int    cx    = ppl_interp2d_cell(u, Ngrid);
+  const int    cy    = ppl_interp2d_cell(v, Ngrid);
+
+  long   best=-1, p;
+  double DistBest=0;
+  int    r;
+
+  for (r=0; ; r++)
+   {
+    const int i0=cx-r, i1=cx+r, j0=cy-r, j1=cy+r;
+    double    bound = GSL_POSINF;
+    int       i, j;
+
+    for (j=GSL_MAX(j0,0); j<=GSL_MIN(j1,Ngrid-1); j++)
+     for (i=i0; i<=i1; i+=((j==j0)||(j==j1)) ? 1 : (i1-i0)) // Only visit cells on the edge of the ring
+      {
+       const long cell = i + ((long)Ngrid)*j;
+       if ((i<0)||(i>=Ngrid)) continue;
+       for (p=idx->cellStart[cell]; p<idx->cellStart[cell+1]; p++)
+        {
+         const long   k    = idx->pointList[p];
+         const double dist = hypot( (inX[k] - x)/Xscl , (inY[k] - y)/Yscl );
+         if ((best<0) || (dist<DistBest) || ((dist==DistBest)&&(k<best))) { DistBest=dist; best=k; }
+        }
+      }
+
+    // Work out the closest that any point in an unsearched cell could be
+    if (i0>0)       bound = GSL_MIN(bound, u - ((double)i0   )/Ngrid);
+    if (i1<Ngrid-1) bound = GSL_MIN(bound, ((double)(i1+1))/Ngrid - u);
+    if (j0>0)       bound = GSL_MIN(bound, v - ((double)j0   )/Ngrid);
+    if (j1<Ngrid-1) bound = GSL_MIN(bound, ((double)(j1+1))/Ngrid - v);
+    if (!gsl_finite(bound)) break; // Every cell has been searched
+    if ((best>=0) && (DistBest < bound*(1.0-1e-9))) break;
+   }
+  return best;
+ }
+
+void ppl_interp2d_eval(ppl_context *c, double *output, const pplset_graph *sg, const double *in, const long InSize, const int ColNum, const int NCols, const ppl_interp2d_index *idx, const double x, const double y)
  {
   long          i;
   const double *inX = in;
@@ -55,6 +170,12 @@ void ppl_interp2d_eval(ppl_context *c, double *output, const pplset_graph *sg, c
       double DistBest=0;
       unsigned char first=1;
       *output = 0.0;
+      if (idx!=NULL)
+       {
+        long best = ppl_interp2d_nearest(in, InSize, NCols, idx, x, y);
+        if (best>=0) *output = inZ[best];
+        break;
+       }
       for (i=0; i<InSize; i++)
        {
         double dist = hypot( (inX[i] - x)/Xscl , (inY[i] - y)/Yscl );
@@ -83,7 +204,33 @@ void ppl_interp2d_eval(ppl_context *c, double *output, const pplset_graph *sg, c
       double WeightSum = 0.0;
       double h = sqrt( 1.0/InSize );
       *output = 0.0;
-      for (i=0; i<InSize; i++)
+      if (idx!=NULL)
+       {
+        // The kernel is zero beyond a radius of 2h, so only cells overlapping that radius need to be searched
+        const int    Ngrid = idx->Ngrid;
+        const double xf    = (x - in[NCols*InSize    ])/Xscl;
+        const double yf    = (y - in[NCols*InSize + 1])/Yscl;
+        const double rad   = 2*h + 1.0/Ngrid;
+        const int    i0 = ppl_interp2d_cell(xf-rad, Ngrid), i1 = ppl_interp2d_cell(xf+rad, Ngrid);
+        const int    j0 = ppl_interp2d_cell(yf-rad, Ngrid), j1 = ppl_interp2d_cell(yf+rad, Ngrid);
+        int          ic, jc;
+        long         p;
+        for (jc=j0; jc<=j1; jc++) for (ic=i0; ic<=i1; ic++)
+         {
+          const long cell = ic + ((long)Ngrid)*jc;
+          for (p=idx->cellStart[cell]; p<idx->cellStart[cell+1]; p++)
+           {
+            double v, w;
+            i = idx->pointList[p];
+            v = hypot( (inX[i] - x)/Xscl , (inY[i] - y)/Yscl ) / h;
+            w = (v>=2)?0.0:((v>=1)?(0.25*gsl_pow_3(2.0-v)):(1.0-1.5*gsl_pow_2(v)+0.75*gsl_pow_3(v)));
+            if (!gsl_finite(w)) continue;
+            *output   += w * inZ[i];
+            WeightSum += w;
+           }
+         }
+       }
+      else for (i=0; i<InSize; i++)
        {
         double v = hypot( (inX[i] - x)/Xscl , (inY[i] - y)/Yscl ) / h;
         double w = (v>=2)?0.0:((v>=1)?(0.25*gsl_pow_3(2.0-v)):(1.0-1.5*gsl_pow_2(v)+0.75*gsl_pow_3(v)));
@@ -104,12 +251,55 @@ void ppl_interp2d_eval(ppl_context *c, double *output, const pplset_graph *sg, c
   return;
  }
 
+// Work shared between the threads which sample rows of a grid in ppl_interp2d_grid
+typedef struct ppl_interp2d_gridJob
+ {
+  ppl_context              *c;
+  const pplset_graph       *sg;
+  const double             *indata;
+  long                      InSize;
+  int                       k, imax, jmax;
+  const ppl_interp2d_index *idx;
+  pplset_axis              *axis_x, *axis_y;
+  unsigned char             SampleToEdge;
+  double                   *out;
+ } ppl_interp2d_gridJob;
+
+// Sample rows jMin <= j < jMax of the output grid. Each row writes only to its own section of the output, so rows
+// may be processed concurrently.
+static void ppl_interp2d_gridRows(void *arg, int jMin, int jMax)
+ {
+  const ppl_interp2d_gridJob *job = (const ppl_interp2d_gridJob *)arg;
+  const int imax = job->imax, jmax = job->jmax, k = job->k;
+  int       i, j, ct;
+  long      p = ((long)jMin) * imax * k;
+
+  for (j=jMin; j<jMax; j++)
+   {
+    double y = job->SampleToEdge ? pplaxis_InvGetPosition( (((double)j    )/(jmax-1)) , job->axis_y)
+                                 : pplaxis_InvGetPosition( (((double)j+0.5)/(jmax  )) , job->axis_y);
+    for (i=0; i<imax; i++)
+     {
+      double x = job->SampleToEdge ? pplaxis_InvGetPosition( (((double)i    )/(imax-1)) , job->axis_x)
+                                   : pplaxis_InvGetPosition( (((double)i+0.5)/(imax  )) , job->axis_x);
+      job->out[p++] = x;
+      job->out[p++] = y;
+
+      for (ct=2; ct<k; ct++)
+        ppl_interp2d_eval(job->c, &job->out[p++], job->sg, job->indata, job->InSize, ct, k, job->idx, x, y);
+     }
+   }
+  return;
+ }
+
 void ppl_interp2d_grid(ppl_context *c, dataTable **output, const pplset_graph *sg, dataTable *in, pplset_axis *axis_x, pplset_axis *axis_y, unsigned char SampleToEdge, int *XSizeOut, int *YSizeOut)
  {
-  int        i, imax, j, jmax, ims, jms, ct, k, tempContext;
+  int        imax, j, jmax, ims, jms, ct, k, tempContext;
   double    *indata, *MinList, *MaxList, *d[USING_ITEMS_MAX+4];
-  long       p, p2, pc, InSize;
+  long       p2, pc, InSize;
   dataBlock *blk;
+  ppl_interp2d_index *idx = NULL;
+  ppl_interp2d_gridJob rows;
   imax = (sg->SamplesXAuto == SW_BOOL_TRUE) ? sg->samples : sg->SamplesX;
   jmax = (sg->SamplesYAuto == SW_BOOL_TRUE) ? sg->samples : sg->SamplesY;
   *XSizeOut = imax;
@@ -158,22 +348,23 @@ void ppl_interp2d_grid(ppl_context *c, dataTable **output, const pplset_graph *s
     if (MaxList[jms]<=MinList[jms]) { double t=MinList[jms]; MinList[jms]=t*0.999;  MaxList[jms]=t*1.001; }
    }
 
-  // Resample data into new DataTable
-  for (j=0, p=0; j<jmax; j++)
-   {
-    double y = SampleToEdge ? pplaxis_InvGetPosition( (((double)j    )/(jmax-1)) , axis_y)
-                            : pplaxis_InvGetPosition( (((double)j+0.5)/(jmax  )) , axis_y);
-    for (i=0; i<imax; i++)
-     {
-      double x = SampleToEdge ? pplaxis_InvGetPosition( (((double)i    )/(imax-1)) , axis_x)
-                              : pplaxis_InvGetPosition( (((double)i+0.5)/(imax  )) , axis_x);
-      (*output)->current->data_real[p++] = x;
-      (*output)->current->data_real[p++] = y;
+  // Build spatial index of data, unless every point contributes to every sample anyway
+  if (sg->Sample2DMethod != SW_SAMPLEMETHOD_INVSQ) idx = ppl_interp2d_indexMake(c, indata, InSize, k);
 
-      for (ct=2; ct<k; ct++)
-        ppl_interp2d_eval(c, &(*output)->current->data_real[p++], sg, indata, InSize, ct, k, x, y);
-     }
-   }
+  // Resample data into new DataTable, dividing rows between threads
+  rows.c            = c;
+  rows.sg           = sg;
+  rows.indata       = indata;
+  rows.InSize       = InSize;
+  rows.k            = k;
+  rows.idx          = idx;
+  rows.axis_x       = axis_x;
+  rows.axis_y       = axis_y;
+  rows.SampleToEdge = SampleToEdge;
+  rows.imax         = imax;
+  rows.jmax         = jmax;
+  rows.out          = (*output)->current->data_real;
+  ppl_workerRunRows(c->set->term_current.threads, jmax, ppl_interp2d_gridRows, &rows);
 
   // Delete temporary array
   ppl_memAlloc_AscendOutOfContext(tempContext);
@@ -26,7 +26,18 @@
 #include "settings/settings.h"
 #include "userspace/context.h"
 
-void ppl_interp2d_eval(ppl_context *c, double *output, const pplset_graph *sg, const double *in, const long InSize, const int ColNum, const int NCols, const double x, const double y);
+// Spatial index of the (x,y) positions of a dataset, used to find points near to each sample point. Points are
+// binned into an Ngrid x Ngrid grid of cells spanning the range of the data; the indices of the points in cell
+// (i,j) are pointList[cellStart[i+j*Ngrid]] ... pointList[cellStart[i+j*Ngrid+1]-1], in ascending order.
+typedef struct ppl_interp2d_index
+ {
+  int   Ngrid;
+  long *cellStart;
+  long *pointList;
+ } ppl_interp2d_index;
+
+ppl_interp2d_index *ppl_interp2d_indexMake(ppl_context *c, const double *in, const long InSize, const int NCols);
+void ppl_interp2d_eval(ppl_context *c, double *output, const pplset_graph *sg, const double *in, const long InSize, const int ColNum, const int NCols, const ppl_interp2d_index *idx, const double x, const double y);
 void ppl_interp2d_grid(ppl_context *c, dataTable **output, const pplset_graph *sg, dataTable *in, pplset_axis *axis_x, pplset_axis *axis_y, unsigned char SampleToEdge, int *XSizeOut, int *YSizeOut);
 
 #endif
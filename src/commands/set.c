@@ -65,6 +65,7 @@
 
 #include "canvasItems.h"
 #include "children.h"
+#include "datafile_cache.h"
 #include "pplConstants.h"
 
 #define TBADD(et,pos) ppl_tbAdd(c,pl->srcLineN,pl->srcId,pl->srcFname,0,et,pos,pl->linetxt,"")
@@ -745,6 +746,19 @@ void ppl_directive_set(ppl_context *c, parserLine *pl, parserOutput *in, int int
        }
      }
    }
+  else if (strcmp_set && (strcmp(setoption,"datacache")==0)) /* set datacache */
+   {
+    double tempdbl = command[PARSE_set_datacache_datacache].real;
+    if (!gsl_finite(tempdbl)) { ppl_error(&c->errcontext, ERR_NUMERICAL, -1, -1, "The value supplied to the 'set datacache' command was not finite."); return; }
+    if ((tempdbl < 0.0) || (tempdbl > 1048576.0)) { ppl_error(&c->errcontext, ERR_GENERIC, -1, -1, "The size of the data cache must be in the range 0 to 1048576 megabytes."); return; }
+    c->set->term_current.datacache = (int)round(tempdbl);
+    ppldata_cacheTrim(((long)c->set->term_current.datacache) << 20);
+   }
+  else if (strcmp_unset && (strcmp(setoption,"datacache")==0)) /* unset datacache */
+   {
+    c->set->term_current.datacache = c->set->term_default.datacache;
+    ppldata_cacheTrim(((long)c->set->term_current.datacache) << 20);
+   }
   else if (strcmp_set && (strcmp(setoption,"display")==0)) /* set display */
    {
     c->set->term_current.display = SW_ONOFF_ON;
@@ -1693,6 +1707,24 @@ void ppl_directive_set(ppl_context *c, parserLine *pl, parserOutput *in, int int
          { if (!m) { tics_rm(&a->tics); IDE tics_cp(&a->tics,&ad->tics); } tics_rm(&a->ticsM); IDE tics_cp(&a->ticsM,&ad->ticsM); } }
      }
    }
+  else if (strcmp_set && (strcmp(setoption,"threads")==0)) /* set threads */
+   {
+    if (command[PARSE_set_threads_threads].objType==PPLOBJ_NUM)
+     {
+      double tempdbl = command[PARSE_set_threads_threads].real;
+      if (!gsl_finite(tempdbl)) { ppl_error(&c->errcontext, ERR_NUMERICAL, -1, -1, "The value supplied to the 'set threads' command was not finite."); return; }
+      if ((tempdbl < 1.0) || (tempdbl > 256.0)) { ppl_error(&c->errcontext, ERR_GENERIC, -1, -1, "The number of threads must be in the range 1 to 256."); return; }
+      c->set->term_current.threads = (int)round(tempdbl);
+     }
+    else
+     {
+      c->set->term_current.threads = 0; // set threads auto -- use one thread per processor
+     }
+   }
+  else if (strcmp_unset && (strcmp(setoption,"threads")==0)) /* unset threads */
+   {
+    c->set->term_current.threads = c->set->term_default.threads;
+   }
   else if (strcmp_set && (strcmp(setoption,"timezone")==0)) /* set timezone */
    {
     char *tempstr = (char *)command[PARSE_set_timezone_timezone].auxil;
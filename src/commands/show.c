@@ -32,6 +32,8 @@
 #include "coreUtils/memAlloc.h"
 #include "coreUtils/list.h"
 
+#include "epsMaker/dvi_font.h"
+
 #include "expressions/traceback_fns.h"
 
 #include "parser/cmdList.h"
@@ -56,6 +58,7 @@
 #include "userspace/unitsDisp.h"
 
 #include "canvasItems.h"
+#include "datafile_cache.h"
 #include "pplConstants.h"
 
 
@@ -431,6 +434,16 @@ int showMinor = 0;
       i += strlen(out+i) ; p=1;
      }
    }
+  if ((ppl_strAutocomplete(word, "settings", 1)>=0) || (ppl_strAutocomplete(word, "datacache", 1)>=0))
+   {
+    int  Nentries;
+    long bytes, hits, misses;
+    ppldata_cacheStats(&Nentries, &bytes, &hits, &misses);
+    sprintf(buf, "%d", c->set->term_current.datacache);
+    sprintf(buf2, "The memory, in megabytes, used to cache data read from datafiles. The cache currently holds %d table%s in %.1f MB, and has served %ld of %ld requests", Nentries, (Nentries==1)?"":"s", bytes/1048576.0, hits, hits+misses);
+    ppl_directive_show3(c, out+i, itemSet, 0, interactive, "datacache", buf, (c->set->term_default.datacache == c->set->term_current.datacache), buf2);
+    i += strlen(out+i) ; p=1;
+   }
   if ((ppl_strAutocomplete(word, "settings", 1)>=0) || (ppl_strAutocomplete(word, "display", 1)>=0))
    {
     sprintf(buf, "%s", *(char **)ppl_fetchSettingName(&c->errcontext, c->set->term_current.display, SW_ONOFF_INT, SW_ONOFF_STR , sizeof(char *)));
@@ -742,6 +755,13 @@ int showMinor = 0;
     ppl_directive_show3(c, out+i, itemSet, 1, interactive, "textVAlign", buf, (c->set->graph_default.TextVAlign==sg->TextVAlign), "Selects the vertical alignment of text labels");
     i += strlen(out+i) ; p=1;
    }
+  if ((ppl_strAutocomplete(word, "settings", 1)>=0) || (ppl_strAutocomplete(word, "threads",1)>=0))
+   {
+    if (c->set->term_current.threads<=0) sprintf(buf, "auto");
+    else                                 sprintf(buf, "%d", c->set->term_current.threads);
+    ppl_directive_show3(c, out+i, itemSet, 1, interactive, "threads", buf, (c->set->term_default.threads==c->set->term_current.threads), "The number of threads used to sample grids and render color maps");
+    i += strlen(out+i) ; p=1;
+   }
   if ((ppl_strAutocomplete(word, "settings", 1)>=0) || (ppl_strAutocomplete(word, "timezone",1)>=0))
    {
     ppl_strEscapify(c->set->term_current.timezone, buf);
@@ -1138,6 +1158,24 @@ int showMinor = 0;
    }
 
 
+  // Show counts of lines executed, and of the output stacks allocated to execute them, and the hit rates of the font cache
+  if (ppl_strAutocomplete(word, "execstats", 5)>=0)
+   {
+    const long Nlines  = c->execLines;
+    const long Nallocs = c->execFrameAllocs;
+    int  Nfonts;
+    long fontHits, fontMisses, pfaHits, pfaMisses;
+    dviFontCacheStats(&Nfonts, &fontHits, &fontMisses, &pfaHits, &pfaMisses);
+    SHOW_HIGHLIGHT(1);
+    sprintf(out+i, "\n# Interpreter statistics:\n\n"); i += strlen(out+i); p=1;
+    SHOW_DEHIGHLIGHT;
+    sprintf(out+i, "Lines executed:          %ld\n", Nlines); i += strlen(out+i);
+    sprintf(out+i, "Output stacks allocated: %ld (%.3f per line executed)\n", Nallocs, (Nlines>0) ? ((double)Nallocs)/Nlines : 0.0); i += strlen(out+i);
+    sprintf(out+i, "Fonts cached:            %d\n", Nfonts); i += strlen(out+i);
+    sprintf(out+i, "Font metrics loaded:     %ld of %ld times from cache\n", fontHits, fontHits+fontMisses); i += strlen(out+i);
+    sprintf(out+i, "Font files embedded:     %ld of %ld times from cache\n", pfaHits, pfaHits+pfaMisses); i += strlen(out+i);
+   }
+
   // Show variables
   if ((ppl_strAutocomplete(word, "variables", 1)>=0) || (ppl_strAutocomplete(word, "vars", 1)>=0) || (ppl_strAutocomplete(word, "uservariables", 1)>=0) || (ppl_strAutocomplete(word, "uservars", 1)>=0))
    {
@@ -47,13 +47,38 @@
 #include "userspace/unitsDisp.h"
 
 #include "datafile.h"
+#include "datafile_binary.h"
+
+// Write the units of a column of data into <out>, in the form used in '# ColumnUnits:' lines, and set <multiplier>
+// to the factor by which values in the column should be multiplied to be expressed in those units
+static void ppl_tab_unitString(ppl_context *c, pplObj *first, double *multiplier, char *out)
+ {
+  char  *cptr;
+  double tmpdbl;
+  int    i, j=0;
+  if (first->dimensionless)
+   {
+    strcpy(out, "1"); // This column contains dimensionless data
+    *multiplier = 1.0;
+    return;
+   }
+  first->real = 1.0;
+  first->imag = 0.0;
+  first->flagComplex = 0;
+  cptr = ppl_printUnit(c, first, multiplier, &tmpdbl, 0, 1, SW_DISPLAY_T);
+  for (i=0; ((cptr[i]!='\0')&&(cptr[i]!='(')); i++);
+  i++; // Fastforward over opening bracket
+  for (   ; ((cptr[i]!='\0')&&(cptr[i]!=')')); i++) out[j++] = cptr[i];
+  out[j] = '\0';
+  return;
+ }
 
 // Display data from a data block
 static int ppl_tab_dataGridDisplay(ppl_context *c, FILE *output, dataTable *data, int *minSet, double *min, int *maxSet, double *max, pplObj *unit, char *format)
  {
   dataBlock *blk;
-  char      *cptr, tmpchr='\0';
-  double     tmpdbl, multiplier[USING_ITEMS_MAX];
+  char       tmpchr='\0';
+  double     multiplier[USING_ITEMS_MAX];
   int        inRange, split, allInts[USING_ITEMS_MAX], allSmall[USING_ITEMS_MAX];
   long       i,k;
   int        j,l,pos;
@@ -71,22 +96,8 @@ static int ppl_tab_dataGridDisplay(ppl_context *c, FILE *output, dataTable *data
   fprintf(output, "# ColumnUnits: ");
   for (j=0; j<Ncolumns; j++)
    {
-    if (data->firstEntries[j].dimensionless)
-     {
-      fprintf(output, "1 "); // This column contains dimensionless data
-      multiplier[j] = 1.0;
-     }
-    else
-     {
-      data->firstEntries[j].real = 1.0;
-      data->firstEntries[j].imag = 0.0;
-      data->firstEntries[j].flagComplex = 0;
-      cptr = ppl_printUnit(c, data->firstEntries+j, multiplier+j, &tmpdbl, 0, 1, SW_DISPLAY_T);
-      for (i=0; ((cptr[i]!='\0')&&(cptr[i]!='(')); i++);
-      i++; // Fastforward over opening bracket
-      for (   ; ((cptr[i]!='\0')&&(cptr[i]!=')')); i++) fprintf(output, "%c", cptr[i]);
-      fprintf(output, " ");
-     }
+    ppl_tab_unitString(c, data->firstEntries+j, multiplier+j, c->errcontext.tempErrStr);
+    fprintf(output, "%s ", c->errcontext.tempErrStr);
    }
   fprintf(output, "\n");
 
@@ -201,6 +212,74 @@ static int ppl_tab_dataGridDisplay(ppl_context *c, FILE *output, dataTable *data
   return 0;
  }
 
+// Write data from a data block as a table in a binary datafile
+static int ppl_tab_dataGridBinary(ppl_context *c, FILE *output, dataTable *data, char **names, int Nnames, int *minSet, double *min, int *maxSet, double *max, pplObj *unit)
+ {
+  dataBlock *blk;
+  char      *colNames[USING_ITEMS_MAX], *colUnits[USING_ITEMS_MAX];
+  double     multiplier[USING_ITEMS_MAX];
+  int        inRange, split, fail=0;
+  long       i, k, Nrows=0;
+  int        j;
+  const int  Ncolumns = data->Ncolumns_real;
+
+  // Check that the firstEntries above have the same units as any supplied ranges
+  for (j=0; j<Ncolumns; j++)
+   if (minSet[j]||maxSet[j])
+    {
+     if (!ppl_unitsDimEqual(&unit[j],data->firstEntries+j)) { sprintf(c->errcontext.tempErrStr, "The minimum and maximum limits specified in range %d in the tabulate command have conflicting physical dimensions with the data returned from the data file. The limits have units of <%s>, whilst the data have units of <%s>.", j+1, ppl_printUnit(c,&unit[j],NULL,NULL,0,1,0), ppl_printUnit(c,data->firstEntries+j,NULL,NULL,1,1,0)); ppl_error(&c->errcontext,ERR_NUMERICAL,-1,-1,NULL); return 1; }
+    }
+
+  // Work out column names and units
+  for (j=0; j<Ncolumns; j++)
+   {
+    colNames[j] = (j<Nnames) ? names[j] : NULL;
+    ppl_tab_unitString(c, data->firstEntries+j, multiplier+j, c->errcontext.tempErrStr);
+    colUnits[j] = (char *)ppl_memAlloc(strlen(c->errcontext.tempErrStr)+1);
+    if (colUnits[j]==NULL) { ppl_error(&c->errcontext,ERR_MEMORY,-1,-1,"Out of memory."); return 1; }
+    strcpy(colUnits[j], c->errcontext.tempErrStr);
+   }
+
+#define TAB_IN_RANGE \
+  inRange=1; \
+  for (k=0; k<Ncolumns; k++) \
+   { \
+    double val = blk->data_real[k + Ncolumns*i]; \
+    if ( (minSet[k]&&(val<min[k])) || (maxSet[k]&&(val>max[k])) ) { inRange=0; break; } /* Check that value is within range */ \
+   }
+
+  // Count rows within range
+  for (blk=data->first; blk!=NULL; blk=blk->next)
+   for (i=0; i<blk->blockPosition; i++)
+    {
+     TAB_IN_RANGE;
+     if (inRange) Nrows++;
+    }
+
+  // Write data column by column, followed by a flag for each row indicating whether there is a discontinuity before it
+  fail |= ppldata_binaryWriteTable(output, Ncolumns, Nrows, colNames, colUnits);
+  for (j=0; j<Ncolumns; j++)
+   for (blk=data->first; blk!=NULL; blk=blk->next)
+    for (i=0; i<blk->blockPosition; i++)
+     {
+      TAB_IN_RANGE;
+      if (inRange) fail |= ppldata_binaryWriteDouble(output, blk->data_real[j + Ncolumns*i] * multiplier[j]);
+     }
+  split = 0;
+  for (blk=data->first; blk!=NULL; blk=blk->next)
+   for (i=0; i<blk->blockPosition; i++)
+    {
+     if (blk->split[i]) split=1;
+     TAB_IN_RANGE;
+     if (inRange) { fail |= ppldata_binaryWriteFlag(output, split); split=0; }
+     else         { split=1; }
+    }
+  fail |= ppldata_binaryWritePad(output);
+
+  if (fail) { ppl_error(&c->errcontext,ERR_FILE,-1,-1,"Error whilst writing binary datafile."); return 1; }
+  return 0;
+ }
+
 #define TBADD2(et,pos) ppl_tbAdd(c,pl->srcLineN,pl->srcId,pl->srcFname,0,et,pos,pl->linetxt,"")
 
 void ppl_directive_tabulate(ppl_context *c, parserLine *pl, parserOutput *in, int interactive, int iterDepth)
@@ -212,6 +291,7 @@ void ppl_directive_tabulate(ppl_context *c, parserLine *pl, parserOutput *in, in
   long        j;
   char       *filename, filenameTemp[FNAME_LENGTH];
   parserLine *spool=NULL, **dataSpool = &spool;
+  int         binary=0;
   pplObj      unit  [USING_ITEMS_MAX];
   int         minSet[USING_ITEMS_MAX], maxSet[USING_ITEMS_MAX];
   double      min   [USING_ITEMS_MAX], max   [USING_ITEMS_MAX];
@@ -261,9 +341,33 @@ void ppl_directive_tabulate(ppl_context *c, parserLine *pl, parserOutput *in, in
     }
   }
 
+  // Work out whether output is to be a binary datafile. This applies to the whole file, so cannot be mixed with text.
+  pos = PARSE_tabulate_0tabulate_list;
+  while (stk[pos].objType == PPLOBJ_NUM)
+   {
+    pos = (int)round(stk[pos].real);
+    if (pos<=0) break;
+    if (stk[pos+PARSE_tabulate_binary_0tabulate_list].objType==PPLOBJ_STR) binary=1;
+   }
+  if (binary)
+   {
+    pos = PARSE_tabulate_0tabulate_list;
+    while (stk[pos].objType == PPLOBJ_NUM)
+     {
+      pos = (int)round(stk[pos].real);
+      if (pos<=0) break;
+      if (stk[pos+PARSE_tabulate_format_0tabulate_list].objType==PPLOBJ_STR)
+       {
+        sprintf(c->errStat.errBuff,"Binary output cannot be mixed with text format strings in a single tabulate command.");
+        TBADD2(ERR_SYNTAX,in->stkCharPos[pos+PARSE_tabulate_format_0tabulate_list]);
+        return;
+       }
+     }
+   }
+
   // Work out filename for output file
   filename = c->set->term_current.output;
-  if ((filename==NULL)||(filename[0]=='\0')) filename = "pyxplot.txt";
+  if ((filename==NULL)||(filename[0]=='\0')) filename = binary ? "pyxplot.bin" : "pyxplot.txt";
 
   // Perform expansion of shell filename shortcuts such as ~
   if ((wordexp(filename, &wordExp, 0) != 0) || (wordExp.we_wordc <= 0)) { sprintf(c->errcontext.tempErrStr, "Could not find directory containing filename '%s'.", filename); ppl_error(&c->errcontext,ERR_FILE,-1,-1,NULL); return; }
@@ -275,22 +379,43 @@ void ppl_directive_tabulate(ppl_context *c, parserLine *pl, parserOutput *in, in
 
   // Open output file and write header at the top of it
   ppl_createBackupIfRequired(c,filename);
-  output = fopen(filename,"w");
+  output = fopen(filename, binary ? "wb" : "w");
   if (output==NULL) { sprintf(c->errcontext.tempErrStr, "The tabulate command could not open output file '%s' for writing.", filename); ppl_error(&c->errcontext,ERR_FILE,-1,-1,NULL); return; }
-  fprintf(output, "# Datafile generated by Pyxplot %s\n# Timestamp: %s\n", VERSION, ppl_strStrip(ppl_friendlyTimestring(),c->errcontext.tempErrStr));
-  fprintf(output, "# User: %s\n# Pyxplot command: %s\n\n", ppl_unixGetIRLName(&c->errcontext), pl->linetxt);
+  if (binary)
+   {
+    ppldata_binaryWriteMagic(output);
+   }
+  else
+   {
+    fprintf(output, "# Datafile generated by Pyxplot %s\n# Timestamp: %s\n", VERSION, ppl_strStrip(ppl_friendlyTimestring(),c->errcontext.tempErrStr));
+    fprintf(output, "# User: %s\n# Pyxplot command: %s\n\n", ppl_unixGetIRLName(&c->errcontext), pl->linetxt);
+   }
 
   // Loop over datasets being tabulated
   pos = PARSE_tabulate_0tabulate_list;
   j   = 1;
   while (stk[pos].objType == PPLOBJ_NUM)
    {
-    char      *format, datafname[FNAME_LENGTH]="";
-    int        w, errCount=5;
+    char      *format, datafname[FNAME_LENGTH]="", *names[USING_ITEMS_MAX];
+    int        w, errCount=5, Nnames=0;
     dataTable *data=NULL;
     pos = (int)round(stk[pos].real);
     if (pos<=0) break;
-    fprintf(output, "\n\n\n# Index %ld\n", j); // Put a heading at the top of the new data index
+    if (!binary) fprintf(output, "\n\n\n# Index %ld\n", j); // Put a heading at the top of the new data index
+
+    // Binary datafiles name each column after the using expression which produced it
+    if (binary)
+     {
+      int upos = pos + PARSE_tabulate_using_list_0tabulate_list;
+      while ((stk[upos].objType == PPLOBJ_NUM) && (Nnames<USING_ITEMS_MAX))
+       {
+        pplObj *item;
+        upos = (int)round(stk[upos].real);
+        if (upos<=0) break;
+        item = &stk[upos+PARSE_tabulate_using_item_using_list_0tabulate_list];
+        names[Nnames++] = (item->objType==PPLOBJ_EXP) ? ((pplExpr *)item->auxil)->ascii : NULL;
+       }
+     }
 
     // Read display format
     if (stk[pos+PARSE_tabulate_format_0tabulate_list].objType==PPLOBJ_STR) format=(char *)stk[pos+PARSE_tabulate_format_0tabulate_list].auxil;
@@ -312,6 +437,11 @@ void ppl_directive_tabulate(ppl_context *c, parserLine *pl, parserOutput *in, in
         ppl_memAlloc_AscendOutOfContext(contextLocal);
         break;
        }
+      else if (binary)
+       {
+        if (w>0) j++;
+        ppl_tab_dataGridBinary(c, output, data, names, Nnames, minSet, min, maxSet, max, unit);
+       }
       else
        {
         if (datafname[0]!='\0')
@@ -33,6 +33,17 @@
 
 void _ppl_dictRemoveEngine(dict *in, dictItem *ptr);
 
+// Generation stamps are drawn from a single process-wide counter, so that a
+// dict freed and reallocated at the same address never repeats a stamp. The
+// expression evaluator uses these to validate its cached variable lookups.
+static long ppl_dictGenerationCounter = 0;
+#define DICT_TOUCH(X) (X)->generation = __sync_add_and_fetch(&ppl_dictGenerationCounter,1)
+
+// Items are kept in a linked list, which is sorted alphabetically (case
+// insensitively) the next time the dictionary is iterated over. Key lookups
+// go through an open-addressed hash table, which is kept at most half full.
+#define DICT_HASH_INITSIZE 8
+
 dict *ppl_dictInit(int useMalloc)
  {
   dict *out;
@@ -44,18 +55,21 @@ dict *ppl_dictInit(int useMalloc)
   out->length    = 0;
   out->refCount  = 1;
   out->immutable = 0;
-  out->hashTree  = NULL;
+  out->sorted    = 1;
+  out->hashTable = NULL;
+  out->hashSize  = 0;
   out->useMalloc = useMalloc;
   out->memory_context = ppl_memAlloc_GetMemContext();
+  DICT_TOUCH(out);
   return out;
  }
 
-void ppl_dictFreeTree(dictHash *i)
+void ppl_dictFreeTable(dict *in)
  {
-  if (i==NULL) return;
-  ppl_dictFreeTree(i->next);
-  ppl_dictFreeTree(i->prev);
-  free(i);
+  if ((in==NULL)||(!in->useMalloc)) return;
+  if (in->hashTable!=NULL) free(in->hashTable);
+  in->hashTable = NULL;
+  in->hashSize  = 0;
   return;
  }
 
@@ -72,7 +86,7 @@ int ppl_dictFree(dict *in)
     free(ptr);
     ptr = ptrnext;
    }
-  ppl_dictFreeTree(in->hashTree);
+  ppl_dictFreeTable(in);
   free(in);
   return 0;
  }
@@ -88,83 +102,64 @@ int ppl_dictHash(const char *str, const int strLen)
 
 #define alloc(X) ( in->useMalloc ? malloc(X) : ppl_memAlloc_incontext(X, in->memory_context) )
 
-static void ppl_dictHashAdd(dict *in, const char *str, const int hash, dictItem *item)
+// Rebuild the hash table with newSize slots, from the list of items
+static int ppl_dictHashResize(dict *in, int newSize)
  {
-  dictHash **ptr = &in->hashTree;
-
-  while ((*ptr)!=NULL)
+  dictItem **table, *ptr;
+  const unsigned int mask = newSize-1;
+  table = (dictItem **)alloc(newSize * sizeof(dictItem *));
+  if (table==NULL) return 1;
+  memset(table, 0, newSize * sizeof(dictItem *));
+  for (ptr=in->first; ptr!=NULL; ptr=ptr->next)
    {
-    if      ((*ptr)->hash < hash) ptr = &((*ptr)->prev);
-    else if ((*ptr)->hash > hash) ptr = &((*ptr)->next);
-    else
-     {
-      if (strcmp((*ptr)->item->key , str)==0) { (*ptr)->item=item; return; } // Overwriting a pre-existing item
-      else return; // Genuine clash. Nothing we can do.
-     }
+    unsigned int i = ((unsigned int)ptr->hash) & mask;
+    while (table[i]!=NULL) i=(i+1)&mask;
+    table[i] = ptr;
    }
-
-  *ptr = alloc(sizeof(dictHash));
-  if (*ptr==NULL) return;
-  (*ptr)->hash = hash;
-  (*ptr)->item = item;
-  (*ptr)->prev = NULL;
-  (*ptr)->next = NULL;
+  if ((in->useMalloc)&&(in->hashTable!=NULL)) free(in->hashTable);
+  in->hashTable = table;
+  in->hashSize  = newSize;
+  return 0;
  }
 
-static dictItem *ppl_dictHashLookup(dict *in, const char *str, int slen, const int hash, int *clash)
+// Find the item with key str. If slen>=0, only the first slen characters of str are the key.
+static dictItem *ppl_dictHashLookup(dict *in, const char *str, int slen, const int hash)
  {
-  dictHash **ptr = &in->hashTree;
+  unsigned int i, mask;
+  dictItem *ptr;
 
-  if (str==NULL) return NULL; 
-  if (slen<=0) slen=strlen(str);
-  *clash=0;
-  while ((*ptr)!=NULL)
+  if ((str==NULL)||(in->hashTable==NULL)) return NULL;
+  mask = in->hashSize-1;
+  for (i=((unsigned int)hash)&mask; (ptr=in->hashTable[i])!=NULL; i=(i+1)&mask)
    {
-    if      ((*ptr)->hash < hash) ptr = &((*ptr)->prev);
-    else if ((*ptr)->hash > hash) ptr = &((*ptr)->next);
-    else 
-     {
-      if (strncmp((*ptr)->item->key , str , slen)==0) return (*ptr)->item; // Found it
-      *clash=1;
-      return NULL;
-     }
+    if (ptr->hash!=hash) continue;
+    if (slen<0) { if (strcmp(ptr->key, str)==0) return ptr; }
+    else        { if ((strncmp(ptr->key, str, slen)==0)&&(ptr->key[slen]=='\0')) return ptr; }
    }
   return NULL;
  }
 
-static dictItem *ppl_dictHashRemove(dict *in, const char *str, const int hash, int *clash)
+// Remove an item from the hash table, shifting back any items further along its probe sequence
+static void ppl_dictHashRemove(dict *in, dictItem *item)
  {
-  dictHash **ptr = &in->hashTree;
-
-  if (str==NULL) return NULL; 
-  *clash=0;
-  while ((*ptr)!=NULL)
+  unsigned int i, j, k, mask;
+
+  if (in->hashTable==NULL) return;
+  mask = in->hashSize-1;
+  for (i=((unsigned int)item->hash)&mask; in->hashTable[i]!=item; i=(i+1)&mask)
+   if (in->hashTable[i]==NULL) return;
+  in->hashTable[i] = NULL;
+  for (j=(i+1)&mask; in->hashTable[j]!=NULL; j=(j+1)&mask)
    {
-    if      ((*ptr)->hash < hash) ptr = &((*ptr)->prev);
-    else if ((*ptr)->hash > hash) ptr = &((*ptr)->next);
-    else
+    k = ((unsigned int)in->hashTable[j]->hash)&mask; // Slot which this item would ideally occupy
+    if ( (i<j) ? ((k<=i)||(k>j)) : ((k<=i)&&(k>j)) )
      {
-      if (strcmp((*ptr)->item->key , str)==0) // Found it
-       {
-        dictHash  *old = *ptr;
-        dictHash **near=  ptr, *nearEntry;
-        dictItem  *out = (*ptr)->item;
-        if (old->prev==NULL) { *ptr=old->next; if (in->useMalloc) free(old); return out; }
-        if (old->next==NULL) { *ptr=old->prev; if (in->useMalloc) free(old); return out; }
-        if (hash & 1)        { while ((*near)->prev!=NULL) near=&((*near)->prev); nearEntry=*near; *near=(*near)->next; }
-        else                 { while ((*near)->next!=NULL) near=&((*near)->next); nearEntry=*near; *near=(*near)->prev; }
-        *ptr=nearEntry;
-        if (in->useMalloc) free(old);
-        return out;
-       }
-      else
-       {
-        *clash=1;
-        return NULL; // Genuine clash. Nothing we can do.
-       }
+      in->hashTable[i] = in->hashTable[j];
+      in->hashTable[j] = NULL;
+      i = j;
      }
    }
-  return NULL;
+  return;
  }
 
 int ppl_dictLen(dict *in)
@@ -173,85 +168,81 @@ int ppl_dictLen(dict *in)
   return in->length;
  }
 
+// Append a new key to the end of the list, and add it to the hash table
+static dictItem *ppl_dictAddItem(dict *in, const char *key, int hash, void *data)
+ {
+  dictItem     *ptrnew;
+  unsigned int  i, mask;
+
+  if (2*(in->length+1) > in->hashSize)
+   if (ppl_dictHashResize(in, (in->hashSize>0) ? 2*in->hashSize : DICT_HASH_INITSIZE))
+    if (in->length+1 >= in->hashSize)
+     return NULL; // Could not grow hash table, and it is full
+
+  ptrnew           = (dictItem *)alloc(sizeof(dictItem));
+  if (ptrnew==NULL) return NULL;
+  ptrnew->key      = (char *)alloc((strlen(key)+1));
+  if (ptrnew->key==NULL) { if (in->useMalloc) free(ptrnew); return NULL; }
+  strcpy(ptrnew->key, key);
+  ptrnew->data     = data;
+  ptrnew->hash     = hash;
+  ptrnew->prev     = in->last;
+  ptrnew->next     = NULL;
+  if ((in->last!=NULL)&&(ppl_strCmpNoCase(in->last->key, key)>0)) in->sorted=0;
+  if (in->last==NULL) in->first = ptrnew; else in->last->next = ptrnew;
+  in->last = ptrnew;
+  in->length++;
+
+  mask = in->hashSize-1;
+  for (i=((unsigned int)hash)&mask; in->hashTable[i]!=NULL; i=(i+1)&mask);
+  in->hashTable[i] = ptrnew;
+  DICT_TOUCH(in);
+  return ptrnew;
+ }
+
 int ppl_dictAppend(dict *in, const char *key, void *item)
  {
-  dictItem *ptr=NULL, *ptrnew=NULL, *prev=NULL;
-  int       cmp = -1, hash;
+  dictItem *ptr;
+  int       hash;
 
   if (key==NULL) return 1;
-  ptr = in->first;
-  while (ptr != NULL)
-   {
-    if ( ((cmp = ppl_strCmpNoCase(ptr->key, key)) > 0) || ((cmp = strcmp(ptr->key, key)) == 0) ) break;
-    prev = ptr;
-    ptr  = ptr->next;
-   }
-  if (cmp == 0) // Overwrite an existing entry in dictionary
+  hash = ppl_dictHash(key, -1);
+  ptr  = ppl_dictHashLookup(in, key, -1, hash);
+  if (ptr!=NULL) // Overwrite an existing entry in dictionary
    {
     if (in->useMalloc) free(ptr->data);
     ptr->data = item;
+    DICT_TOUCH(in);
    }
   else
    {
-    ptrnew           = (dictItem *)alloc(sizeof(dictItem));
-    if (ptrnew==NULL) return 1;
-    ptrnew->prev     = prev;
-    ptrnew->next     = ptr;
-    ptrnew->key      = (char *)alloc((strlen(key)+1));
-    if (ptrnew->key==NULL) { if (in->useMalloc) free(ptrnew); return 1; }
-    strcpy(ptrnew->key, key);
-    ptrnew->data     = item;
-    if (prev == NULL) in->first = ptrnew; else prev->next = ptrnew;
-    if (ptr  == NULL) in->last  = ptrnew; else ptr ->prev = ptrnew;
-    in->length++;
-
-    hash = ppl_dictHash(key, -1);
-    ppl_dictHashAdd(in, key, hash, ptrnew);
+    if (ppl_dictAddItem(in, key, hash, item)==NULL) return 1;
    }
   return 0;
  }
 
 int ppl_dictAppendCpy(dict *in, const char *key, void *item, int size)
  {
-  dictItem *ptr=NULL, *ptrnew=NULL, *prev=NULL;
+  dictItem *ptr;
   void     *cpy;
-  int       cmp = -1, hash;
+  int       hash;
 
   if (key==NULL) return 1;
   cpy = alloc(size);
   if (cpy==NULL) return 1;
   memcpy(cpy, item, size);
 
-  ptr = in->first;
-  while (ptr != NULL)
-   {
-    if ( ((cmp = ppl_strCmpNoCase(ptr->key, key)) > 0) || ((cmp = strcmp(ptr->key, key)) == 0) ) break;
-    prev = ptr;
-    ptr  = ptr->next;
-   }
-  if (cmp == 0) // Overwrite an existing entry in dictionary
+  hash = ppl_dictHash(key, -1);
+  ptr  = ppl_dictHashLookup(in, key, -1, hash);
+  if (ptr!=NULL) // Overwrite an existing entry in dictionary
    {
     if (in->useMalloc) free(ptr->data);
     ptr->data = cpy;
-    ptrnew = ptr;
+    DICT_TOUCH(in);
    }
   else
    {
-    ptrnew           = (dictItem *)alloc(sizeof(dictItem));
-    if (ptrnew==NULL) { if (in->useMalloc) free(cpy); return 1; }
-    ptrnew->prev     = prev;
-    ptrnew->next     = ptr;
-    ptrnew->key      = (char *)alloc((strlen(key)+1));
-    if (ptrnew->key==NULL) { if (in->useMalloc) { free(cpy); free(ptrnew); } return 1; }
-    strcpy(ptrnew->key, key);
-    ptrnew->data     = cpy;
-    memcpy(ptrnew->data, item, size);
-    if (prev == NULL) in->first = ptrnew; else prev->next = ptrnew;
-    if (ptr  == NULL) in->last  = ptrnew; else ptr ->prev = ptrnew;
-    in->length++;
-
-    hash = ppl_dictHash(key, -1);
-    ppl_dictHashAdd(in, key, hash, ptrnew);
+    if (ppl_dictAddItem(in, key, hash, cpy)==NULL) { if (in->useMalloc) free(cpy); return 1; }
    }
   return 0;
  }
@@ -266,34 +257,19 @@ void *ppl_dictLookup(dict *in, const char *key)
 
 void *ppl_dictLookupHash(dict *in, const char *key, int hash)
  {
-  int       clash;
   dictItem *ptr;
 
   if (key==NULL) return NULL;
   if (in==NULL) { return NULL; }
 
-  // Check hash table
-  ptr  = ppl_dictHashLookup(in, key, -1, hash, &clash);
-  if (!clash)
-   {
-    if (ptr==NULL) return NULL;
-    return ptr->data;
-   }
-
-  // Hash table clash; need to exhaustively search dictionary
-  ptr = in->first;
-  while (ptr != NULL)
-   {
-    if (strcmp(ptr->key, key) == 0) return ptr->data;
-    else if (ppl_strCmpNoCase(ptr->key, key) > 0) break;
-    ptr = ptr->next;
-   }
-  return NULL;
+  ptr = ppl_dictHashLookup(in, key, -1, hash);
+  if (ptr==NULL) return NULL;
+  return ptr->data;
  }
 
 void ppl_dictLookupWithWildcard(dict *in, char *key, char *SubsString, int SubsMaxLen, dictItem **ptrout)
  {
-  int       hash, clash, i, k, keylen;
+  int       hash, i, k, keylen;
   char     *magicFns[] = { "diff_d", "int_d" , NULL };
   dictItem *ptr;
 
@@ -305,18 +281,8 @@ void ppl_dictLookupWithWildcard(dict *in, char *key, char *SubsString, int SubsM
   for (k=0; (isalnum(key[k]) || (key[k]=='_')); k++);
   keylen=k;
   hash = ppl_dictHash(key, keylen);
-  ptr  = ppl_dictHashLookup(in, key, keylen, hash, &clash);
+  ptr  = ppl_dictHashLookup(in, key, keylen, hash);
   if (ptr!=NULL) { *ptrout=ptr; return; }
-  if (clash)
-   {
-    ptr = in->first;
-    while (ptr != NULL)
-     {
-      for (k=0; ((ptr->key[k]>' ')&&(ptr->key[k]==key[k])); k++);
-      if ((ptr->key[k]=='\0')&&(!(isalnum(key[k])||(key[k]=='_')))) { *ptrout=ptr; return; }
-      ptr = ptr->next;
-     }
-   }
 
   // Need to search "int_d?"-like wildcards
   for (i=0; magicFns[i]!=NULL; i++)
@@ -332,13 +298,8 @@ void ppl_dictLookupWithWildcard(dict *in, char *key, char *SubsString, int SubsM
       if (l==SubsMaxLen) continue; // Dummy variable name was too long
       if (l==0) continue; // Dummy variable was too short
       SubsString[l]='\0';
-      ptr = in->first;
-      while (ptr != NULL)
-       {
-        for (k=0; ((ptr->key[k]>' ')&&(ptr->key[k]==magicFns[i][k])); k++);
-        if ((magicFns[i][k]=='\0')&&(ptr->key[k]=='\0')) { *ptrout=ptr; return; }
-        ptr = ptr->next;
-       }
+      ptr = ppl_dictHashLookup(in, magicFns[i], -1, ppl_dictHash(magicFns[i], -1));
+      if (ptr!=NULL) { *ptrout=ptr; return; }
      }
    }
   SubsString[0]='\0';
@@ -348,49 +309,22 @@ void ppl_dictLookupWithWildcard(dict *in, char *key, char *SubsString, int SubsM
 
 int ppl_dictContains(dict *in, const char *key)
  {
-  int hash, clash;
-  dictItem *ptr;
   if (key==NULL) return 0;
   if (in==NULL) return 0;
-
-  // Check hash table
-  hash = ppl_dictHash(key, -1);
-  ptr  = ppl_dictHashLookup(in, key, -1, hash, &clash);
-  if (!clash) return (ptr!=NULL);
-
-  // Hash table clash; need to exhaustively search dictionary
-  ptr = in->first;
-  while (ptr != NULL)
-   {
-    if (strcmp(ptr->key, key)==0) return 1;
-    ptr = ptr->next;
-   }
-  return 0;
+  return (ppl_dictHashLookup(in, key, -1, ppl_dictHash(key, -1))!=NULL);
  }
 
 int ppl_dictRemoveKey(dict *in, const char *key)
  {
-  int hash, clash;
   dictItem *ptr;
 
   if (key==NULL) return 1;
   if (in==NULL) return 1;
 
-  // Check hash table
-  hash = ppl_dictHash(key, -1);
-  ptr  = ppl_dictHashRemove(in, key, hash, &clash);
+  ptr = ppl_dictHashLookup(in, key, -1, ppl_dictHash(key, -1));
   if (ptr==NULL) return 1;
-  if (!clash) { _ppl_dictRemoveEngine(in, ptr); return 0; }
-
-  // Hash table clash; need to exhaustively search dictionary
-  ptr = in->first;
-  while (ptr != NULL)
-   {
-    if (strcmp(ptr->key, key)==0) { _ppl_dictRemoveEngine(in, ptr); return 0; }
-    else if (ppl_strCmpNoCase(ptr->key, key) > 0) break;
-    ptr = ptr->next;
-   }
-  return 1;
+  _ppl_dictRemoveEngine(in, ptr);
+  return 0;
  }
 
 int ppl_dictRemove(dict *in, void *item)
@@ -400,7 +334,7 @@ int ppl_dictRemove(dict *in, void *item)
   ptr = in->first;
   while (ptr != NULL)
    {
-    if (ptr->data == item) { return ppl_dictRemoveKey(in,ptr->key); }
+    if (ptr->data == item) { _ppl_dictRemoveEngine(in, ptr); return 0; }
     ptr = ptr->next;
    }
   return 1;
@@ -411,6 +345,7 @@ void _ppl_dictRemoveEngine(dict *in, dictItem *ptr)
   if (in ==NULL) return;
   if (ptr==NULL) return;
 
+  ppl_dictHashRemove(in, ptr);
   if (in->useMalloc) { free(ptr->data); free(ptr->key); }
 
   if (ptr->next != NULL) ptr->next->prev = ptr->prev; // We are not the last item in the list
@@ -419,6 +354,7 @@ void _ppl_dictRemoveEngine(dict *in, dictItem *ptr)
   if (in->first == ptr) in->first = ptr->next;
   if (in->useMalloc) free(ptr);
   in->length--;
+  DICT_TOUCH(in);
 
   return;
  }
@@ -429,9 +365,49 @@ int ppl_dictRemoveAll(dict *in, void *item)
   return 0;
  }
 
+// Merge sort the list of items into alphabetical order. Items whose keys differ only in case retain their
+// order of insertion.
+static void ppl_dictSort(dict *in)
+ {
+  dictItem *list = in->first, *p, *q, *e, *tail;
+  int       insize = 1, nmerges, psize, qsize, i;
+
+  if (in->sorted) return;
+  while (1)
+   {
+    p = list; list = NULL; tail = NULL; nmerges = 0;
+    while (p!=NULL)
+     {
+      nmerges++;
+      q = p;
+      for (psize=0, i=0; i<insize; i++) { psize++; q=q->next; if (q==NULL) break; }
+      qsize = insize;
+      while ((psize>0) || ((qsize>0)&&(q!=NULL)))
+       {
+        if      (psize==0)                    { e=q; q=q->next; qsize--; }
+        else if ((qsize==0)||(q==NULL))       { e=p; p=p->next; psize--; }
+        else if (ppl_strCmpNoCase(p->key,q->key)<=0) { e=p; p=p->next; psize--; }
+        else                                  { e=q; q=q->next; qsize--; }
+        e->prev = tail;
+        if (tail!=NULL) tail->next = e; else list = e;
+        tail = e;
+       }
+      p = q;
+     }
+    if (tail!=NULL) tail->next = NULL;
+    if (nmerges<=1) break;
+    insize *= 2;
+   }
+  in->first  = list;
+  in->last   = tail;
+  in->sorted = 1;
+  return;
+ }
+
 dictIterator *ppl_dictIterateInit(dict *in)
  {
   if (in==NULL) return NULL;
+  ppl_dictSort(in);
   return in->first;
  }
 
@@ -24,17 +24,11 @@
 #ifndef _LT_DICT_H
 #define _LT_DICT_H 1
 
-typedef struct dictHashS
- {
-  int               hash;
-  struct dictItemS *item;
-  struct dictHashS *prev, *next;
- } dictHash;
-
 typedef struct dictItemS
  {
   char             *key;
   void             *data;
+  int               hash;
   struct dictItemS *next;
   struct dictItemS *prev;
  } dictItem;
@@ -45,17 +39,19 @@ typedef struct dictS
   struct dictItemS  *first;
   struct dictItemS  *last;
   int                length, refCount;
-  unsigned char      immutable;
-  struct dictHashS  *hashTree;
+  unsigned char      immutable, sorted;
+  struct dictItemS **hashTable; // Open-addressed hash table, linear probing; hashSize is a power of two
+  int                hashSize;
   int                useMalloc;
   int                memory_context;
+  long               generation; // Stamp changed whenever keys are added, removed or rebound; unique across all dicts
  } dict;
 
 typedef dictItem dictIterator;
 
 dict         *ppl_dictInit         (int useMalloc);
 int           ppl_dictHash         (const char *str, const int strLen);
-void          ppl_dictFreeTree     (dictHash *i);
+void          ppl_dictFreeTable    (dict *in);
 int           ppl_dictFree         (dict *in);
 int           ppl_dictLen          (dict *in);
 int           ppl_dictAppend       (dict *in, const char *key, void *item);
@@ -34,9 +34,11 @@
 
 static char temp_stringA[BLEN+1], temp_stringB[BLEN+1], temp_stringC[BLEN+1], temp_stringD[BLEN+1], temp_stringE[BLEN+1];
 
+static long sourceId=0;
+static long errorCount=0;
+
 void ppl_error_setstreaminfo(pplerr_context *context, int linenumber,char *filename)
  {
-  static long sourceId=0;
   context->error_input_sourceId   = sourceId++;
   context->error_input_linenumber = linenumber;
   if (filename != NULL)
@@ -47,11 +49,26 @@ void ppl_error_setstreaminfo(pplerr_context *context, int linenumber,char *filen
   return;
  }
 
+// Reserve N consecutive source ids for lines which were not read via ppl_error_setstreaminfo(), returning the first
+long ppl_error_reserveSourceIds(long N)
+ {
+  long first = sourceId;
+  sourceId += N;
+  return first;
+ }
+
+// The number of errors which have been reported so far
+long ppl_error_count()
+ {
+  return errorCount;
+ }
+
 void ppl_error(pplerr_context *context, int ErrType, int HighlightPos1, int HighlightPos2, char *msg)
  {
   unsigned char ApplyHighlighting, reverse=0;
   int i=0, j;
 
+  errorCount++;
   if (msg==NULL) msg=context->tempErrStr;
   ApplyHighlighting = ((context->session_default.color == SW_ONOFF_ON) && (isatty(STDERR_FILENO) == 1));
   if (msg!=temp_stringA) { snprintf(temp_stringA, BLEN, "%s", msg); temp_stringA[BLEN]='\0'; msg = temp_stringA; }
@@ -36,6 +36,8 @@ list *ppl_listInit(int useMalloc)
   if (out==NULL) return NULL;
   out->first     = NULL;
   out->last      = NULL;
+  out->items     = NULL;
+  out->itemsAlloc= 0;
   out->length    = 0;
   out->refCount  = 1;
   out->immutable = 0;
@@ -56,6 +58,7 @@ int ppl_listFree(list *in)
     free(ptr);
     ptr = ptrnext;
    }
+  if (in->items!=NULL) free(in->items);
   free(in);
   return 0;
  }
@@ -68,6 +71,24 @@ int ppl_listLen(list *in)
 
 #define alloc(X) ( in->useMalloc ? malloc(X) : ppl_memAlloc_incontext(X, in->memory_context) )
 
+// Make sure that the index of items has room for at least n entries. Its size is doubled as needed, so that
+// appending is O(1) in amortised time.
+static int ppl_listIndexGrow(list *in, int n)
+ {
+  listItem **new;
+  int        newAlloc;
+  if (n <= in->itemsAlloc) return 0;
+  newAlloc = (in->itemsAlloc>0) ? in->itemsAlloc : 8;
+  while (newAlloc < n) newAlloc*=2;
+  new = (listItem **)alloc(newAlloc * sizeof(listItem *));
+  if (new==NULL) return 1;
+  if (in->length>0) memcpy(new, in->items, in->length * sizeof(listItem *));
+  if ((in->useMalloc)&&(in->items!=NULL)) free(in->items);
+  in->items      = new;
+  in->itemsAlloc = newAlloc;
+  return 0;
+ }
+
 list *ppl_listCpy(list *in, int useMalloc, int itemSize)
  {
   listItem *i;
@@ -76,7 +97,7 @@ list *ppl_listCpy(list *in, int useMalloc, int itemSize)
   out = ppl_listInit(useMalloc);
   if (out==NULL) return NULL;
   i = in->first;
-  while (i!=NULL) { ppl_listAppendCpy(in, i->data, itemSize); i=i->next; }
+  while (i!=NULL) { ppl_listAppendCpy(out, i->data, itemSize); i=i->next; }
   return out;
  }
 
@@ -84,6 +105,7 @@ int ppl_listAppend(list *in, void *item)
  {
   listItem *ptrnew;
   if (in==NULL) return 1;
+  if (ppl_listIndexGrow(in, in->length+1)) return 1;
   ptrnew           = (listItem *)alloc(sizeof(listItem));
   if (ptrnew==NULL) return 1;
   ptrnew->prev     = in->last;
@@ -92,7 +114,7 @@ int ppl_listAppend(list *in, void *item)
   if (in->first == NULL) in->first = ptrnew;
   if (in->last  != NULL) in->last->next = ptrnew;
   in->last = ptrnew;
-  in->length++;
+  in->items[in->length++] = ptrnew;
   return 0;
  }
 
@@ -100,6 +122,7 @@ int ppl_listAppendCpy(list *in, void *item, int size)
  {
   listItem *ptrnew;
   if (in==NULL) return 1;
+  if (ppl_listIndexGrow(in, in->length+1)) return 1;
   ptrnew         = (listItem *)alloc(sizeof(listItem));
   if (ptrnew==NULL) return 1;
   ptrnew->prev   = in->last;
@@ -110,35 +133,41 @@ int ppl_listAppendCpy(list *in, void *item, int size)
   if (in->first == NULL) in->first = ptrnew;
   if (in->last  != NULL) in->last->next = ptrnew;
   in->last = ptrnew;
-  in->length++;
+  in->items[in->length++] = ptrnew;
   return 0;
  }
 
 int ppl_listInsertCpy(list *in, int N, void *item, int size)
  {
-  int i;
-  listItem **ptr, *ptrnew;
+  listItem *ptrnew, *next;
   if (in==NULL) return 1;
+  if (N<0) N=0;
+  if (N>=in->length) return ppl_listAppendCpy(in, item, size);
+  if (ppl_listIndexGrow(in, in->length+1)) return 1;
   ptrnew = (listItem *)alloc(sizeof(listItem));
   if (ptrnew==NULL) return 1;
   ptrnew->data   = alloc(size);
   if (ptrnew->data==NULL) { if (in->useMalloc) free(ptrnew); return 1; }
   memcpy(ptrnew->data, item, size);
-  ptr = &in->first;
-  for (i=0; ((i<N) && (*ptr!=NULL)); i++, ptr=&(*ptr)->next);
-  ptrnew->prev = (*ptr==NULL) ? in->last : (*ptr)->prev;
-  ptrnew->next = *ptr;
-  if (*ptr!=NULL) (*ptr)->prev = ptrnew;
-  *ptr         = ptrnew;
+  next         = in->items[N];
+  ptrnew->prev = next->prev;
+  ptrnew->next = next;
+  if (next->prev!=NULL) next->prev->next = ptrnew; else in->first = ptrnew;
+  next->prev   = ptrnew;
+  memmove(in->items+N+1, in->items+N, (in->length-N) * sizeof(listItem *));
+  in->items[N] = ptrnew;
   in->length++;
   return 0;
  }
 
-static void ppl_listRemoveEngine(list *in, listItem *ptr)
+// Remove item ptr, which is at position N in the list. Where possible, the neighbouring item's data is moved
+// into ptr and the neighbour is freed instead, so that a pointer to ptr held by an iterator remains valid.
+static void ppl_listRemoveEngine(list *in, listItem *ptr, int N)
  {
   listItem *ptrnext;
   if (ptr->next != NULL) // We are not the last item in the list
    {
+    memmove(in->items+N+1, in->items+N+2, (in->length-N-2) * sizeof(listItem *));
     ptrnext       = ptr->next;
     ptr->data     = ptrnext->data;
     ptr->next     = ptrnext->next;
@@ -153,6 +182,7 @@ static void ppl_listRemoveEngine(list *in, listItem *ptr)
     ptr->prev     = ptrnext->prev;
     if (in->first == ptrnext) in->first = ptr;
     else ptrnext->prev->next = ptr;
+    in->items[N-1] = ptr;
     if (in->useMalloc) free(ptrnext);
    }
   else // We are the only item in the list
@@ -167,18 +197,14 @@ static void ppl_listRemoveEngine(list *in, listItem *ptr)
 
 int ppl_listRemove(list *in, void *item)
  {
-  listItem *ptr;
+  int i;
   if (in==NULL) return 1;
-  ptr = in->first;
-  while (ptr != NULL)
-   {
-    if (ptr->data == item)
-     {
-      ppl_listRemoveEngine(in, ptr);
-      return 0;
-     }
-    ptr = ptr->next;
-   }
+  for (i=0; i<in->length; i++)
+   if (in->items[i]->data == item)
+    {
+     ppl_listRemoveEngine(in, in->items[i], i);
+     return 0;
+    }
   return 1;
  }
 
@@ -190,13 +216,10 @@ int ppl_listRemoveAll(list *in, void *item)
 
 void *ppl_listGetItem(list *in, int N)
  {
-  listItem *ptr;
-  int   i;
-  if (in==NULL) return NULL;
-  ptr = in->first;
-  for (i=0; ((i<N) && (ptr!=NULL)); i++, ptr=ptr->next);
-  if (ptr==NULL) return NULL;
-  return ptr->data;
+  if ((in==NULL)||(in->length==0)) return NULL;
+  if (N<0) N=0;
+  if (N>=in->length) return NULL;
+  return in->items[N]->data;
  }
 
 void *ppl_listPop(list *in)
@@ -217,14 +240,12 @@ void *ppl_listPop(list *in)
 
 void *ppl_listPopItem(list *in, int N)
  {
-  listItem *ptr;
-  void     *out=NULL;
-  int   i;
-  if (in==NULL) return NULL;
-  ptr = in->first;
-  for (i=0; ((i<N) && (ptr!=NULL)); i++, ptr=ptr->next);
-  if (ptr==NULL) return NULL;
-  else           { out=ptr->data; ppl_listRemoveEngine(in, ptr); }
+  void *out;
+  if ((in==NULL)||(in->length==0)) return NULL;
+  if (N<0) N=0;
+  if (N>=in->length) return NULL;
+  out = in->items[N]->data;
+  ppl_listRemoveEngine(in, in->items[N], N);
   return out;
  }
 
@@ -19,7 +19,7 @@
 
 // ----------------------------------------------------------------------------
 
-// Data structures for linked lists
+// Data structures for linked lists, with an array index of their items
 
 #ifndef _LIST_H
 #define _LIST_H 1
@@ -34,11 +34,13 @@ typedef struct listItemS
 
 typedef struct listS
  {
-  struct listItemS *first;
-  struct listItemS *last;
-  int               length, refCount, immutable;
-  int               useMalloc;
-  int               memory_context;
+  struct listItemS  *first;
+  struct listItemS  *last;
+  struct listItemS **items; // Array of pointers to every item, in order, for O(1) indexing
+  int                itemsAlloc; // Number of slots allocated in items
+  int                length, refCount, immutable;
+  int                useMalloc;
+  int                memory_context;
  } list;
 
 typedef listItem listIterator;
@@ -0,0 +1,96 @@
+// workerPool.c
+//
+// The code in this file is part of Pyxplot
+// <http://www.pyxplot.org.uk>
+//
+// Copyright (C) 2006-2013 Dominic Ford <coders@pyxplot.org.uk>
+//               2008-2013 Ross Church
+//
+// $Id$
+//
+// Pyxplot is free software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation; either version 2 of the License, or (at your option) any later
+// version.
+//
+// You should have received a copy of the GNU General Public License along with
+// Pyxplot; if not, write to the Free Software Foundation, Inc., 51 Franklin
+// Street, Fifth Floor, Boston, MA  02110-1301, USA
+
+// ----------------------------------------------------------------------------
+
+// Functions for dividing work between a pool of threads
+
+// Work is divided into a number of rows, which are split into contiguous blocks, one per thread. Each row must be
+// independent of every other, and rows must not call any function which touches the interpreter state, since
+// neither the expression evaluator nor the memory allocator in memAlloc.c are thread safe. Since the division of
+// rows between threads does not affect the output, results are the same whatever number of threads is used.
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "coreUtils/workerPool.h"
+
+// Hard limit on number of threads, whatever is requested
+#define WORKERPOOL_MAXTHREADS 256
+
+typedef struct workerJob
+ {
+  ppl_workerRowsFn fn;
+  void            *arg;
+  int              rowMin, rowMax;
+ } workerJob;
+
+static void *ppl_workerMain(void *in)
+ {
+  workerJob *job = (workerJob *)in;
+  (*job->fn)(job->arg, job->rowMin, job->rowMax);
+  return NULL;
+ }
+
+// Convert the setting <set threads> into a number of threads. A request for zero threads means one per processor.
+int ppl_workerCount(int requested)
+ {
+  if (requested<=0)
+   {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    requested = (n>0) ? (int)n : 1;
+   }
+  if (requested>WORKERPOOL_MAXTHREADS) requested=WORKERPOOL_MAXTHREADS;
+  return requested;
+ }
+
+// Call fn on all rows 0 <= row < Nrows, using up to Nthreads threads. The calling thread processes the first block
+// of rows itself. If threads cannot be created, their rows are processed serially by the calling thread instead.
+void ppl_workerRunRows(int Nthreads, int Nrows, ppl_workerRowsFn fn, void *arg)
+ {
+  workerJob  jobs   [WORKERPOOL_MAXTHREADS];
+  pthread_t  threads[WORKERPOOL_MAXTHREADS];
+  int        started[WORKERPOOL_MAXTHREADS];
+  int        i;
+
+  if (Nrows<=0) return;
+  Nthreads = ppl_workerCount(Nthreads);
+  if (Nthreads>Nrows) Nthreads=Nrows;
+  if (Nthreads<=1) { (*fn)(arg, 0, Nrows); return; }
+
+  for (i=0; i<Nthreads; i++)
+   {
+    jobs[i].fn     = fn;
+    jobs[i].arg    = arg;
+    jobs[i].rowMin = (int)(((long)Nrows) *  i    / Nthreads);
+    jobs[i].rowMax = (int)(((long)Nrows) * (i+1) / Nthreads);
+    started[i]     = (i>0) && (pthread_create(&threads[i], NULL, ppl_workerMain, &jobs[i])==0);
+   }
+
+  (*fn)(arg, jobs[0].rowMin, jobs[0].rowMax);
+  for (i=1; i<Nthreads; i++)
+   {
+    if (started[i]) pthread_join(threads[i], NULL);
+    else            (*fn)(arg, jobs[i].rowMin, jobs[i].rowMax);
+   }
+  return;
+ }
+
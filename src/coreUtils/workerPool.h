@@ -0,0 +1,34 @@
+// workerPool.h
+//
+// The code in this file is part of Pyxplot
+// <http://www.pyxplot.org.uk>
+//
+// Copyright (C) 2006-2013 Dominic Ford <coders@pyxplot.org.uk>
+//               2008-2013 Ross Church
+//
+// $Id$
+//
+// Pyxplot is free software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation; either version 2 of the License, or (at your option) any later
+// version.
+//
+// You should have received a copy of the GNU General Public License along with
+// Pyxplot; if not, write to the Free Software Foundation, Inc., 51 Franklin
+// Street, Fifth Floor, Boston, MA  02110-1301, USA
+
+// ----------------------------------------------------------------------------
+
+// Functions for dividing work between a pool of threads
+
+#ifndef _WORKERPOOL_H
+#define _WORKERPOOL_H 1
+
+// Function which processes rows rowMin <= row < rowMax of some task. arg is passed through unchanged.
+typedef void (*ppl_workerRowsFn)(void *arg, int rowMin, int rowMax);
+
+int  ppl_workerCount  (int requested);
+void ppl_workerRunRows(int Nthreads, int Nrows, ppl_workerRowsFn fn, void *arg);
+
+#endif
+
@@ -37,6 +37,7 @@
 #include "expressions/dollarOp.h"
 #include "expressions/expCompile_fns.h"
 #include "expressions/expEval.h"
+#include "expressions/expEvalBatch.h"
 #include "expressions/traceback_fns.h"
 #include "parser/cmdList.h"
 #include "parser/parser.h"
@@ -55,7 +56,10 @@
 
 #include "children.h"
 #include "datafile.h"
+#include "datafile_binary.h"
+#include "datafile_prefetch.h"
 #include "datafile_rasters.h"
+#include "datafile_stream.h"
 #include "pplConstants.h"
 
 dataBlock *ppldata_NewDataBlock(const int Ncolumns_real, const int Ncolumns_obj, const int memContext, const int length)
@@ -97,6 +101,8 @@ dataTable *ppldata_NewDataTable(const int Ncolumns_real, const int Ncolumns_obj,
   for (i=0;i<Ncolumns_real;i++) pplObjNum(output->firstEntries + i,0,0,0);
   output->first         = ppldata_NewDataBlock(Ncolumns_real, Ncolumns_obj, memContext, length);
   output->current       = output->first;
+  output->blockFn       = NULL;
+  output->blockArg      = NULL;
   if (output->first==NULL) return NULL;
   return output;
  }
@@ -138,6 +144,13 @@ int ppldata_DataTable_AddRow(dataTable *i)
   if (i->current==NULL) return 1;
   i->Nrows++;
   if (i->current->blockPosition < (i->current->blockLength-1)) { i->current->blockPosition++; return 0; }
+  if (i->blockFn != NULL) // Hand full block to its consumer, and then overwrite it
+   {
+    i->current->blockPosition = i->current->blockLength;
+    (*i->blockFn)(i->blockArg, i, i->current);
+    i->current->blockPosition = 0;
+    return 0;
+   }
   i->current->next          = ppldata_NewDataBlock(i->Ncolumns_real, i->Ncolumns_obj, i->memContext, -1);
   if (i->current==NULL) return 1;
   i->current->blockPosition = i->current->blockLength;
@@ -146,6 +159,17 @@ int ppldata_DataTable_AddRow(dataTable *i)
   return 0;
  }
 
+// If a consumer has asked, via c->dataBlockFn, for the next data table to be streamed to it, attach it to table i.
+// Only the block currently being filled is then kept, and the caller must pass its final contents to the consumer.
+void ppldata_DataTable_Stream(ppl_context *c, dataTable *i)
+ {
+  if ((i==NULL)||(c->dataBlockFn==NULL)) return;
+  i->blockFn      = (ppldata_blockFn)c->dataBlockFn;
+  i->blockArg     = c->dataBlockArg;
+  c->dataBlockFn  = NULL;
+  c->dataBlockArg = NULL;
+ }
+
 int ppldata_RawDataTable_AddRow(rawDataTable *i)
  {
   if (i==NULL) return 1;
@@ -192,86 +216,105 @@ void ppldata_DataTable_List(ppl_context *c, dataTable *i)
    }
  }
 
-// on error, returns NULL with error message in errtext.
-FILE *ppldata_LaunchCoProcess(ppl_context *c, char *filename, int wildcardMatchNumber, char *filenameOut, char *errtext)
+// Expand wildcards in a datafile's filename, and return the name of the wildcardMatchNumber'th file which matches.
+// On error, returns NULL with error message in errtext.
+char *ppldata_globFilename(ppl_context *c, char *filename, int wildcardMatchNumber, char *filenameOut, char *errtext)
  {
-  FILE         *infile;
-  dictIterator *dictIter;
-  char         *filter, *filterArgs, **argList;
-  int           i,j,k;
-  sigset_t      sigs;
-
-  sigemptyset(&sigs);
-  sigaddset(&sigs,SIGCHLD);
+  int       i, done=0, C;
+  wordexp_t wordExp;
+  glob_t    globData;
+  char      fName[FNAME_LENGTH];
 
   // Implement the magic filename '' to refer to the last used filename
   if (filename[0]=='\0') filename = c->dollarStat.lastFilename;
   else                   { strncpy(c->dollarStat.lastFilename, filename, FNAME_LENGTH); c->dollarStat.lastFilename[FNAME_LENGTH-1]='\0'; }
 
-  // glob filename
+  { int j,k; for (j=k=0; ((filename[j]!='\0')&&(k<FNAME_LENGTH-1)); ) { if (filename[j]==' ') fName[k++]='\\'; fName[k++]=filename[j++]; } fName[k++]='\0'; }
+  if (wildcardMatchNumber<0) wildcardMatchNumber=0;
+  C = wildcardMatchNumber;
+  if ((wordexp(fName, &wordExp, 0) != 0) || (wordExp.we_wordc <= 0)) { sprintf(errtext, "Could not open file '%s'.", fName); if (DEBUG) ppl_log(&c->errcontext, errtext); return NULL; };
+  for (i=0; i<wordExp.we_wordc; i++)
    {
-    int       i, done=0, C;
-    wordexp_t wordExp;
-    glob_t    globData;
-    char      fName[FNAME_LENGTH];
-    { int j,k; for (j=k=0; ((filename[j]!='\0')&&(k<FNAME_LENGTH-1)); ) { if (filename[j]==' ') fName[k++]='\\'; fName[k++]=filename[j++]; } fName[k++]='\0'; }
-    if (wildcardMatchNumber<0) wildcardMatchNumber=0;
-    C = wildcardMatchNumber;
-    if ((wordexp(fName, &wordExp, 0) != 0) || (wordExp.we_wordc <= 0)) { sprintf(errtext, "Could not open file '%s'.", fName); if (DEBUG) ppl_log(&c->errcontext, errtext); return NULL; };
-    for (i=0; i<wordExp.we_wordc; i++)
-     {
-      if ((glob(wordExp.we_wordv[i], 0, NULL, &globData) != 0) || ((i==0)&&(globData.gl_pathc==0)))
-       {
-        if (wildcardMatchNumber==0) sprintf(errtext, "Could not open file '%s'.", fName);
-        else                        sprintf(errtext, "glob produced zero hits.");
-        if (DEBUG) ppl_log(&c->errcontext, errtext);
-        return NULL;
-       }
-      if (C>=globData.gl_pathc) { C-=globData.gl_pathc; globfree(&globData); continue; }
-      filename = (char *)ppl_memAlloc(strlen(globData.gl_pathv[C])+1);
-      if (filename==NULL) { sprintf(errtext, "Out of memory (00)."); globfree(&globData); wordfree(&wordExp); return NULL; }
-      strcpy(filename, globData.gl_pathv[C]);
-      globfree(&globData);
-      done=1;
-      break;
-     }
-    wordfree(&wordExp);
-    if (!done)
+    if ((glob(wordExp.we_wordv[i], 0, NULL, &globData) != 0) || ((i==0)&&(globData.gl_pathc==0)))
      {
       if (wildcardMatchNumber==0) sprintf(errtext, "Could not open file '%s'.", fName);
-      else                        sprintf(errtext, "glob produced too few hits.");
+      else                        sprintf(errtext, "glob produced zero hits.");
       if (DEBUG) ppl_log(&c->errcontext, errtext);
       return NULL;
      }
-    if (filenameOut!=NULL) { strncpy(filenameOut, filename, FNAME_LENGTH); filenameOut[FNAME_LENGTH-1]='\0'; }
+    if (C>=globData.gl_pathc) { C-=globData.gl_pathc; globfree(&globData); continue; }
+    filename = (char *)ppl_memAlloc(strlen(globData.gl_pathv[C])+1);
+    if (filename==NULL) { sprintf(errtext, "Out of memory (00)."); globfree(&globData); wordfree(&wordExp); return NULL; }
+    strcpy(filename, globData.gl_pathv[C]);
+    globfree(&globData);
+    done=1;
+    break;
+   }
+  wordfree(&wordExp);
+  if (!done)
+   {
+    if (wildcardMatchNumber==0) sprintf(errtext, "Could not open file '%s'.", fName);
+    else                        sprintf(errtext, "glob produced too few hits.");
+    if (DEBUG) ppl_log(&c->errcontext, errtext);
+    return NULL;
    }
+  if (filenameOut!=NULL) { strncpy(filenameOut, filename, FNAME_LENGTH); filenameOut[FNAME_LENGTH-1]='\0'; }
+  return filename;
+ }
 
-  // Check whether we have a specified coprocessor to work on this filetype
-  dictIter = ppl_dictIterateInit(c->set->filters);
+// Return the input filter which has been set to work on a particular filename, or NULL if there isn't one
+char *ppldata_filterFor(ppl_context *c, char *filename)
+ {
+  dictIterator *dictIter = ppl_dictIterateInit(c->set->filters);
   while (dictIter != NULL)
    {
     char *dkey=NULL;
-    if (ppl_strWildcardTest(filename, dictIter->key))
+    if (ppl_strWildcardTest(filename, dictIter->key)) return (char *)((pplObj *)dictIter->data)->auxil;
+    ppl_dictIterate(&dictIter, &dkey);
+   }
+  return NULL;
+ }
+
+// on error, returns NULL with error message in errtext.
+FILE *ppldata_LaunchCoProcess(ppl_context *c, char *filename, int wildcardMatchNumber, char *filenameOut, char *errtext)
+ {
+  filename = ppldata_globFilename(c, filename, wildcardMatchNumber, filenameOut, errtext);
+  if (filename==NULL) return NULL;
+  return ppldata_openInput(c, filename, errtext);
+ }
+
+// Open a datafile whose filename has already been globbed, through an input filter if one has been set.
+// On error, returns NULL with error message in errtext.
+FILE *ppldata_openInput(ppl_context *c, char *filename, char *errtext)
+ {
+  FILE         *infile;
+  char         *filter, *filterArgs, **argList;
+  int           i,j,k;
+  sigset_t      sigs;
+
+  sigemptyset(&sigs);
+  sigaddset(&sigs,SIGCHLD);
+
+  // Check whether we have a specified coprocessor to work on this filetype
+  filter = ppldata_filterFor(c, filename);
+  if (filter != NULL)
+   {
+    if (DEBUG) { sprintf(c->errcontext.tempErrStr, "Using input filter '%s'.", filter); ppl_log(&c->errcontext, NULL); }
+    filterArgs = (char  *)ppl_memAlloc(strlen(filter)+1);
+    argList    = (char **)ppl_memAlloc((strlen(filter)/2+1)*sizeof(char *));
+    if ((filterArgs==NULL)||(argList==NULL)) { sprintf(errtext,"Out of memory (01)."); if (DEBUG) ppl_log(&c->errcontext, errtext); return NULL; };
+    strcpy(filterArgs, filter);
+    for (i=j=k=0; filterArgs[i]!='\0'; i++)
      {
-      filter = (char *)((pplObj *)dictIter->data)->auxil;
-      if (DEBUG) { sprintf(c->errcontext.tempErrStr, "Using input filter '%s'.", filter); ppl_log(&c->errcontext, NULL); }
-      filterArgs = (char  *)ppl_memAlloc(strlen(filter)+1);
-      argList    = (char **)ppl_memAlloc((strlen(filter)/2+1)*sizeof(char *));
-      if ((filterArgs==NULL)||(argList==NULL)) { sprintf(errtext,"Out of memory (01)."); if (DEBUG) ppl_log(&c->errcontext, errtext); return NULL; };
-      strcpy(filterArgs, filter);
-      for (i=j=k=0; filterArgs[i]!='\0'; i++)
-       {
-        if      ((k==0) && (filterArgs[i]> ' ')) { k=1; argList[j++] = filterArgs+i; }
-        else if ((k==1) && (filterArgs[i]<=' ')) { k=0; filterArgs[i] = '\0'; }
-       }
-      argList[j++] = filename;
-      argList[j++] = NULL;
-      pplcsp_forkInputFilter(c, argList, &i); // Fork process for input filter, and runned piped output through the standard IO library using fdopen()
-      sigprocmask(SIG_UNBLOCK, &sigs, NULL);
-      if ((infile = fdopen(i, "r")) == NULL) { sprintf(errtext,"Could not open connection to input filter '%s'.",argList[0]); if (DEBUG) ppl_log(&c->errcontext, errtext); return NULL; };
-      return infile;
+      if      ((k==0) && (filterArgs[i]> ' ')) { k=1; argList[j++] = filterArgs+i; }
+      else if ((k==1) && (filterArgs[i]<=' ')) { k=0; filterArgs[i] = '\0'; }
      }
-    ppl_dictIterate(&dictIter, &dkey);
+    argList[j++] = filename;
+    argList[j++] = NULL;
+    pplcsp_forkInputFilter(c, argList, &i); // Fork process for input filter, and runned piped output through the standard IO library using fdopen()
+    sigprocmask(SIG_UNBLOCK, &sigs, NULL);
+    if ((infile = fdopen(i, "r")) == NULL) { sprintf(errtext,"Could not open connection to input filter '%s'.",argList[0]); if (DEBUG) ppl_log(&c->errcontext, errtext); return NULL; };
+    return infile;
    }
 
   // If not, then we just open the file and return a file-handle to it
@@ -351,7 +394,47 @@ void ppldata_UsingConvert(ppl_context *c, pplExpr *input, char **columns_str, pp
 
 #define FAIL { COUNTERR_BEGIN; ppl_warning(&c->errcontext, ERR_STACKED, errtext); COUNTERR_END; *status = 1; *discontinuity = 1; if (DEBUG) ppl_log(&c->errcontext, errtext); return; }
 
-void ppldata_ApplyUsingList(ppl_context *c, dataTable *out, pplExpr **usingExprs, pplExpr *labelExpr, pplExpr *selectExpr, int continuity, int *discontinuity, char **columns_str, pplObj *columns_val, int Ncols, char *filename, long file_linenumber, long *file_linenumbers, long linenumber_count, long block_count, long index_number, int usingRowCol, char **colHeads, int NcolHeads, pplObj *colUnits, int NcolUnits, int *status, char *errtext, int *errCount, int iterDepth)
+// The columns of one line of a text datafile, handed to ppl_expBatchRun(). Items which are not numbers, or columns
+// which do not exist on this line, are returned as NaN, so that the using item is passed to ppl_expEval() instead,
+// which reports the error. Mirrors ppl_dollarOp_fetchColByNum().
+typedef struct usingBatchLine
+ {
+  char  **columns_str;
+  int     Ncols;
+  pplObj *colUnits;
+  int     NcolUnits;
+ } usingBatchLine;
+
+static void ppldata_usingBatchFetch(void *arg, int colNum, long rowMin, long N, double *out)
+ {
+  usingBatchLine *l = (usingBatchLine *)arg;
+  char           *s;
+  int             j=-1;
+
+  out[0] = GSL_NAN;
+  if ((colNum<1)||(colNum>l->Ncols)) return;
+  s = l->columns_str[colNum-1];
+  if ( (!ppl_validFloat(s,&j)) || (j<1) || ((s[j]!='\0')&&(s[j]!=',')&&(s[j-1]>' ')) ) return;
+  out[0] = ppl_getFloat(s,NULL);
+  if (colNum<=l->NcolUnits) out[0] *= l->colUnits[colNum-1].real;
+ }
+
+// Compile batch programs for those using items which are pure numeric expressions of the columns of a text datafile,
+// for the column headings and units given.
+static void ppldata_usingBatchCompile(ppl_context *c, usingBatch *batch, dataTable *out, pplExpr **usingExprs, char **colHeads, int NcolHeads, pplObj *colUnits, int NcolUnits)
+ {
+  int i;
+  batch->compiled  = 1;
+  batch->colHeads  = colHeads;
+  batch->NcolHeads = NcolHeads;
+  batch->colUnits  = colUnits;
+  batch->NcolUnits = NcolUnits;
+  for (i=0; i<out->Ncolumns_real; i++)
+   batch->ok[i] = (ppldata_UsingPlainColumn(usingExprs[i], MAX_DATACOLS, colHeads, NcolHeads)==0) &&
+                  (ppl_expBatchCompile(c, usingExprs[i], MAX_DATACOLS, colUnits, NcolUnits, &batch->prog[i])==0);
+ }
+
+void ppldata_ApplyUsingList(ppl_context *c, dataTable *out, pplExpr **usingExprs, pplExpr *labelExpr, pplExpr *selectExpr, usingBatch *batch, int continuity, int *discontinuity, char **columns_str, pplObj *columns_val, int Ncols, char *filename, long file_linenumber, long *file_linenumbers, long linenumber_count, long block_count, long index_number, int usingRowCol, char **colHeads, int NcolHeads, pplObj *colUnits, int NcolUnits, int *status, char *errtext, int *errCount, int iterDepth)
  {
   ppl_context *context     = c;
   const int    stkLevelOld = c->stackPtr;
@@ -397,6 +480,14 @@ void ppldata_ApplyUsingList(ppl_context *c, dataTable *out, pplExpr **usingExprs
     STACK_CLEAN;
    }
 
+  // batch programs for the using expressions, if the caller has asked for them
+  if ((batch!=NULL) && (columns_str!=NULL))
+   {
+    if ((!batch->compiled) || (batch->colHeads!=colHeads) || (batch->NcolHeads!=NcolHeads) || (batch->colUnits!=colUnits) || (batch->NcolUnits!=NcolUnits))
+      ppldata_usingBatchCompile(c, batch, out, usingExprs, colHeads, NcolHeads, colUnits, NcolUnits);
+   }
+  else batch=NULL;
+
   // using expressions
   for (i=0; i<nUsing; i++)
    {
@@ -404,6 +495,31 @@ void ppldata_ApplyUsingList(ppl_context *c, dataTable *out, pplExpr **usingExprs
     const int  outObj = i>=out->Ncolumns_real;
     const int  idx    = outObj ? (i-out->Ncolumns_real) : i;
     pplExpr   *ex     = usingExprs[i];
+    if ((!outObj) && (batch!=NULL) && batch->ok[i])
+     {
+      pplExprBatch  *b = &batch->prog[i];
+      usingBatchLine line;
+      double         val;
+      unsigned char  bad = 0;
+      line.columns_str = columns_str;
+      line.Ncols       = Ncols;
+      line.colUnits    = colUnits;
+      line.NcolUnits   = NcolUnits;
+      ppl_expBatchRun(b, ppldata_usingBatchFetch, (void *)&line, 0, 1, &val, &bad);
+      if ((!bad) && ((out->Nrows==0) || ((out->firstEntries[i].objType==PPLOBJ_NUM) && ppl_unitsDimEqual(&out->firstEntries[i], &b->unit))))
+       {
+        if (out->Nrows==0)
+         {
+          out->firstEntries[i] = b->unit;
+          out->firstEntries[i].real = val;
+          out->firstEntries[i].refCount = 1;
+          out->firstEntries[i].amMalloced = 0;
+         }
+        out->current->data_real[idx + out->current->blockPosition * out->Ncolumns_real] = val;
+        continue;
+       }
+      // Otherwise fall through to ppl_expEval(), which reports any error
+     }
     ppldata_UsingConvert(c, ex, columns_str, columns_val, Ncols, filename, file_linenumber, file_linenumbers, linenumber_count, block_count, index_number, usingRowCol, colHeads, NcolHeads, colUnits, NcolUnits, &fail, errtext, iterDepth);
     if (fail) { STACK_CLEAN; FAIL; }
     if (!outObj)
@@ -459,6 +575,52 @@ void ppldata_ApplyUsingList(ppl_context *c, dataTable *out, pplExpr **usingExprs
   return;
  }
 
+// If a using expression simply asks for a column of data, e.g. 'using 2' or 'using name', return the number of that
+// column, counting from one. Return zero if the expression needs evaluating, or -1 if it refers to a column which
+// must be looked up by the interpreter. Mirrors the test made in ppldata_UsingConvert().
+int ppldata_UsingPlainColumn(pplExpr *e, int Ncols, char **colHeads, int NcolHeads)
+ {
+  int i=-1;
+  int l=strlen(e->ascii);
+  while ((l>0)&&(e->ascii[l]>='\0')&&(e->ascii[l]<=' ')) l--;
+  if (ppl_validFloat(e->ascii,&i)&&(i>l))
+   {
+    double dbl = ppl_getFloat(e->ascii,NULL);
+    int    col = (int)round(dbl);
+    if ((dbl>-4)&&(dbl<MAX_DATACOLS)&&(col>=1)&&(col<=Ncols)) return col;
+    return -1;
+   }
+  for (i=0;i<NcolHeads;i++) if (strcmp(colHeads[i],e->ascii)==0) return (i+1<=Ncols) ? i+1 : -1;
+  return 0;
+ }
+
+// Append a row of numbers which have been computed without the interpreter, e.g. by ppl_expBatchRun(), to the data
+// table out, in the same way as ppldata_ApplyUsingList() would have done. The j-th value has the physical units of
+// units[j]; the caller must already have checked that these agree with any rows already in the table. Returns
+// nonzero if out of memory.
+int ppldata_AddNumericRow(dataTable *out, const double *vals, pplObj **units, long fileLine, int discontinuity)
+ {
+  double *outRow  = &out->current->data_real    [out->current->blockPosition * out->Ncolumns_real];
+  long   *outLine = &out->current->fileLine_real[out->current->blockPosition * out->Ncolumns_real];
+  int     j;
+
+  out->current->text[out->current->blockPosition] = NULL;
+  for (j=0; j<out->Ncolumns_real; j++)
+   {
+    outRow [j] = vals[j];
+    outLine[j] = fileLine;
+    if (out->Nrows==0)
+     {
+      out->firstEntries[j] = *units[j];
+      out->firstEntries[j].real = vals[j];
+      out->firstEntries[j].refCount = 1;
+      out->firstEntries[j].amMalloced = 0;
+     }
+   }
+  out->current->split[out->current->blockPosition] = discontinuity;
+  return ppldata_DataTable_AddRow(out);
+ }
+
 void ppldata_RotateRawData(ppl_context *c, rawDataTable **in, dataTable *out, pplExpr **usingExprs, pplExpr *labelExpr, pplExpr *selectExpr, int continuity, char *filename, long block_count, long index_number, char **colHeads, int NcolHeads, pplObj *colUnits, int NcolUnits, int *status, char *errtext, int *errCount, int iterDepth)
  {
   int           i;
@@ -521,7 +683,7 @@ void ppldata_RotateRawData(ppl_context *c, rawDataTable **in, dataTable *out, pp
      }
     if (!gotData) break;
 
-    ppldata_ApplyUsingList(c, out, usingExprs, labelExpr, selectExpr, continuity, &discontinuity, rowData, NULL, Ncols, filename, file_linenumber[0], file_linenumber, linenumber_count, block_count, index_number, DATAFILE_ROW, colHeads, NcolHeads, colUnits, NcolUnits, status, errtext, errCount, iterDepth);
+    ppldata_ApplyUsingList(c, out, usingExprs, labelExpr, selectExpr, NULL, continuity, &discontinuity, rowData, NULL, Ncols, filename, file_linenumber[0], file_linenumber, linenumber_count, block_count, index_number, DATAFILE_ROW, colHeads, NcolHeads, colUnits, NcolUnits, status, errtext, errCount, iterDepth);
     linenumber_count++;
    }
 
@@ -661,7 +823,8 @@ void ppldata_fromFile(ppl_context *c, dataTable **out, char *filename, int wildc
   long         file_linenumber    = 0;
   long         itemsOnLine;
   FILE        *filtered_input=NULL;
-  char         linebuffer[LSTR_LENGTH], *lineptr=linebuffer, *linebufferPtr=&linebuffer[0], *cptr;
+  ppldata_stream *stream=NULL;
+  char         linebuffer[LSTR_LENGTH], *lineptr=linebuffer, *cptr;
 
   int i, j, k, l, m;
 
@@ -676,8 +839,10 @@ void ppldata_fromFile(ppl_context *c, dataTable **out, char *filename, int wildc
 
   char         *colData[MAX_DATACOLS];
   rawDataTable *rawDataTab = NULL;
+  usingBatch    batch;
 
   // Init
+  batch.compiled = 0;
   if (DEBUG) { sprintf(c->errcontext.tempErrStr, "Opening datafile '%s'.", filename); ppl_log(&c->errcontext,NULL); }
   if (Ncols <  0)
    {
@@ -710,11 +875,23 @@ void ppldata_fromFile(ppl_context *c, dataTable **out, char *filename, int wildc
    }
   else
    {
-    filtered_input = ppldata_LaunchCoProcess(c, filename, wildcardMatchNumber, filenameOut, errtext);
-    if (filtered_input==NULL) { *status=1; return; }
+    char *filenameFinal = ppldata_globFilename(c, filename, wildcardMatchNumber, filenameOut, errtext);
+    if (filenameFinal==NULL) { *status=1; return; }
+    stream = ppldata_prefetchTake(filenameFinal); // Text may already have been read by a background thread
+    if (stream==NULL)
+     {
+      filtered_input = ppldata_openInput(c, filenameFinal, errtext);
+      if (filtered_input==NULL) { *status=1; return; }
+     }
    }
 
-#define FCLOSE_FI  { if ((!readFromCommandLine) && (filtered_input!=stdin)) fclose(filtered_input); }
+#define FCLOSE_FI  { ppldata_streamClose(stream); stream=NULL; if ((!readFromCommandLine) && (filtered_input!=NULL) && (filtered_input!=stdin)) fclose(filtered_input); }
+
+  if ((!readFromCommandLine) && (stream==NULL))
+   {
+    stream = ppldata_streamOpen(filtered_input);
+    if (stream == NULL) { strcpy(errtext, "Out of memory whilst trying to open datafile."); *status=1; if (DEBUG) ppl_log(&c->errcontext,errtext); FCLOSE_FI; return; }
+   }
 
   // Keep a record of the memory context we're going to output into, and then make a scratchpad context
   contextOutput = persistent ? 0 : ppl_memAlloc_GetMemContext();
@@ -723,24 +900,41 @@ void ppldata_fromFile(ppl_context *c, dataTable **out, char *filename, int wildc
 
   *out = ppldata_NewDataTable(Ncols-NusingObjs, NusingObjs, contextOutput, -1);
   if (*out == NULL) { strcpy(errtext, "Out of memory whilst trying to allocate data table to read data from file."); *status=1; if (DEBUG) ppl_log(&c->errcontext,errtext); FCLOSE_FI; return; }
+  if (sortBy==NULL) ppldata_DataTable_Stream(c, *out);
   if (usingRowCol == DATAFILE_ROW)
    {
     rawDataTab = ppldata_NewRawDataTable(contextRaw);
     if (rawDataTab == NULL) { strcpy(errtext, "Out of memory whilst trying to allocate data table to read data from file."); *status=1; if (DEBUG) ppl_log(&c->errcontext,errtext); FCLOSE_FI; return; }
    }
 
+  // Binary columnar datafiles are read straight from their memory mapping
+  if ((stream!=NULL) && ppldata_binaryIsBinary(stream->map, stream->mapLen))
+   {
+    if (DEBUG) ppl_log(&c->errcontext,"Reading binary datafile.");
+    ppldata_binaryRead(c, *out, stream->map, stream->mapLen, filename, indexNo, usingExprs, autoUsingExprs, Ncols-(sortBy!=NULL), labelExpr, selectExpr, usingRowCol, everyList, continuity, status, errtext, errCount, iterDepth);
+    FCLOSE_FI;
+    if (*status) return;
+    if (sortBy != NULL) *out = ppldata_sort(c, *out, Ncols-1, continuity==DATAFILE_CONTINUOUS);
+    ppl_memAlloc_AscendOutOfContext(contextRough);
+    return;
+   }
+
   // Read input file, line by line
-  while (readFromCommandLine || ( (!ferror(filtered_input)) && (!feof(filtered_input)) ))
+  while (1)
    {
     if (cancellationFlag) break;
-    if (!readFromCommandLine) ppl_file_readline(filtered_input, &linebufferPtr, NULL, LSTR_LENGTH);
-    else                      lineptr = ppldata_fetchFromSpool(dataSpool);
-
-    if (readFromCommandLine && (lineptr==NULL                                     )) break; // End of file reached
-    if (readFromCommandLine && (strcmp(ppl_strStrip(lineptr, linebuffer),"END")==0)) break;
+    if (!readFromCommandLine)
+     {
+      if (!ppldata_streamReadLine(stream, linebuffer, LSTR_LENGTH)) break; // End of file reached; line is returned stripped
+     }
+    else
+     {
+      lineptr = ppldata_fetchFromSpool(dataSpool);
+      if (lineptr==NULL) break; // End of file reached
+      if (strcmp(ppl_strStrip(lineptr, linebuffer),"END")==0) break;
+     }
 
     file_linenumber++;
-    ppl_strStrip(lineptr, linebuffer);
 
     for (j=0; ((linebuffer[j]!='\0')&&(linebuffer[j]<=' ')); j++);
     if (linebuffer[j]=='\0') // We have a blank line
@@ -945,7 +1139,7 @@ void ppldata_fromFile(ppl_context *c, dataTable **out, char *filename, int wildc
         sprintf(lineNumberStr,"%ld",file_linenumber);
        }
 
-      ppldata_ApplyUsingList(c, *out, usingExprs, labelExpr, selectExpr, continuity, &discontinuity, colData, NULL, itemsOnLine, filename, file_linenumber, NULL, linenumber_count, block_count, index_number, DATAFILE_COL, columnHeadings, NcolumnHeadings, columnUnits, NcolumnUnits, status, errtext, errCount, iterDepth);
+      ppldata_ApplyUsingList(c, *out, usingExprs, labelExpr, selectExpr, &batch, continuity, &discontinuity, colData, NULL, itemsOnLine, filename, file_linenumber, NULL, linenumber_count, block_count, index_number, DATAFILE_COL, columnHeadings, NcolumnHeadings, columnUnits, NcolumnUnits, status, errtext, errCount, iterDepth);
       if (*status) { *status=0; /* It was just a warning... */ }
      }
     linenumber_count++;
@@ -1005,8 +1199,11 @@ void ppldata_fromFuncs(ppl_context *c, dataTable **out, pplExpr **fnlist, int fn
   contextOutput = ppl_memAlloc_GetMemContext();
   *out = ppldata_NewDataTable(Ncols-NusingObjs, NusingObjs, contextOutput, sampleGrid ? (rasterXlen*rasterYlen) : rasterXlen);
   if (*out == NULL) { strcpy(errtext, "Out of memory whilst trying to allocate data table to read data from file."); *status=1; if (DEBUG) ppl_log(&c->errcontext,errtext); return; }
+  if (sortBy==NULL) ppldata_DataTable_Stream(c, *out);
 
-  // Loop over ordinate values
+  // Loop over ordinate values. These cannot be handed to ppl_expBatchRun(): the functions being sampled are read
+  // afresh for each value of the ordinate variable, which ppl_expBatchCompile() would bind as a constant, and they
+  // are usually user-defined functions, which it rejects. Their units and types are only known after evaluation.
   {
    int i,i2;
    const int ilen=rasterXlen, i2len = sampleGrid?rasterYlen:1;
@@ -1074,7 +1271,7 @@ void ppldata_fromFuncs(ppl_context *c, dataTable **out, pplExpr **fnlist, int fn
     expectedNrows = (*out)->Nrows+1;
     if (!(*status))
      {
-      ppldata_ApplyUsingList(c, *out, usingExprs, labelExpr, selectExpr, continuity, &discontinuity2, NULL, colData, fnlist_len+offset-1, buffer, 0, NULL, i, 0, 0, DATAFILE_COL, NULL, 0, NULL, 0, status, errtext, errCount, iterDepth);
+      ppldata_ApplyUsingList(c, *out, usingExprs, labelExpr, selectExpr, NULL, continuity, &discontinuity2, NULL, colData, fnlist_len+offset-1, buffer, 0, NULL, i, 0, 0, DATAFILE_COL, NULL, 0, NULL, 0, status, errtext, errCount, iterDepth);
      } else {
       if (!sampleGrid) discontinuity2 = 1;
      }
@@ -1107,12 +1304,29 @@ CANCEL:
   return;
  }
 
+// Vector data handed to ppl_expBatchRun()
+static void ppldata_vectorFetch(void *arg, int colNum, long rowMin, long N, double *out)
+ {
+  gsl_vector *v = ((gsl_vector **)arg)[colNum-1];
+  long        r;
+  for (r=0; r<N; r++) out[r] = gsl_vector_get(v, rowMin+r);
+ }
+
+// Where every using item either selects a vector, or is a pure numeric expression which ppl_expBatchCompile()
+// accepts, the values are computed a chunk of rows at a time, as in ppldata_binaryRead(). Rows in which the batch
+// evaluator meets a non-finite value are passed through ppldata_ApplyUsingList() individually.
 void ppldata_fromVectors(ppl_context *c, dataTable **out, pplObj *objList, int objListLen, pplExpr **usingExprs, int autoUsingExprs, int Ncols, int NusingObjs, pplExpr *labelExpr, pplExpr *selectExpr, pplExpr *sortBy, int continuity, int *status, char *errtext, int *errCount, int iterDepth)
  {
-  int         contextOutput, discontinuity=0, i, j;
-  const int   vlen = ((pplVector *)objList[0].auxil)->v->size;
-  pplObj      colData[USING_ITEMS_MAX+2];
-  gsl_vector *v[USING_ITEMS_MAX+2];
+  int            contextOutput, discontinuity=0, i, j, plain;
+  const int      vlen = ((pplVector *)objList[0].auxil)->v->size;
+  pplObj         colData[USING_ITEMS_MAX+2];
+  gsl_vector    *v[USING_ITEMS_MAX+2];
+  int            plainCol[USING_ITEMS_MAX+2];
+  pplExprBatch   batch[USING_ITEMS_MAX+2];
+  pplObj        *rowUnits[USING_ITEMS_MAX+2];
+  double         rowVals[USING_ITEMS_MAX+2];
+  double        *batchOut=NULL;
+  unsigned char *bad=NULL;
 
   // Init
   if (DEBUG) { sprintf(c->errcontext.tempErrStr, "Evaluated supplied set of functions."); ppl_log(&c->errcontext,NULL); }
@@ -1140,15 +1354,48 @@ void ppldata_fromVectors(ppl_context *c, dataTable **out, pplObj *objList, int o
   contextOutput = ppl_memAlloc_GetMemContext();
   *out = ppldata_NewDataTable(Ncols-NusingObjs, NusingObjs, contextOutput, vlen);
   if (*out == NULL) { strcpy(errtext, "Out of memory whilst trying to allocate data table to read data from file."); *status=1; if (DEBUG) ppl_log(&c->errcontext,errtext); return; }
+  if (sortBy==NULL) ppldata_DataTable_Stream(c, *out);
+
+  // Work out whether every using item either simply selects a vector, or can be evaluated over whole vectors
+  plain = (labelExpr==NULL) && (selectExpr==NULL) && (NusingObjs==0);
+  for (j=0; (plain && (j<Ncols)); j++)
+   {
+    if ((plainCol[j] = ppldata_UsingPlainColumn(usingExprs[j], objListLen, NULL, 0))<=0)
+     if ((plainCol[j]<0) || (ppl_expBatchCompile(c, usingExprs[j], objListLen, colData+1, objListLen, &batch[j])!=0)) plain=0;
+    rowUnits[j] = (plainCol[j]>0) ? &colData[plainCol[j]] : &batch[j].unit;
+   }
+  if (plain)
+   {
+    batchOut = (double *)ppl_memAlloc(Ncols*PPL_BATCH_CHUNK*sizeof(double));
+    bad      = (unsigned char *)ppl_memAlloc(PPL_BATCH_CHUNK);
+    if ((batchOut==NULL)||(bad==NULL)) plain=0;
+   }
 
   // Loop over data
   for (i=0; i<vlen; i++)
    {
-    char *buffer="vector data";
+    char     *buffer="vector data";
+    const int rc = i % PPL_BATCH_CHUNK;
     if (cancellationFlag) break;
+    if (plain && (rc==0))
+     {
+      const long n = (vlen-i < PPL_BATCH_CHUNK) ? (vlen-i) : PPL_BATCH_CHUNK;
+      memset(bad, 0, n);
+      for (j=0; j<Ncols; j++)
+       if (plainCol[j]<=0)
+        ppl_expBatchRun(&batch[j], ppldata_vectorFetch, (void *)v, i, n, batchOut + j*PPL_BATCH_CHUNK, bad);
+     }
+    if (plain && !bad[rc])
+     {
+      for (j=0; j<Ncols; j++) rowVals[j] = (plainCol[j]>0) ? gsl_vector_get(v[plainCol[j]-1],i) : batchOut[j*PPL_BATCH_CHUNK + rc];
+      if (ppldata_AddNumericRow(*out, rowVals, rowUnits, 0, discontinuity)) { sprintf(errtext, "%s: Out of memory storing data table.", buffer); *status=1; if (DEBUG) ppl_log(&c->errcontext,errtext); return; }
+      discontinuity = 0;
+      *status = 0; // As ppldata_ApplyUsingList() would have set
+      continue;
+     }
     pplObjNum(colData+0,0,i,0);
     for (j=0; j<objListLen; j++) colData[j+1].real = gsl_vector_get(v[j],i);
-    ppldata_ApplyUsingList(c, *out, usingExprs, labelExpr, selectExpr, continuity, &discontinuity, NULL, colData, objListLen, buffer, 0, NULL, i, 0, 0, DATAFILE_COL, NULL, 0, NULL, 0, status, errtext, errCount, iterDepth);
+    ppldata_ApplyUsingList(c, *out, usingExprs, labelExpr, selectExpr, NULL, continuity, &discontinuity, NULL, colData, objListLen, buffer, 0, NULL, i, 0, 0, DATAFILE_COL, NULL, 0, NULL, 0, status, errtext, errCount, iterDepth);
    }
 
   // If data is to be sorted, sort it now
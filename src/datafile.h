@@ -37,6 +37,7 @@
 #define DATAFILE_DATABLOCK_BYTES 524288
 
 #include "coreUtils/list.h"
+#include "expressions/expEvalBatch.h"
 #include "parser/parser.h"
 #include "userspace/context.h"
 #include "userspace/pplObj.h"
@@ -75,6 +76,11 @@ typedef struct dataBlock {
   struct dataBlock *prev;
  } dataBlock;
 
+struct dataTable;
+
+// Function which consumes a full block of a data table, after which the block's storage is reused for later rows
+typedef void (*ppldata_blockFn)(void *arg, struct dataTable *table, struct dataBlock *blk);
+
 typedef struct dataTable {
   int               Ncolumns_real;
   int               Ncolumns_obj;
@@ -83,8 +89,22 @@ typedef struct dataTable {
   pplObj           *firstEntries; // Array of size Ncolumns; store units for data in each column here
   struct dataBlock *first;
   struct dataBlock *current;
+  ppldata_blockFn   blockFn;      // If non-NULL, full blocks are passed here rather than being kept
+  void             *blockArg;
  } dataTable;
 
+// Batch programs for the using items applied to the lines of a text datafile. These are compiled for the column
+// headings and units in force when they are first needed, and recompiled if the datafile declares new ones.
+
+typedef struct usingBatch {
+  int               compiled;   // Nonzero once the programs below match colHeads and colUnits
+  char            **colHeads;
+  pplObj           *colUnits;
+  int               NcolHeads, NcolUnits;
+  int               ok[USING_ITEMS_MAX+2]; // Nonzero if using item i has a batch program
+  pplExprBatch      prog[USING_ITEMS_MAX+2];
+ } usingBatch;
+
 // Functions in ppl_datafile.c
 
 dataBlock    *ppldata_NewDataBlock       (const int Ncolumns_real, const int Ncolumns_obj, const int memContext, const int length);
@@ -92,11 +112,17 @@ dataTable    *ppldata_NewDataTable       (const int Ncolumns_real, const int Nco
 rawDataBlock *ppldata_NewRawDataBlock    (const int memContext);
 rawDataTable *ppldata_NewRawDataTable    (const int memContext);
 int           ppldata_DataTable_AddRow   (dataTable *i);
+void          ppldata_DataTable_Stream   (ppl_context *c, dataTable *i);
 int           ppldata_RawDataTable_AddRow(rawDataTable *i);
 void          ppldata_DataTable_List     (ppl_context *c, dataTable *i);
+char         *ppldata_globFilename       (ppl_context *c, char *filename, int wildcardMatchNumber, char *filenameOut, char *errtext);
+char         *ppldata_filterFor          (ppl_context *c, char *filename);
 FILE         *ppldata_LaunchCoProcess    (ppl_context *c, char *filename, int wildcardMatchNumber, char *filenameOut, char *errout);
+FILE         *ppldata_openInput          (ppl_context *c, char *filename, char *errtext);
 void          ppldata_UsingConvert       (ppl_context *c, pplExpr *input, char **columns_str, pplObj *columns_val, int Ncols, char *filename, long file_linenumber, long *file_linenumbers, long linenumber_count, long block_count, long index_number, int usingRowCol, char **colHeads, int NcolHeads, pplObj *colUnits, int NcolUnits, int *status, char *errtext, int iterDepth);
-void          ppldata_ApplyUsingList     (ppl_context *c, dataTable *out, pplExpr **usingExprs, pplExpr *labelExpr, pplExpr *selectExpr, int continuity, int *discontinuity, char **columns_str, pplObj *columns_val, int Ncols, char *filename, long file_linenumber, long *file_linenumbers, long linenumber_count, long block_count, long index_number, int usingRowCol, char **colHeads, int NcolHeads, pplObj *colUnits, int NcolUnits, int *status, char *errtext, int *errCount, int iterDepth);
+void          ppldata_ApplyUsingList     (ppl_context *c, dataTable *out, pplExpr **usingExprs, pplExpr *labelExpr, pplExpr *selectExpr, usingBatch *batch, int continuity, int *discontinuity, char **columns_str, pplObj *columns_val, int Ncols, char *filename, long file_linenumber, long *file_linenumbers, long linenumber_count, long block_count, long index_number, int usingRowCol, char **colHeads, int NcolHeads, pplObj *colUnits, int NcolUnits, int *status, char *errtext, int *errCount, int iterDepth);
+int           ppldata_UsingPlainColumn   (pplExpr *e, int Ncols, char **colHeads, int NcolHeads);
+int           ppldata_AddNumericRow      (dataTable *out, const double *vals, pplObj **units, long fileLine, int discontinuity);
 void          ppldata_RotateRawData      (ppl_context *c, rawDataTable **in, dataTable *out, pplExpr **usingExprs, pplExpr *labelExpr, pplExpr *selectExpr, int continuity, char *filename, long block_count, long index_number, char **colHeads, int NcolHeads, pplObj *colUnits, int NcolUnits, int *status, char *errtext, int *errCount, int iterDepth);
 dataTable    *ppldata_sort(ppl_context *c, dataTable *in, int sortCol, int ignoreContinuity);
 
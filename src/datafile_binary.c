@@ -0,0 +1,332 @@
+// datafile_binary.c
+//
+// The code in this file is part of Pyxplot
+// <http://www.pyxplot.org.uk>
+//
+// Copyright (C) 2006-2013 Dominic Ford <coders@pyxplot.org.uk>
+//               2008-2013 Ross Church
+//
+// $Id$
+//
+// Pyxplot is free software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation; either version 2 of the License, or (at your option) any later
+// version.
+//
+// You should have received a copy of the GNU General Public License along with
+// Pyxplot; if not, write to the Free Software Foundation, Inc., 51 Franklin
+// Street, Fifth Floor, Boston, MA  02110-1301, USA
+
+// ----------------------------------------------------------------------------
+
+// Reading and writing of Pyxplot's binary columnar datafile format, which is described in datafile_binary.h
+
+#define _DATAFILE_BINARY_C 1
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <stdint.h>
+
+#include <gsl/gsl_math.h>
+
+#include "coreUtils/errorReport.h"
+#include "coreUtils/memAlloc.h"
+#include "expressions/expEvalBatch.h"
+#include "expressions/traceback_fns.h"
+#include "settings/settings.h"
+#include "stringTools/asciidouble.h"
+#include "stringTools/strConstants.h"
+#include "userspace/context.h"
+#include "userspace/pplObj_fns.h"
+#include "userspace/unitsDisp.h"
+#include "userspace/unitsArithmetic.h"
+
+#include "datafile.h"
+#include "datafile_binary.h"
+
+// Routines for reading little-endian numbers from memory, whatever the byte order of this machine
+
+static uint32_t ppldata_binaryGet32(const unsigned char *p)
+ {
+  return ((uint32_t)p[0]) | (((uint32_t)p[1])<<8) | (((uint32_t)p[2])<<16) | (((uint32_t)p[3])<<24);
+ }
+
+static uint64_t ppldata_binaryGet64(const unsigned char *p)
+ {
+  return ((uint64_t)ppldata_binaryGet32(p)) | (((uint64_t)ppldata_binaryGet32(p+4))<<32);
+ }
+
+static double ppldata_binaryGetDouble(const unsigned char *p)
+ {
+  uint64_t u = ppldata_binaryGet64(p);
+  double   d;
+  memcpy(&d, &u, sizeof(double));
+  return d;
+ }
+
+static size_t ppldata_binaryPad(size_t pos)
+ {
+  return (pos+7) & ~((size_t)7);
+ }
+
+int ppldata_binaryIsBinary(const unsigned char *data, size_t len)
+ {
+  return (data!=NULL) && (len>=DATAFILE_BINARY_MAGICLEN) && (memcmp(data, DATAFILE_BINARY_MAGIC, DATAFILE_BINARY_MAGICLEN)==0);
+ }
+
+// Column data handed to ppl_expBatchRun(), which are converted into SI units as they are fetched
+typedef struct binaryColumns
+ {
+  const unsigned char *colStart;
+  uint64_t             Nrows;
+  pplObj              *colUnits;
+ } binaryColumns;
+
+static void ppldata_binaryFetch(void *arg, int colNum, long rowMin, long N, double *out)
+ {
+  const binaryColumns *b = (const binaryColumns *)arg;
+  const unsigned char *p = b->colStart + 8*((size_t)b->Nrows*(colNum-1) + rowMin);
+  const double         m = b->colUnits[colNum-1].real;
+  long                 r;
+  for (r=0; r<N; r++) out[r] = ppldata_binaryGetDouble(p + 8*r) * m;
+ }
+
+#define BINARY_CORRUPT { sprintf(errtext, "Binary datafile '%s' is corrupt or truncated.", filename); *status=1; if (DEBUG) ppl_log(&c->errcontext,errtext); return; }
+
+// Read a binary datafile which has been mapped into memory at <data>, passing each row through the using, select
+// and label expressions in the same way as ppldata_fromFile() does for text files. Where every using item either
+// selects a column, or is a pure numeric expression which ppl_expBatchCompile() accepts, the values are computed
+// a chunk of rows at a time and copied straight into the output table without involving the interpreter. Rows in
+// which the batch evaluator meets a non-finite value are passed through the interpreter individually.
+void ppldata_binaryRead(ppl_context *c, dataTable *out, const unsigned char *data, size_t len, char *filename, int indexNo, pplExpr **usingExprs, int autoUsingExprs, int Ncols, pplExpr *labelExpr, pplExpr *selectExpr, int usingRowCol, long *everyList, int continuity, int *status, char *errtext, int *errCount, int iterDepth)
+ {
+  const long linestep=everyList[0], blockstep=everyList[1], linefirst=everyList[2], blockfirst=everyList[3], linelast=everyList[4], blocklast=everyList[5];
+  const int  contextRough = ppl_memAlloc_GetMemContext();
+  const int  nUsing = out->Ncolumns_real + out->Ncolumns_obj;
+  size_t     pos = DATAFILE_BINARY_MAGICLEN;
+  long       index_number = -1, row_number = 0;
+  int        discontinuity = 1;
+
+  if (usingRowCol == DATAFILE_ROW) { sprintf(errtext, "Binary datafile '%s' cannot be read using rows.", filename); *status=1; if (DEBUG) ppl_log(&c->errcontext,errtext); return; }
+
+  while ((pos < len) && (!cancellationFlag))
+   {
+    int            NcolFile, NcolData, oneColumnInput, i, j, plain=1;
+    uint64_t       Nrows;
+    char         **colHeads;
+    pplObj        *colUnits, *colData;
+    int           *plainCol;
+    pplExprBatch  *batch;
+    double        *batchOut, *rowVals;
+    pplObj       **rowUnits;
+    unsigned char *bad;
+    binaryColumns  cols;
+    const unsigned char *colStart, *flags;
+    long           r;
+    long           linenumber_count=0, linenumber_stepcnt=0, block_count=0, block_stepcnt=0;
+
+    // Read table header
+    index_number++;
+    if ((len-pos < 16) || (memcmp(data+pos, "TABL", 4)!=0)) BINARY_CORRUPT;
+    NcolFile = (int)ppldata_binaryGet32(data+pos+4);
+    Nrows    = ppldata_binaryGet64(data+pos+8);
+    pos     += 16;
+    if ((NcolFile<0) || (NcolFile>MAX_DATACOLS)) BINARY_CORRUPT;
+
+    colHeads = (char  **)ppl_memAlloc_incontext((NcolFile+1)*sizeof(char *), contextRough);
+    colUnits = (pplObj *)ppl_memAlloc_incontext((NcolFile+1)*sizeof(pplObj), contextRough);
+    colData  = (pplObj *)ppl_memAlloc_incontext((NcolFile+2)*sizeof(pplObj), contextRough);
+    plainCol = (int    *)ppl_memAlloc_incontext((nUsing  +1)*sizeof(int   ), contextRough);
+    batch    = (pplExprBatch *)ppl_memAlloc_incontext((nUsing+1)*sizeof(pplExprBatch), contextRough);
+    batchOut = (double *)ppl_memAlloc_incontext((nUsing+1)*PPL_BATCH_CHUNK*sizeof(double), contextRough);
+    rowVals  = (double *)ppl_memAlloc_incontext((nUsing+1)*sizeof(double), contextRough);
+    rowUnits = (pplObj **)ppl_memAlloc_incontext((nUsing+1)*sizeof(pplObj *), contextRough);
+    bad      = (unsigned char *)ppl_memAlloc_incontext(PPL_BATCH_CHUNK, contextRough);
+    if ((colHeads==NULL)||(colUnits==NULL)||(colData==NULL)||(plainCol==NULL)||(batch==NULL)||(batchOut==NULL)||(rowVals==NULL)||(rowUnits==NULL)||(bad==NULL)) { strcpy(errtext, "Out of memory whilst reading binary datafile."); *status=1; if (DEBUG) ppl_log(&c->errcontext,errtext); return; }
+
+    for (i=0; i<2*NcolFile; i++)
+     {
+      uint32_t l;
+      char    *str;
+      if (len-pos < 4) BINARY_CORRUPT;
+      l = ppldata_binaryGet32(data+pos);
+      pos += 4;
+      if (len-pos < l) BINARY_CORRUPT;
+      str = (char *)ppl_memAlloc_incontext(l+1, contextRough);
+      if (str==NULL) { strcpy(errtext, "Out of memory whilst reading binary datafile."); *status=1; if (DEBUG) ppl_log(&c->errcontext,errtext); return; }
+      memcpy(str, data+pos, l);
+      str[l] = '\0';
+      pos += l;
+      if ((i%2)==0)
+       {
+        colHeads[i/2] = str;
+       }
+      else
+       {
+        int     end=0, errpos=-1;
+        pplObj *u = colUnits + i/2;
+        u->refCount = 1;
+        pplObjNum(u,0,1,0);
+        if (str[0]!='\0') ppl_unitsStringEvaluate(c, str, u, &end, &errpos, errtext);
+        if (errpos>=0)
+         {
+          pplObjNum(u,0,1,0);
+          if (*errCount>0) { (*errCount)--; sprintf(c->errcontext.tempErrStr,"%s: Column %d: %s",filename,i/2+1,errtext); ppl_warning(&c->errcontext,ERR_STACKED,NULL); }
+         }
+       }
+     }
+
+    // Locate column data and discontinuity flags
+    pos = ppldata_binaryPad(pos);
+    if ((pos>len) || ((NcolFile>0) && (Nrows > (len-pos)/8/NcolFile))) BINARY_CORRUPT;
+    colStart = data + pos;
+    pos     += (size_t)Nrows*8*NcolFile;
+    if (len-pos < Nrows) BINARY_CORRUPT;
+    flags    = data + pos;
+    pos      = ppldata_binaryPad(pos + (size_t)Nrows);
+
+    if (DEBUG) { sprintf(c->errcontext.tempErrStr, "Binary datafile index %ld has %d columns and %ld rows.", index_number, NcolFile, (long)Nrows); ppl_log(&c->errcontext,NULL); }
+    if ((indexNo>=0) && (index_number<indexNo)) continue;
+    if ((indexNo>=0) && (index_number>indexNo)) break;
+
+    // Add row numbers as first column to one-column datafiles, as for text datafiles
+    oneColumnInput = (NcolFile==1) && autoUsingExprs && (Ncols==2);
+    NcolData       = NcolFile + oneColumnInput;
+
+    // Work out whether every using item either simply selects a column, or can be evaluated over whole columns
+    if ((labelExpr!=NULL) || (selectExpr!=NULL) || (out->Ncolumns_obj>0) || oneColumnInput) plain=0;
+    for (j=0; (plain && (j<nUsing)); j++)
+     if ((plainCol[j] = ppldata_UsingPlainColumn(usingExprs[j], NcolFile, colHeads, NcolFile))<=0)
+      if ((plainCol[j]<0) || (ppl_expBatchCompile(c, usingExprs[j], NcolFile, colUnits, NcolFile, &batch[j])!=0)) plain=0;
+
+    // If earlier indices have already supplied data, only use the fast path if units are consistent with them;
+    // otherwise leave it to ppldata_ApplyUsingList to report the inconsistency
+    for (j=0; (plain && (j<nUsing)); j++)
+     {
+      rowUnits[j] = (plainCol[j]>0) ? &colUnits[plainCol[j]-1] : &batch[j].unit;
+      if ((out->Nrows>0) && ((out->firstEntries[j].objType!=PPLOBJ_NUM) || (!ppl_unitsDimEqual(&out->firstEntries[j], rowUnits[j])))) plain=0;
+     }
+    cols.colStart = colStart;
+    cols.Nrows    = Nrows;
+    cols.colUnits = colUnits;
+
+    for (i=0; i<NcolData+1; i++) { colData[i].refCount=1; pplObjNum(colData+i,0,0,0); }
+    for (i=0; i<NcolFile; i++) ppl_unitsDimCpy(colData+i+1+oneColumnInput, colUnits+i);
+    discontinuity = 1;
+
+    for (r=0; r<(long)Nrows; r++)
+     {
+      const int rc = r % PPL_BATCH_CHUNK;
+      row_number++;
+      if (cancellationFlag) break;
+      if (plain && (rc==0))
+       {
+        const long n = ((long)Nrows-r < PPL_BATCH_CHUNK) ? ((long)Nrows-r) : PPL_BATCH_CHUNK;
+        memset(bad, 0, n);
+        for (j=0; j<nUsing; j++)
+         if (plainCol[j]<=0)
+          ppl_expBatchRun(&batch[j], ppldata_binaryFetch, &cols, r, n, batchOut + j*PPL_BATCH_CHUNK, bad);
+       }
+      if ((r>0) && (flags[r]&1))
+       {
+        block_count++; // A discontinuity gives us a new block
+        block_stepcnt = ((block_stepcnt-1) % blockstep);
+        discontinuity=1;
+        linenumber_count=0;
+        linenumber_stepcnt=0;
+       }
+
+      // If we're in a block that we're ignoring, don't do anything with this row
+      if ((block_stepcnt!=0) || ((blockfirst>=0)&&(block_count<blockfirst)) || ((blocklast>=0)&&(block_count>blocklast))) continue;
+
+      if ((linenumber_stepcnt==0) && ((linefirst<0)||(linenumber_count>=linefirst)) && ((linelast<0)||(linenumber_count<=linelast)))
+       {
+        if (plain && !bad[rc])
+         {
+          for (j=0; j<nUsing; j++)
+           {
+            const int col = plainCol[j]-1;
+            if (col>=0) rowVals[j] = ppldata_binaryGetDouble(colStart + 8*((size_t)Nrows*col + r)) * colUnits[col].real;
+            else        rowVals[j] = batchOut[j*PPL_BATCH_CHUNK + rc];
+           }
+          if (ppldata_AddNumericRow(out, rowVals, rowUnits, row_number, discontinuity)) { sprintf(errtext, "%s: Out of memory storing data table.", filename); *status=1; if (DEBUG) ppl_log(&c->errcontext,errtext); return; }
+          discontinuity = 0;
+         }
+        else
+         {
+          if (oneColumnInput) colData[1].real = row_number;
+          for (i=0; i<NcolFile; i++) colData[i+1+oneColumnInput].real = ppldata_binaryGetDouble(colStart + 8*((size_t)Nrows*i + r)) * colUnits[i].real;
+          colData[0].real = linenumber_count;
+          ppldata_ApplyUsingList(c, out, usingExprs, labelExpr, selectExpr, NULL, continuity, &discontinuity, NULL, colData, NcolData, filename, row_number, NULL, linenumber_count, block_count, index_number, DATAFILE_COL, colHeads, NcolFile, NULL, 0, status, errtext, errCount, iterDepth);
+          if (*status) { *status=0; /* It was just a warning... */ }
+          if (*errCount<0) { *status=1; return; }
+         }
+       }
+      linenumber_count++;
+      linenumber_stepcnt = ((linenumber_stepcnt-1) % linestep);
+     }
+    if (indexNo>=0) break;
+   }
+  return;
+ }
+
+// Routines for writing binary datafiles, used by the tabulate command
+
+static int ppldata_binaryPut32(FILE *f, uint32_t x)
+ {
+  unsigned char b[4];
+  b[0]=x&255; b[1]=(x>>8)&255; b[2]=(x>>16)&255; b[3]=(x>>24)&255;
+  return fwrite(b,1,4,f)!=4;
+ }
+
+static int ppldata_binaryPut64(FILE *f, uint64_t x)
+ {
+  return ppldata_binaryPut32(f, (uint32_t)(x&0xffffffff)) || ppldata_binaryPut32(f, (uint32_t)(x>>32));
+ }
+
+int ppldata_binaryWriteMagic(FILE *f)
+ {
+  return fwrite(DATAFILE_BINARY_MAGIC,1,DATAFILE_BINARY_MAGICLEN,f)!=DATAFILE_BINARY_MAGICLEN;
+ }
+
+// Write the header of a table. Names and units may be NULL, in which case they are written as empty strings.
+int ppldata_binaryWriteTable(FILE *f, int Ncols, long Nrows, char **names, char **units)
+ {
+  int i, fail=0;
+  fail |= (fwrite("TABL",1,4,f)!=4);
+  fail |= ppldata_binaryPut32(f, (uint32_t)Ncols);
+  fail |= ppldata_binaryPut64(f, (uint64_t)Nrows);
+  for (i=0; i<Ncols; i++)
+   {
+    const char *n = ((names!=NULL)&&(names[i]!=NULL)) ? names[i] : "";
+    const char *u = ((units!=NULL)&&(units[i]!=NULL)) ? units[i] : "";
+    fail |= ppldata_binaryPut32(f, (uint32_t)strlen(n)); fail |= (fwrite(n,1,strlen(n),f)!=strlen(n));
+    fail |= ppldata_binaryPut32(f, (uint32_t)strlen(u)); fail |= (fwrite(u,1,strlen(u),f)!=strlen(u));
+   }
+  fail |= ppldata_binaryWritePad(f);
+  return fail;
+ }
+
+int ppldata_binaryWriteDouble(FILE *f, double x)
+ {
+  uint64_t u;
+  memcpy(&u, &x, sizeof(double));
+  return ppldata_binaryPut64(f, u);
+ }
+
+int ppldata_binaryWriteFlag(FILE *f, unsigned char split)
+ {
+  return fputc(split?1:0, f)==EOF;
+ }
+
+// Pad file with zeros to a multiple of eight bytes from its start
+int ppldata_binaryWritePad(FILE *f)
+ {
+  long pos = ftell(f);
+  if (pos<0) return 1;
+  while (pos%8) { if (fputc(0,f)==EOF) return 1; pos++; }
+  return 0;
+ }
+
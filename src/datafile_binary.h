@@ -0,0 +1,58 @@
+// datafile_binary.h
+//
+// The code in this file is part of Pyxplot
+// <http://www.pyxplot.org.uk>
+//
+// Copyright (C) 2006-2013 Dominic Ford <coders@pyxplot.org.uk>
+//               2008-2013 Ross Church
+//
+// $Id$
+//
+// Pyxplot is free software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation; either version 2 of the License, or (at your option) any later
+// version.
+//
+// You should have received a copy of the GNU General Public License along with
+// Pyxplot; if not, write to the Free Software Foundation, Inc., 51 Franklin
+// Street, Fifth Floor, Boston, MA  02110-1301, USA
+
+// ----------------------------------------------------------------------------
+
+// Pyxplot's binary columnar datafile format. All integers and floating-point values are little-endian.
+//
+// File   := magic[8] = "PYXBIN1\n", followed by one or more tables. Each table is an index of the datafile.
+// Table  := "TABL", uint32 Ncolumns, uint64 Nrows,
+//           Ncolumns x { uint32 nameLength, name, uint32 unitLength, unit },
+//           zero padding to a multiple of 8 bytes from the start of the file,
+//           Ncolumns x Nrows float64 values, stored column by column,
+//           Nrows flag bytes, with bit 0 set where the data has a discontinuity before that row,
+//           zero padding to a multiple of 8 bytes from the start of the file.
+//
+// Column names may be empty. Units are written in the same form as in '# ColumnUnits:' lines of text datafiles,
+// and each value is multiplied by its column's unit when read, so that a value of 3 in a column with units of
+// "km" reads as 3 km.
+
+#ifndef _DATAFILE_BINARY_H
+#define _DATAFILE_BINARY_H 1
+
+#include <stdio.h>
+
+#include "datafile.h"
+#include "parser/parser.h"
+#include "userspace/context.h"
+
+#define DATAFILE_BINARY_MAGIC    "PYXBIN1\n"
+#define DATAFILE_BINARY_MAGICLEN 8
+
+int  ppldata_binaryIsBinary   (const unsigned char *data, size_t len);
+void ppldata_binaryRead       (ppl_context *c, dataTable *out, const unsigned char *data, size_t len, char *filename, int indexNo, pplExpr **usingExprs, int autoUsingExprs, int Ncols, pplExpr *labelExpr, pplExpr *selectExpr, int usingRowCol, long *everyList, int continuity, int *status, char *errtext, int *errCount, int iterDepth);
+
+int  ppldata_binaryWriteMagic (FILE *f);
+int  ppldata_binaryWriteTable (FILE *f, int Ncols, long Nrows, char **names, char **units);
+int  ppldata_binaryWriteDouble(FILE *f, double x);
+int  ppldata_binaryWriteFlag  (FILE *f, unsigned char split);
+int  ppldata_binaryWritePad   (FILE *f);
+
+#endif
+
@@ -0,0 +1,382 @@
+// datafile_cache.c
+//
+// The code in this file is part of Pyxplot
+// <http://www.pyxplot.org.uk>
+//
+// Copyright (C) 2006-2013 Dominic Ford <coders@pyxplot.org.uk>
+//               2008-2013 Ross Church
+//
+// $Id$
+//
+// Pyxplot is free software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation; either version 2 of the License, or (at your option) any later
+// version.
+//
+// You should have received a copy of the GNU General Public License along with
+// Pyxplot; if not, write to the Free Software Foundation, Inc., 51 Franklin
+// Street, Fifth Floor, Boston, MA  02110-1301, USA
+
+// ----------------------------------------------------------------------------
+
+// A cache of the tables of data read from datafiles, so that replotting, or drawing several panels of a multiplot
+// from the same datafile, does not re-read and re-parse the file each time. Tables are keyed on the identity of the
+// file (its name, inode, size and modification time), on the input filter used to read it, on the index, every,
+// using, select and label modifiers, and on the values of any variables which these expressions refer to. Expressions
+// which call user-defined functions, or dereference modules or other objects, cannot be captured in a key, and so
+// data read using them is never cached. Tables are held in single malloced buffers, outside of ppl_memAlloc's
+// contexts, and are copied into the caller's memory context when fetched, so that callers may modify them freely.
+
+#define _DATAFILE_CACHE_C 1
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include "coreUtils/dict.h"
+#include "coreUtils/errorReport.h"
+#include "coreUtils/memAlloc.h"
+#include "expressions/expCompile.h"
+#include "settings/settings.h"
+#include "stringTools/strConstants.h"
+#include "userspace/context.h"
+#include "userspace/pplObj.h"
+#include "userspace/pplObjFunc.h"
+
+#include "datafile.h"
+#include "datafile_cache.h"
+
+// Sub-second part of a file's modification time, so that a file rewritten within the same second is not served stale
+#if defined(__APPLE__)
+#define PPLDATA_MTIME_NSEC(s) ((long)(s).st_mtimespec.tv_nsec)
+#elif defined(st_mtime)
+#define PPLDATA_MTIME_NSEC(s) ((long)(s).st_mtim.tv_nsec)
+#else
+#define PPLDATA_MTIME_NSEC(s) 0L
+#endif
+
+typedef struct ppldata_cacheKey {
+  char   *buf;
+  size_t  len, alloc;
+  int     fail;
+ } ppldata_cacheKey;
+
+typedef struct ppldata_cacheEntry {
+  char                      *key;
+  size_t                     keyLen;
+  unsigned long              hash;
+  size_t                     bytes;  // Total memory held by this entry
+  dataTable                 *table;  // Points into buffer
+  unsigned char             *buffer;
+  struct ppldata_cacheEntry *prev, *next;
+ } ppldata_cacheEntry;
+
+// Cache entries are kept in a list, most recently used first
+static ppldata_cacheEntry *cacheHead=NULL, *cacheTail=NULL;
+static int                 cacheNentries=0;
+static long                cacheBytes=0, cacheHits=0, cacheMisses=0;
+
+#define CACHE_ALIGN(X) (((X)+7) & ~((size_t)7))
+
+static void ppldata_cacheKeyAdd(ppldata_cacheKey *k, const char *fmt, ...)
+ {
+  va_list ap;
+  int     n = -1;
+  while (!k->fail)
+   {
+    if (k->buf!=NULL)
+     {
+      va_start(ap, fmt);
+      n = vsnprintf(k->buf+k->len, k->alloc-k->len, fmt, ap);
+      va_end(ap);
+      if (n<0) { k->fail=1; return; }
+      if ((size_t)n < k->alloc-k->len) { k->len+=n; return; }
+     }
+     {
+      size_t newAlloc = 2*k->alloc + ((n>0)?n:0) + 1024;
+      char  *newBuf   = (char *)realloc(k->buf, newAlloc);
+      if (newBuf==NULL) { k->fail=1; return; }
+      k->buf   = newBuf;
+      k->alloc = newAlloc;
+     }
+   }
+ }
+
+// Add the value of a variable to a cache key. Returns zero if the variable is of a type whose value we don't capture.
+static int ppldata_cacheKeyObj(ppldata_cacheKey *k, char *name, pplObj *obj)
+ {
+  int i;
+  if (obj==NULL) { ppldata_cacheKeyAdd(k, "%s=?;", name); return 1; } // Undefined; may be a column name
+  switch (obj->objType)
+   {
+    case PPLOBJ_NUM:
+      ppldata_cacheKeyAdd(k, "%s=n%a,%a,%d,%d,%d", name, obj->real, obj->imag, obj->flagComplex, obj->dimensionless, obj->tempType);
+      if (!obj->dimensionless) for (i=0; i<UNITS_MAX_BASEUNITS; i++) ppldata_cacheKeyAdd(k, ",%a", obj->exponent[i]);
+      ppldata_cacheKeyAdd(k, ";");
+      return 1;
+    case PPLOBJ_BOOL:
+    case PPLOBJ_DATE:
+      ppldata_cacheKeyAdd(k, "%s=%d:%a;", name, obj->objType, obj->real);
+      return 1;
+    case PPLOBJ_STR:
+      ppldata_cacheKeyAdd(k, "%s=s%ld:%s;", name, (long)strlen((char *)obj->auxil), (char *)obj->auxil);
+      return 1;
+    case PPLOBJ_FUNC:
+     {
+      pplFunc *f = (pplFunc *)obj->auxil;
+      if ((f==NULL) || (f->functionType!=PPL_FUNC_SYSTEM) || (f->next!=NULL)) return 0; // User-defined functions may refer to anything
+      ppldata_cacheKeyAdd(k, "%s=f%p;", name, f->functionPtr);
+      return 1;
+     }
+    default:
+      return 0;
+   }
+ }
+
+// Add an expression, and the values of all of the variables which it refers to, to a cache key. Returns zero if the
+// value of the expression may depend on things which we don't capture.
+static int ppldata_cacheKeyExpr(ppl_context *c, ppldata_cacheKey *k, pplExpr *e)
+ {
+  pplExprBytecode *in;
+  int              j;
+
+  if (e==NULL) { ppldata_cacheKeyAdd(k, "-;"); return 1; }
+  if ((e->ascii==NULL) || (e->bytecode==NULL)) return 0;
+  ppldata_cacheKeyAdd(k, "%ld:%s;", (long)strlen(e->ascii), e->ascii);
+  in = (pplExprBytecode *)e->bytecode;
+  for (j=0; in[j].opcode!=0; j+=in[j].len)
+   {
+    const int o = in[j].opcode;
+    if ((o==4)||(o==5)||(o==6)||(o==12)||(o==13)) return 0; // Assignments, and dereferences of modules and objects
+    if (o==3) // Variable lookup; search namespaces in the same order as ppl_expEval()
+     {
+      char   *key = (char *)&(in[j+1]);
+      pplObj *obj = NULL;
+      int     i;
+      for (i=c->ns_ptr ; i>=0 ; i=(i>1)?1:i-1)
+       {
+        obj = (pplObj *)ppl_dictLookup(c->namespaces[i] , key);
+        if ((obj!=NULL) && (obj->objType!=PPLOBJ_GLOB) && (obj->objType!=PPLOBJ_ZOM)) break;
+        obj = NULL;
+       }
+      if (!ppldata_cacheKeyObj(k, key, obj)) return 0;
+     }
+   }
+  return 1;
+ }
+
+// Lay out a data table with a single block of Nrows rows in the buffer buf, and return the number of bytes it
+// takes up. If buf is NULL, just return the number of bytes needed.
+static size_t ppldata_cacheLayout(unsigned char *buf, int Ncols, long Nrows, dataTable **tabOut)
+ {
+  size_t     pos = 0;
+  dataTable *t   = NULL;
+  dataBlock *b   = NULL;
+
+#define CACHE_CARVE(P,T,N) { if (buf!=NULL) P=(T *)(buf+pos); pos+=CACHE_ALIGN((N)*sizeof(T)); }
+
+  CACHE_CARVE(t, dataTable, 1);
+  CACHE_CARVE(b, dataBlock, 1);
+  if (buf!=NULL)
+   {
+    t->Ncolumns_real = Ncols;
+    t->Ncolumns_obj  = 0;
+    t->Nrows         = 0;
+    t->memContext    = -1; // Not in any memory context; rows must never be added to a cached table
+    t->first         = t->current = b;
+    b->data_obj      = NULL;
+    b->fileLine_obj  = NULL;
+    b->blockLength   = Nrows+1;
+    b->blockPosition = 0;
+    b->next          = b->prev = NULL;
+   }
+  CACHE_CARVE(t->firstEntries , pplObj       , Ncols);
+  CACHE_CARVE(b->data_real    , double       , (Nrows+1)*Ncols);
+  CACHE_CARVE(b->fileLine_real, long int     , (Nrows+1)*Ncols);
+  CACHE_CARVE(b->text         , char *       , Nrows+1);
+  CACHE_CARVE(b->split        , unsigned char, Nrows+1);
+  if (tabOut!=NULL) *tabOut = t;
+  return pos;
+ }
+
+// Copy the rows of the table in into the table out, which must have a single block with room for all of them. If
+// strBuf is not NULL, labels are copied into it; otherwise they are allocated in out's memory context.
+static int ppldata_cacheCopyRows(dataTable *in, dataTable *out, char *strBuf)
+ {
+  const int  Nc = in->Ncolumns_real;
+  dataBlock *blk, *o = out->first;
+  long       p = 0, i;
+
+  memcpy(out->firstEntries, in->firstEntries, Nc*sizeof(pplObj));
+  for (blk=in->first; blk!=NULL; blk=blk->next)
+   {
+    const long n = blk->blockPosition;
+    memcpy(o->data_real     + p*Nc, blk->data_real    , n*Nc*sizeof(double));
+    memcpy(o->fileLine_real + p*Nc, blk->fileLine_real, n*Nc*sizeof(long int));
+    memcpy(o->split         + p   , blk->split        , n);
+    for (i=0; i<n; i++)
+     {
+      char *s = blk->text[i], *t = NULL;
+      if (s!=NULL)
+       {
+        if (strBuf!=NULL) { t = strBuf; strBuf += strlen(s)+1; }
+        else if ((t = (char *)ppl_memAlloc_incontext(strlen(s)+1, out->memContext))==NULL) return 1;
+        strcpy(t, s);
+       }
+      o->text[p+i] = t;
+     }
+    p += n;
+   }
+  o->blockPosition = p;
+  out->Nrows       = p;
+  return 0;
+ }
+
+static void ppldata_cacheUnlink(ppldata_cacheEntry *e)
+ {
+  if (e->prev!=NULL) e->prev->next = e->next; else cacheHead = e->next;
+  if (e->next!=NULL) e->next->prev = e->prev; else cacheTail = e->prev;
+  e->prev = e->next = NULL;
+ }
+
+static void ppldata_cachePushFront(ppldata_cacheEntry *e)
+ {
+  e->prev = NULL;
+  e->next = cacheHead;
+  if (cacheHead!=NULL) cacheHead->prev = e; else cacheTail = e;
+  cacheHead = e;
+ }
+
+// Discard least recently used tables until the cache holds no more than maxBytes
+void ppldata_cacheTrim(long maxBytes)
+ {
+  while ((cacheTail!=NULL) && (cacheBytes>maxBytes))
+   {
+    ppldata_cacheEntry *e = cacheTail;
+    ppldata_cacheUnlink(e);
+    cacheBytes -= e->bytes;
+    cacheNentries--;
+    free(e->buffer);
+    free(e->key);
+    free(e);
+   }
+ }
+
+void ppldata_cacheStats(int *Nentries, long *bytes, long *hits, long *misses)
+ {
+  if (Nentries!=NULL) *Nentries = cacheNentries;
+  if (bytes   !=NULL) *bytes    = cacheBytes;
+  if (hits    !=NULL) *hits     = cacheHits;
+  if (misses  !=NULL) *misses   = cacheMisses;
+ }
+
+// Returns one if the cache holds any table read from the present contents of a file, which should already have had
+// wildcards expanded. Used to avoid reading files in the background which are likely not to need reading at all.
+int ppldata_cacheHoldsFile(ppl_context *c, char *filename)
+ {
+  ppldata_cacheKey    k = {NULL,0,0,0};
+  ppldata_cacheEntry *e;
+  struct stat         st;
+  char               *filter;
+
+  if ((cacheHead==NULL) || (stat(filename, &st)!=0)) return 0;
+  filter = ppldata_filterFor(c, filename);
+  ppldata_cacheKeyAdd(&k, "%s\n%lu:%lu:%ld:%ld.%09ld\n%s\n", filename, (unsigned long)st.st_dev, (unsigned long)st.st_ino, (long)st.st_size, (long)st.st_mtime, PPLDATA_MTIME_NSEC(st), (filter==NULL)?"":filter);
+  if (k.fail) { free(k.buf); return 0; }
+  for (e=cacheHead; e!=NULL; e=e->next) if ((e->keyLen>=k.len) && (memcmp(e->key, k.buf, k.len)==0)) break;
+  free(k.buf);
+  return e!=NULL;
+ }
+
+// Store a copy of a table in the cache. Takes ownership of the key's buffer.
+static void ppldata_cacheStore(ppldata_cacheKey *k, unsigned long hash, dataTable *in, long maxBytes)
+ {
+  ppldata_cacheEntry *e;
+  dataBlock          *blk;
+  size_t              strBytes=0, tabBytes;
+  long                i;
+
+  for (blk=in->first; blk!=NULL; blk=blk->next) for (i=0; i<blk->blockPosition; i++) if (blk->text[i]!=NULL) strBytes += strlen(blk->text[i])+1;
+  tabBytes = ppldata_cacheLayout(NULL, in->Ncolumns_real, in->Nrows, NULL);
+  if ((long)(tabBytes + strBytes + k->len + sizeof(ppldata_cacheEntry)) > maxBytes) { free(k->buf); return; } // Would never fit
+
+  e = (ppldata_cacheEntry *)malloc(sizeof(ppldata_cacheEntry));
+  if (e==NULL) { free(k->buf); return; }
+  e->buffer = (unsigned char *)malloc(tabBytes + strBytes);
+  if (e->buffer==NULL) { free(e); free(k->buf); return; }
+  ppldata_cacheLayout(e->buffer, in->Ncolumns_real, in->Nrows, &e->table);
+  ppldata_cacheCopyRows(in, e->table, (char *)(e->buffer + tabBytes));
+  e->key    = k->buf;
+  e->keyLen = k->len;
+  e->hash   = hash;
+  e->bytes  = tabBytes + strBytes + k->len + sizeof(ppldata_cacheEntry);
+
+  ppldata_cacheTrim(maxBytes - e->bytes);
+  ppldata_cachePushFront(e);
+  cacheBytes += e->bytes;
+  cacheNentries++;
+ }
+
+// Read a datafile, as ppldata_fromFile() does, but fetch the table from the cache if the same file has previously
+// been read with the same modifiers, and store it in the cache if not.
+void ppldata_fromFileCached(ppl_context *c, dataTable **out, char *filename, char *filenameOut, int indexNo, pplExpr **usingExprs, int autoUsingExprs, int Ncols, int NusingObjs, pplExpr *labelExpr, pplExpr *selectExpr, int usingRowCol, long *everyList, int continuity, int *status, char *errtext, int *errCount, int iterDepth)
+ {
+  const long          maxBytes   = ((long)c->set->term_current.datacache) << 20;
+  const int           errCountIn = *errCount;
+  ppldata_cacheKey    k          = {NULL,0,0,0};
+  ppldata_cacheEntry *e;
+  unsigned long       hash       = 5381;
+  char               *resolved   = NULL, *filter;
+  struct stat         st, st2;
+  int                 i, cacheable = 0;
+
+  // Data read from pipes, or from objects such as user-defined functions, may not be reproducible
+  if ((maxBytes>0) && (NusingObjs==0) && (strcmp(filename,"-")!=0) && (strcmp(filename,"--")!=0))
+   {
+    resolved = ppldata_globFilename(c, filename, 0, NULL, errtext);
+    if ((resolved!=NULL) && (stat(resolved, &st)==0) && S_ISREG(st.st_mode))
+     {
+      filter = ppldata_filterFor(c, resolved);
+      ppldata_cacheKeyAdd(&k, "%s\n%lu:%lu:%ld:%ld.%09ld\n%s\n", resolved, (unsigned long)st.st_dev, (unsigned long)st.st_ino, (long)st.st_size, (long)st.st_mtime, PPLDATA_MTIME_NSEC(st), (filter==NULL)?"":filter);
+      ppldata_cacheKeyAdd(&k, "%d:%d:%d:%d:%d:%d:%d:%d\n", indexNo, autoUsingExprs, Ncols, usingRowCol, continuity, c->set->term_current.ComplexNumbers, c->set->term_current.ExplicitErrors, c->set->term_current.UnitAngleDimless);
+      for (i=0; i<6; i++) ppldata_cacheKeyAdd(&k, "%ld,", everyList[i]);
+      cacheable = ppldata_cacheKeyExpr(c, &k, labelExpr) && ppldata_cacheKeyExpr(c, &k, selectExpr);
+      for (i=0; (i<Ncols) && cacheable; i++) cacheable = ppldata_cacheKeyExpr(c, &k, usingExprs[i]);
+      if (k.fail) cacheable = 0;
+     }
+   }
+
+  if (cacheable)
+   {
+    size_t p;
+    for (p=0; p<k.len; p++) hash = ((hash << 5) + hash) + (unsigned char)k.buf[p];
+    for (e=cacheHead; e!=NULL; e=e->next) if ((e->hash==hash) && (e->keyLen==k.len) && (memcmp(e->key, k.buf, k.len)==0)) break;
+    if (e!=NULL)
+     {
+      if (DEBUG) { sprintf(c->errcontext.tempErrStr, "Fetched data from file '%s' from cache.", resolved); ppl_log(&c->errcontext,NULL); }
+      cacheHits++;
+      free(k.buf);
+      ppldata_cacheUnlink(e);
+      ppldata_cachePushFront(e);
+      *status = 0;
+      *out    = ppldata_NewDataTable(e->table->Ncolumns_real, 0, ppl_memAlloc_GetMemContext(), e->table->Nrows+1);
+      if ((*out==NULL) || ppldata_cacheCopyRows(e->table, *out, NULL)) { strcpy(errtext, "Out of memory whilst fetching data table from cache."); *status=1; return; }
+      if (filenameOut!=NULL) { strncpy(filenameOut, resolved, FNAME_LENGTH); filenameOut[FNAME_LENGTH-1]='\0'; }
+      return;
+     }
+    cacheMisses++;
+   }
+
+  ppldata_fromFile(c, out, filename, 0, filenameOut, NULL, indexNo, usingExprs, autoUsingExprs, Ncols, NusingObjs, labelExpr, selectExpr, NULL, usingRowCol, everyList, continuity, 0, status, errtext, errCount, iterDepth);
+
+  // Only cache data which was read completely and without warnings, from a file which didn't change while we read it
+  if (cacheable && (*status==0) && (*errCount==errCountIn) && (!cancellationFlag) && (*out!=NULL) && ((*out)->Ncolumns_obj==0) &&
+      (stat(resolved, &st2)==0) && (st2.st_ino==st.st_ino) && (st2.st_size==st.st_size) && (st2.st_mtime==st.st_mtime) && (PPLDATA_MTIME_NSEC(st2)==PPLDATA_MTIME_NSEC(st)))
+   { ppldata_cacheStore(&k, hash, *out, maxBytes); }
+  else
+   { free(k.buf); }
+  return;
+ }
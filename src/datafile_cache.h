@@ -0,0 +1,37 @@
+// datafile_cache.h
+//
+// The code in this file is part of Pyxplot
+// <http://www.pyxplot.org.uk>
+//
+// Copyright (C) 2006-2013 Dominic Ford <coders@pyxplot.org.uk>
+//               2008-2013 Ross Church
+//
+// $Id$
+//
+// Pyxplot is free software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation; either version 2 of the License, or (at your option) any later
+// version.
+//
+// You should have received a copy of the GNU General Public License along with
+// Pyxplot; if not, write to the Free Software Foundation, Inc., 51 Franklin
+// Street, Fifth Floor, Boston, MA  02110-1301, USA
+
+// ----------------------------------------------------------------------------
+
+#ifndef _DATAFILE_CACHE_H
+#define _DATAFILE_CACHE_H 1
+
+#include "datafile.h"
+#include "expressions/expCompile.h"
+#include "userspace/context.h"
+
+// Default maximum size of the cache of parsed datafiles, in megabytes
+#define DATAFILE_CACHE_DEFAULT 64
+
+void ppldata_fromFileCached(ppl_context *c, dataTable **out, char *filename, char *filenameOut, int indexNo, pplExpr **usingExprs, int autoUsingExprs, int Ncols, int NusingObjs, pplExpr *labelExpr, pplExpr *selectExpr, int usingRowCol, long *everyList, int continuity, int *status, char *errtext, int *errCount, int iterDepth);
+void ppldata_cacheTrim     (long maxBytes);
+void ppldata_cacheStats    (int *Nentries, long *bytes, long *hits, long *misses);
+int  ppldata_cacheHoldsFile(ppl_context *c, char *filename);
+
+#endif
@@ -0,0 +1,213 @@
+// datafile_prefetch.c
+//
+// The code in this file is part of Pyxplot
+// <http://www.pyxplot.org.uk>
+//
+// Copyright (C) 2006-2013 Dominic Ford <coders@pyxplot.org.uk>
+//               2008-2013 Ross Church
+//
+// $Id$
+//
+// Pyxplot is free software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation; either version 2 of the License, or (at your option) any later
+// version.
+//
+// You should have received a copy of the GNU General Public License along with
+// Pyxplot; if not, write to the Free Software Foundation, Inc., 51 Franklin
+// Street, Fifth Floor, Boston, MA  02110-1301, USA
+
+// ----------------------------------------------------------------------------
+
+// When many datafiles are to be read one after another, for example when plotting 'run_*.dat', the text of each
+// file is read and split into stripped lines by a pool of background threads, while the interpreter evaluates using
+// expressions on files which have already been read. Only the reading of text happens in the background; using
+// expressions are still evaluated by ppldata_fromFile() on the main thread, in the same order as before, and so
+// output is identical. Threads only read files which the interpreter will soon need, so that the text of at most
+// a few files is held in memory at once.
+
+#define _DATAFILE_PREFETCH_C 1
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include <sys/stat.h>
+
+#include "coreUtils/workerPool.h"
+#include "settings/settings.h"
+#include "stringTools/strConstants.h"
+#include "userspace/context.h"
+
+#include "datafile_binary.h"
+#include "datafile_prefetch.h"
+#include "datafile_stream.h"
+
+#define PREFETCH_MAXTHREADS 64
+
+#define PREFETCH_WAITING 0
+#define PREFETCH_READING 1
+#define PREFETCH_READY   2
+#define PREFETCH_FAILED  3
+#define PREFETCH_TAKEN   4
+
+typedef struct prefetchFile {
+  char          *filename;
+  unsigned char *lines;    // Stripped lines, each terminated by a null
+  size_t         len;
+  int            state;
+ } prefetchFile;
+
+static prefetchFile   *pfFiles    = NULL;
+static int             pfN        = 0;
+static int             pfNext     = 0; // Next file to be read by a thread
+static int             pfConsumed = 0; // One more than the index of the last file taken by the interpreter
+static int             pfAhead    = 0;
+static int             pfStop     = 0;
+static int             pfNthreads = 0;
+static pthread_t       pfThreads[PREFETCH_MAXTHREADS];
+static pthread_mutex_t pfLock     = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  pfCond     = PTHREAD_COND_INITIALIZER;
+
+// Read a file into a buffer of stripped lines. Returns zero on failure, or if the file is in a format which
+// ppldata_fromFile() must read for itself. Must not touch any interpreter state, since it runs in a worker thread.
+static int ppldata_prefetchRead(prefetchFile *f, char *line)
+ {
+  FILE           *file;
+  ppldata_stream *s;
+  unsigned char  *buf = NULL;
+  size_t          len = 0, alloc = 0;
+  int             ok  = 1;
+
+  if ((file = fopen(f->filename, "r"))==NULL) return 0;
+  if ((s = ppldata_streamOpen(file))==NULL) { fclose(file); return 0; }
+  if (ppldata_binaryIsBinary(s->map, s->mapLen)) { ppldata_streamClose(s); fclose(file); return 0; }
+
+  while (ppldata_streamReadLine(s, line, LSTR_LENGTH))
+   {
+    size_t l = strlen(line)+1;
+    if (len+l > alloc)
+     {
+      size_t         newAlloc = (alloc<65536) ? 65536 : 2*alloc;
+      unsigned char *newBuf;
+      while (newAlloc < len+l) newAlloc*=2;
+      if ((newBuf = (unsigned char *)realloc(buf, newAlloc))==NULL) { ok=0; break; }
+      buf   = newBuf;
+      alloc = newAlloc;
+     }
+    memcpy(buf+len, line, l);
+    len += l;
+   }
+  ppldata_streamClose(s);
+  fclose(file);
+  if (!ok) { free(buf); return 0; }
+  if (buf==NULL) buf = (unsigned char *)malloc(1); // An empty file
+  if (buf==NULL) return 0;
+  f->lines = buf;
+  f->len   = len;
+  return 1;
+ }
+
+static void *ppldata_prefetchMain(void *arg)
+ {
+  char *line = (char *)malloc(LSTR_LENGTH);
+  if (line==NULL) return NULL;
+  pthread_mutex_lock(&pfLock);
+  while ((!pfStop) && (pfNext<pfN))
+   {
+    int i, ok;
+    if (pfNext >= pfConsumed + pfAhead) { pthread_cond_wait(&pfCond, &pfLock); continue; } // Don't read too far ahead
+    i = pfNext++;
+    if (pfFiles[i].state!=PREFETCH_WAITING) continue; // The interpreter has already read this file for itself
+    pfFiles[i].state = PREFETCH_READING;
+    pthread_mutex_unlock(&pfLock);
+    ok = ppldata_prefetchRead(&pfFiles[i], line);
+    pthread_mutex_lock(&pfLock);
+    pfFiles[i].state = ok ? PREFETCH_READY : PREFETCH_FAILED;
+    pthread_cond_broadcast(&pfCond);
+   }
+  pthread_mutex_unlock(&pfLock);
+  free(line);
+  return NULL;
+ }
+
+// Start reading a list of files in the background, in the order in which they are listed. Filenames should already
+// have had wildcards expanded, and files which need input filters should not be included. Does nothing if the
+// setting <set threads> asks for only one thread, or if files are already being read in the background.
+void ppldata_prefetchStart(ppl_context *c, char **filenames, int N)
+ {
+  int         i, Nthreads = ppl_workerCount(c->set->term_current.threads);
+  struct stat st;
+
+  if ((pfFiles!=NULL) || (N<2) || (Nthreads<=1)) return;
+  if (Nthreads>N                  ) Nthreads=N;
+  if (Nthreads>PREFETCH_MAXTHREADS) Nthreads=PREFETCH_MAXTHREADS;
+
+  pfFiles = (prefetchFile *)malloc(N*sizeof(prefetchFile));
+  if (pfFiles==NULL) return;
+  for (i=0; i<N; i++)
+   {
+    pfFiles[i].filename = (char *)malloc(strlen(filenames[i])+1);
+    pfFiles[i].lines    = NULL;
+    pfFiles[i].len      = 0;
+    pfFiles[i].state    = PREFETCH_WAITING;
+    if (pfFiles[i].filename==NULL) { pfN=i; ppldata_prefetchFinish(); return; }
+    strcpy(pfFiles[i].filename, filenames[i]);
+    if ((stat(filenames[i], &st)!=0) || (!S_ISREG(st.st_mode))) pfFiles[i].state = PREFETCH_FAILED; // Don't block on pipes
+   }
+  pfN        = N;
+  pfNext     = 0;
+  pfConsumed = 0;
+  pfAhead    = DATAFILE_PREFETCH_AHEAD * Nthreads;
+  pfStop     = 0;
+  for (pfNthreads=0; pfNthreads<Nthreads; pfNthreads++)
+    if (pthread_create(&pfThreads[pfNthreads], NULL, ppldata_prefetchMain, NULL)!=0) break;
+  if (pfNthreads==0) ppldata_prefetchFinish();
+  return;
+ }
+
+// Return a reader on the text of a file which has been read in the background, waiting for a thread to finish
+// reading it if necessary. Returns NULL if the file is not being read in the background, in which case the caller
+// should read it for itself.
+ppldata_stream *ppldata_prefetchTake(char *filename)
+ {
+  ppldata_stream *s = NULL;
+  int             i;
+
+  if (pfFiles==NULL) return NULL;
+  pthread_mutex_lock(&pfLock);
+  for (i=0; i<pfN; i++) if ((pfFiles[i].state!=PREFETCH_TAKEN) && (strcmp(pfFiles[i].filename, filename)==0)) break;
+  if (i<pfN)
+   {
+    while (pfFiles[i].state==PREFETCH_READING) pthread_cond_wait(&pfCond, &pfLock);
+    if (pfFiles[i].state==PREFETCH_READY)
+     {
+      s = ppldata_streamOpenStripped(pfFiles[i].lines, pfFiles[i].len);
+      if (s==NULL) free(pfFiles[i].lines);
+      pfFiles[i].lines = NULL;
+     }
+    pfFiles[i].state = PREFETCH_TAKEN;
+    if (i+1>pfConsumed) pfConsumed=i+1;
+    pthread_cond_broadcast(&pfCond);
+   }
+  pthread_mutex_unlock(&pfLock);
+  return s;
+ }
+
+// Stop reading files in the background, and free any text which the interpreter did not take
+void ppldata_prefetchFinish()
+ {
+  int i;
+  if (pfFiles==NULL) return;
+  pthread_mutex_lock(&pfLock);
+  pfStop = 1;
+  pthread_cond_broadcast(&pfCond);
+  pthread_mutex_unlock(&pfLock);
+  for (i=0; i<pfNthreads; i++) pthread_join(pfThreads[i], NULL);
+  for (i=0; i<pfN; i++) { free(pfFiles[i].lines); free(pfFiles[i].filename); }
+  free(pfFiles);
+  pfFiles    = NULL;
+  pfN        = 0;
+  pfNthreads = 0;
+  return;
+ }
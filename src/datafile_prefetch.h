@@ -0,0 +1,35 @@
+// datafile_prefetch.h
+//
+// The code in this file is part of Pyxplot
+// <http://www.pyxplot.org.uk>
+//
+// Copyright (C) 2006-2013 Dominic Ford <coders@pyxplot.org.uk>
+//               2008-2013 Ross Church
+//
+// $Id$
+//
+// Pyxplot is free software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation; either version 2 of the License, or (at your option) any later
+// version.
+//
+// You should have received a copy of the GNU General Public License along with
+// Pyxplot; if not, write to the Free Software Foundation, Inc., 51 Franklin
+// Street, Fifth Floor, Boston, MA  02110-1301, USA
+
+// ----------------------------------------------------------------------------
+
+#ifndef _DATAFILE_PREFETCH_H
+#define _DATAFILE_PREFETCH_H 1
+
+#include "datafile_stream.h"
+#include "userspace/context.h"
+
+// Maximum number of files which may be read ahead of the one the interpreter is currently working on, per thread
+#define DATAFILE_PREFETCH_AHEAD 2
+
+void            ppldata_prefetchStart (ppl_context *c, char **filenames, int N);
+ppldata_stream *ppldata_prefetchTake  (char *filename);
+void            ppldata_prefetchFinish();
+
+#endif
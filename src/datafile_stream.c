@@ -0,0 +1,168 @@
+// datafile_stream.c
+//
+// The code in this file is part of Pyxplot
+// <http://www.pyxplot.org.uk>
+//
+// Copyright (C) 2006-2013 Dominic Ford <coders@pyxplot.org.uk>
+//               2008-2013 Ross Church
+//
+// $Id$
+//
+// Pyxplot is free software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation; either version 2 of the License, or (at your option) any later
+// version.
+//
+// You should have received a copy of the GNU General Public License along with
+// Pyxplot; if not, write to the Free Software Foundation, Inc., 51 Franklin
+// Street, Fifth Floor, Boston, MA  02110-1301, USA
+
+// ----------------------------------------------------------------------------
+
+// Fast line reader used by ppldata_fromFile(). Plain files are memory mapped, and lines are copied straight out of
+// the mapping; other inputs, such as pipes from input filters and stdin, are read in large chunks. In either case,
+// each line is returned with leading and trailing whitespace removed, exactly as ppl_file_readline() followed by
+// ppl_strStrip() would have returned it, but without reading the input one character at a time.
+
+#define _DATAFILE_STREAM_C 1
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include "datafile_stream.h"
+
+// Open a reader on a file which has already been opened. The file handle remains owned by the caller, who should
+// close it after calling ppldata_streamClose().
+ppldata_stream *ppldata_streamOpen(FILE *file)
+ {
+  struct stat     st;
+  off_t           offset;
+  ppldata_stream *s = (ppldata_stream *)malloc(sizeof(ppldata_stream));
+  if (s==NULL) return NULL;
+  s->file   = file;
+  s->map    = NULL;
+  s->mapLen = 0;
+  s->buffer = NULL;
+  s->data   = NULL;
+  s->pos    = s->end = 0;
+  s->eof    = 0;
+  s->stripped = 0;
+
+  // Try to memory map regular files
+  offset = ftello(file);
+  if ((offset>=0) && (fstat(fileno(file), &st)==0) && S_ISREG(st.st_mode) && (st.st_size>0) && ((off_t)(size_t)st.st_size==st.st_size))
+   {
+    void *map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fileno(file), 0);
+    if (map!=MAP_FAILED)
+     {
+#ifdef MADV_SEQUENTIAL
+      madvise(map, (size_t)st.st_size, MADV_SEQUENTIAL);
+#endif
+      s->map    = (const unsigned char *)map;
+      s->mapLen = (size_t)st.st_size;
+      s->data   = s->map;
+      s->pos    = ((size_t)offset < s->mapLen) ? (size_t)offset : s->mapLen;
+      s->end    = s->mapLen;
+      s->eof    = 1; // There is nothing more to read beyond the mapping
+      return s;
+     }
+   }
+
+  // Otherwise fall back to reading the file in large chunks
+  s->buffer = (unsigned char *)malloc(DATAFILE_STREAM_BUFFER);
+  if (s->buffer==NULL) { free(s); return NULL; }
+  s->data   = s->buffer;
+  return s;
+ }
+
+// Open a reader on a buffer of lines which have already been read by ppldata_streamReadLine(), each terminated by
+// a null, for example by ppldata_prefetchStart(). The reader takes ownership of the buffer, which must be malloced.
+ppldata_stream *ppldata_streamOpenStripped(unsigned char *lines, size_t len)
+ {
+  ppldata_stream *s = (ppldata_stream *)malloc(sizeof(ppldata_stream));
+  if (s==NULL) return NULL;
+  s->file     = NULL;
+  s->map      = NULL;
+  s->mapLen   = 0;
+  s->buffer   = lines;
+  s->data     = lines;
+  s->pos      = 0;
+  s->end      = len;
+  s->eof      = 1;
+  s->stripped = 1;
+  return s;
+ }
+
+// Refill the buffer once all of its contents have been consumed. Returns zero at end of file.
+static int ppldata_streamRefill(ppldata_stream *s)
+ {
+  if (s->eof) return 0;
+  s->pos = 0;
+  s->end = fread(s->buffer, 1, DATAFILE_STREAM_BUFFER, s->file);
+  if (s->end==0) { s->eof=1; return 0; }
+  return 1;
+ }
+
+// Read the next line of input into the buffer <out>, which has length maxLength. Returns zero if there are no more
+// lines to read. As in ppl_file_readline(), control characters other than tabs are dropped, and lines longer than
+// maxLength-2 characters are truncated.
+int ppldata_streamReadLine(ppldata_stream *s, char *out, int maxLength)
+ {
+  int  i=0, leading=1, gotAny=0, len=0;
+
+  if (s->stripped)
+   {
+    const char *line = (const char *)(s->data + s->pos);
+    if (s->pos>=s->end) return 0;
+    len = strlen(line);
+    s->pos += len+1;
+    if (len>maxLength-1) len=maxLength-1;
+    memcpy(out, line, len);
+    out[len] = '\0';
+    return 1;
+   }
+
+  while (1)
+   {
+    const unsigned char *start, *stop, *nl;
+    if ((s->pos>=s->end) && (!ppldata_streamRefill(s))) break;
+    gotAny = 1;
+    start  = s->data + s->pos;
+    nl     = (const unsigned char *)memchr(start, '\n', s->end - s->pos);
+    stop   = (nl!=NULL) ? nl : (s->data + s->end);
+
+    for ( ; start<stop; start++)
+     {
+      const char ch = (char)*start;
+      if (!((ch>31)||(ch==9))) continue; // ASCII 9 is a tab
+      if (i>=maxLength-2) continue; // Line too long; keep reading until the newline
+      i++;
+      if (leading && (ch<=' ')) continue; // Strip leading whitespace
+      leading = 0;
+      out[len++] = ch;
+     }
+
+    if (nl!=NULL) { s->pos = (nl - s->data) + 1; break; }
+    s->pos = s->end;
+   }
+
+  // Strip trailing whitespace
+  while ((len>0) && (out[len-1]<=' ')) len--;
+  out[len] = '\0';
+  return gotAny;
+ }
+
+void ppldata_streamClose(ppldata_stream *s)
+ {
+  if (s==NULL) return;
+  if (s->map   !=NULL) munmap((void *)s->map, s->mapLen);
+  if (s->buffer!=NULL) free(s->buffer);
+  free(s);
+  return;
+ }
+
@@ -0,0 +1,48 @@
+// datafile_stream.h
+//
+// The code in this file is part of Pyxplot
+// <http://www.pyxplot.org.uk>
+//
+// Copyright (C) 2006-2013 Dominic Ford <coders@pyxplot.org.uk>
+//               2008-2013 Ross Church
+//
+// $Id$
+//
+// Pyxplot is free software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation; either version 2 of the License, or (at your option) any later
+// version.
+//
+// You should have received a copy of the GNU General Public License along with
+// Pyxplot; if not, write to the Free Software Foundation, Inc., 51 Franklin
+// Street, Fifth Floor, Boston, MA  02110-1301, USA
+
+// ----------------------------------------------------------------------------
+
+#ifndef _DATAFILE_STREAM_H
+#define _DATAFILE_STREAM_H 1
+
+#include <stdio.h>
+
+// Size of the buffer used when reading datafiles which cannot be memory mapped, e.g. pipes from input filters
+#define DATAFILE_STREAM_BUFFER 1048576
+
+typedef struct ppldata_stream {
+  FILE                *file;
+  const unsigned char *map;     // The whole file, if it could be memory mapped; otherwise NULL
+  size_t               mapLen;
+  unsigned char       *buffer;  // Buffer into which file is read in chunks, if it could not be memory mapped
+  const unsigned char *data;    // Either map or buffer
+  size_t               pos;     // Position of next unread byte in data
+  size_t               end;     // Number of valid bytes in data
+  int                  eof;
+  int                  stripped; // If set, data holds lines which have already been read and stripped, each terminated by a null
+ } ppldata_stream;
+
+ppldata_stream *ppldata_streamOpen        (FILE *file);
+ppldata_stream *ppldata_streamOpenStripped(unsigned char *lines, size_t len);
+int             ppldata_streamReadLine    (ppldata_stream *s, char *out, int maxLength);
+void            ppldata_streamClose       (ppldata_stream *s);
+
+#endif
+
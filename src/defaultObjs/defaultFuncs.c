@@ -96,6 +96,7 @@ void ppl_addMagicFunction(dict *n, char *name, int id, char *shortdesc, char *la
   f->descriptionShort = shortdesc;
   f->description  = desc;
   f->needSelfThis = 0;
+  f->stateful     = 0;
   v.refCount      = 1;
   if (pplObjFunc(&v,1,1,f)!=NULL) ppl_dictAppendCpy(n , name , (void *)&v , sizeof(v));
   return;
@@ -123,6 +124,7 @@ pplFunc *ppl_addSystemFunc(dict *n, char *name, int minArgs, int maxArgs, int nu
   f->descriptionShort = shortdesc;
   f->description  = desc;
   f->needSelfThis = 0;
+  f->stateful     = 0;
   v.refCount      = 1;
   if (pplObjFunc(&v,1,1,f)!=NULL) ppl_dictAppendCpy(n , name , (void *)&v , sizeof(v));
   return f;
@@ -134,6 +136,12 @@ void ppl_addSystemMethod(dict *n, char *name, int minArgs, int maxArgs, int numO
   f->needSelfThis = 1;
  }
 
+void ppl_addSystemStatefulFunc(dict *n, char *name, int minArgs, int maxArgs, int numOnly, int notNan, int realOnly, int dimlessOnly, void *fn, char *shortdesc, char *latex, char *desc)
+ {
+  pplFunc *f = ppl_addSystemFunc(n, name, minArgs, maxArgs, numOnly, notNan, realOnly, dimlessOnly, fn, shortdesc, latex, desc);
+  if (f!=NULL) f->stateful = 1;
+ }
+
 void pplfunc_abs         (ppl_context *c, pplObj *in, int nArgs, int *status, int *errType, char *errText)
  {
   char *FunctionDescription = "abs(z)";
@@ -28,9 +28,10 @@
 #include "userspace/pplObj.h"
 #include "userspace/pplObjFunc.h"
 
-void     ppl_addMagicFunction(dict *n, char *name, int id, char *shortdesc, char *latex, char *desc);
-pplFunc *ppl_addSystemFunc   (dict *n, char *name, int minArgs, int maxArgs, int numOnly, int notNan, int realOnly, int dimlessOnly, void *fn, char *shortdesc, char *latex, char *desc);
-void     ppl_addSystemMethod (dict *n, char *name, int minArgs, int maxArgs, int numOnly, int notNan, int realOnly, int dimlessOnly, void *fn, char *shortdesc, char *latex, char *desc);
+void     ppl_addMagicFunction     (dict *n, char *name, int id, char *shortdesc, char *latex, char *desc);
+pplFunc *ppl_addSystemFunc        (dict *n, char *name, int minArgs, int maxArgs, int numOnly, int notNan, int realOnly, int dimlessOnly, void *fn, char *shortdesc, char *latex, char *desc);
+void     ppl_addSystemMethod      (dict *n, char *name, int minArgs, int maxArgs, int numOnly, int notNan, int realOnly, int dimlessOnly, void *fn, char *shortdesc, char *latex, char *desc);
+void     ppl_addSystemStatefulFunc(dict *n, char *name, int minArgs, int maxArgs, int numOnly, int notNan, int realOnly, int dimlessOnly, void *fn, char *shortdesc, char *latex, char *desc);
 
 void pplfunc_abs         (ppl_context *c, pplObj *in, int nArgs, int *status, int *errType, char *errText);
 void pplfunc_acos        (ppl_context *c, pplObj *in, int nArgs, int *status, int *errType, char *errText);
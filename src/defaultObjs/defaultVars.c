@@ -444,13 +444,13 @@ void ppl_makeDefaultVars(ppl_context *out)
     // Random module
     ppl_dictAppendCpy(d  , "random", pplObjModule(&m,1,1,1) , sizeof(v));
     d2 = (dict *)m.auxil;
-    ppl_addSystemFunc(d2,"random"        ,0,0,1,1,1,1,(void *)&pplfunc_frandom     , "random()", "\\mathrm{random}@<@>", "random() returns a random number between 0 and 1");
-    ppl_addSystemFunc(d2,"binomial"      ,2,2,1,1,1,1,(void *)&pplfunc_frandombin  , "binomial(p,n)", "\\mathrm{binomial}@<@1,@2@>", "binomial(p,n) returns a random sample from a binomial distribution with n independent trials and a success probability p");
-    ppl_addSystemFunc(d2,"chisq"         ,1,1,1,1,1,1,(void *)&pplfunc_frandomcs   , "chisq(nu)", "\\mathrm{\\chi^2}@<@1@>", "chisq(nu) returns a random sample from a chi-squared distribution with nu degrees of freedom");
-    ppl_addSystemFunc(d2,"gaussian"      ,1,1,1,1,1,0,(void *)&pplfunc_frandomg    , "gaussian(sigma)", "\\mathrm{gaussian}@<@1@>", "gaussian(sigma) returns a random sample from a Gaussian (normal) distribution of standard deviation sigma");
-    ppl_addSystemFunc(d2,"lognormal"     ,2,2,1,1,1,0,(void *)&pplfunc_frandomln   , "lognormal(zeta,sigma)", "\\mathrm{lognormal}@<@1,@2@>", "lognormal(zeta,sigma) returns a random sample from the log normal distribution centred on zeta, and of width sigma");
-    ppl_addSystemFunc(d2,"poisson"       ,1,1,1,1,1,1,(void *)&pplfunc_frandomp    , "poisson(n)", "\\mathrm{poisson}@<@1@>", "poisson(n) returns a random integer from a Poisson distribution with mean n");
-    ppl_addSystemFunc(d2,"tdist"         ,1,1,1,1,1,1,(void *)&pplfunc_frandomt    , "tdist(nu)", "\\mathrm{tdist}@<@1@>", "tdist(nu) returns a random sample from a t-distribution with nu degrees of freedom");
+    ppl_addSystemStatefulFunc(d2,"random"        ,0,0,1,1,1,1,(void *)&pplfunc_frandom     , "random()", "\\mathrm{random}@<@>", "random() returns a random number between 0 and 1");
+    ppl_addSystemStatefulFunc(d2,"binomial"      ,2,2,1,1,1,1,(void *)&pplfunc_frandombin  , "binomial(p,n)", "\\mathrm{binomial}@<@1,@2@>", "binomial(p,n) returns a random sample from a binomial distribution with n independent trials and a success probability p");
+    ppl_addSystemStatefulFunc(d2,"chisq"         ,1,1,1,1,1,1,(void *)&pplfunc_frandomcs   , "chisq(nu)", "\\mathrm{\\chi^2}@<@1@>", "chisq(nu) returns a random sample from a chi-squared distribution with nu degrees of freedom");
+    ppl_addSystemStatefulFunc(d2,"gaussian"      ,1,1,1,1,1,0,(void *)&pplfunc_frandomg    , "gaussian(sigma)", "\\mathrm{gaussian}@<@1@>", "gaussian(sigma) returns a random sample from a Gaussian (normal) distribution of standard deviation sigma");
+    ppl_addSystemStatefulFunc(d2,"lognormal"     ,2,2,1,1,1,0,(void *)&pplfunc_frandomln   , "lognormal(zeta,sigma)", "\\mathrm{lognormal}@<@1,@2@>", "lognormal(zeta,sigma) returns a random sample from the log normal distribution centred on zeta, and of width sigma");
+    ppl_addSystemStatefulFunc(d2,"poisson"       ,1,1,1,1,1,1,(void *)&pplfunc_frandomp    , "poisson(n)", "\\mathrm{poisson}@<@1@>", "poisson(n) returns a random integer from a Poisson distribution with mean n");
+    ppl_addSystemStatefulFunc(d2,"tdist"         ,1,1,1,1,1,1,(void *)&pplfunc_frandomt    , "tdist(nu)", "\\mathrm{tdist}@<@1@>", "tdist(nu) returns a random sample from a t-distribution with nu degrees of freedom");
 
     // Time module
     ppl_dictAppendCpy(d  , "time", pplObjModule(&m,1,1,1) , sizeof(v));
@@ -0,0 +1,127 @@
+// bmp_pngnegate.c
+//
+// The code in this file is part of Pyxplot
+// <http://www.pyxplot.org.uk>
+//
+// Copyright (C) 2006-2013 Dominic Ford <coders@pyxplot.org.uk>
+//               2008-2013 Ross Church
+//
+// $Id$
+//
+// Pyxplot is free software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation; either version 2 of the License, or (at your option) any later
+// version.
+//
+// You should have received a copy of the GNU General Public License along with
+// Pyxplot; if not, write to the Free Software Foundation, Inc., 51 Franklin
+// Street, Fifth Floor, Boston, MA  02110-1301, USA
+
+// ----------------------------------------------------------------------------
+
+// Negate the colour channels of a PNG image file produced by ghostscript,
+// leaving any alpha channel untouched. This is equivalent to ImageMagick's
+// "convert -negate", but avoids launching an external process for every plot.
+
+#define _PPL_BMP_PNGNEGATE_C 1
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <png.h>
+
+#include "epsMaker/bmp_pngnegate.h"
+
+// Returns zero on success. On failure, the caller should fall back to using ImageMagick; <out> may have been
+// partially written.
+int ppl_bmp_pngNegate(const char *in, const char *out)
+ {
+  FILE         *fi;
+  png_structp   rd_ptr;
+  png_infop     rd_info;
+  FILE         *volatile fo=NULL;      // These are assigned after setjmp(), so must survive a longjmp()
+  png_structp   volatile wr_ptr=NULL;
+  png_infop     volatile wr_info=NULL;
+  png_bytep     volatile row=NULL;
+  png_uint_32   width, height, i, j;
+  int           depth, colour_type, interlace, channels, colours;
+  unsigned char sig[8];
+
+  fi = fopen(in, "rb");
+  if (fi==NULL) return 1;
+  if ((fread(sig, 1, 8, fi)!=8) || png_sig_cmp(sig, 0, 8)) { fclose(fi); return 1; }
+
+  rd_ptr = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+  if (rd_ptr==NULL) { fclose(fi); return 1; }
+  rd_info = png_create_info_struct(rd_ptr);
+  if (rd_info==NULL) { png_destroy_read_struct(&rd_ptr, NULL, NULL); fclose(fi); return 1; }
+
+  if (setjmp(png_jmpbuf(rd_ptr)))
+   {
+    fail:
+    if (wr_ptr!=NULL) { png_structp w=wr_ptr; png_infop wi=wr_info; png_destroy_write_struct(&w, &wi); }
+    png_destroy_read_struct(&rd_ptr, &rd_info, NULL);
+    if (row!=NULL) free(row);
+    if (fo !=NULL) fclose(fo);
+    fclose(fi);
+    return 1;
+   }
+
+  png_init_io(rd_ptr, fi);
+  png_set_sig_bytes(rd_ptr, 8);
+  png_read_info(rd_ptr, rd_info);
+  png_get_IHDR(rd_ptr, rd_info, &width, &height, &depth, &colour_type, &interlace, NULL, NULL);
+
+  // ghostscript's png16m and pngalpha devices write non-interlaced 8-bit RGB(A); expand anything else to match
+  if (interlace!=PNG_INTERLACE_NONE) goto fail;
+  png_set_expand(rd_ptr);
+  png_set_strip_16(rd_ptr);
+  png_set_gray_to_rgb(rd_ptr);
+  png_read_update_info(rd_ptr, rd_info);
+  colour_type = png_get_color_type(rd_ptr, rd_info);
+  channels    = png_get_channels  (rd_ptr, rd_info);
+  colours     = (colour_type & PNG_COLOR_MASK_ALPHA) ? channels-1 : channels;
+  if ((png_get_bit_depth(rd_ptr, rd_info)!=8) || (colours!=3)) goto fail;
+
+  row = (png_bytep)malloc(png_get_rowbytes(rd_ptr, rd_info));
+  if (row==NULL) goto fail;
+
+  fo = fopen(out, "wb");
+  if (fo==NULL) goto fail;
+  wr_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+  if (wr_ptr==NULL) goto fail;
+  wr_info = png_create_info_struct(wr_ptr);
+  if (wr_info==NULL) goto fail;
+
+  // libpng errors on the write side longjmp back to the write struct's buffer
+  if (setjmp(png_jmpbuf(wr_ptr))) goto fail;
+
+  png_init_io(wr_ptr, fo);
+  png_set_IHDR(wr_ptr, wr_info, width, height, 8, colour_type, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+  if (png_get_valid(rd_ptr, rd_info, PNG_INFO_pHYs))
+   {
+    png_uint_32 xres, yres;
+    int         unit;
+    png_get_pHYs(rd_ptr, rd_info, &xres, &yres, &unit);
+    png_set_pHYs(wr_ptr, wr_info, xres, yres, unit);
+   }
+  png_write_info(wr_ptr, wr_info);
+
+  // Stream one row at a time, so that large bitmaps never need to be held in memory
+  for (j=0; j<height; j++)
+   {
+    png_bytep p = row;
+    png_read_row(rd_ptr, row, NULL);
+    for (i=0; i<width; i++, p+=channels) { p[0]=255-p[0]; p[1]=255-p[1]; p[2]=255-p[2]; }
+    png_write_row(wr_ptr, row);
+   }
+
+  png_write_end(wr_ptr, NULL);
+  png_read_end(rd_ptr, NULL);
+  { png_structp w=wr_ptr; png_infop wi=wr_info; png_destroy_write_struct(&w, &wi); }
+  png_destroy_read_struct(&rd_ptr, &rd_info, NULL);
+  free(row);
+  fclose(fi);
+  if (fclose(fo)!=0) return 1;
+  return 0;
+ }
+
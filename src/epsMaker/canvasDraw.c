@@ -40,7 +40,10 @@
 #include "coreUtils/memAlloc.h"
 #include "settings/settingTypes.h"
 #include "stringTools/asciidouble.h"
+#include "epsMaker/bmp_pngnegate.h"
 #include "epsMaker/canvasDraw.h"
+#include "epsMaker/dvi_cache.h"
+#include "epsMaker/dvi_font.h"
 #include "epsMaker/dvi_read.h"
 #include "epsMaker/eps_arrow.h"
 #include "epsMaker/eps_box.h"
@@ -61,6 +64,8 @@
 #include "canvasItems.h"
 #include "children.h"
 #include "datafile.h"
+#include "datafile_cache.h"
+#include "datafile_prefetch.h"
 
 // Handy routine for copying files
 static int filecopy(EPSComm *x, const char *in, const char *out)
@@ -88,9 +93,12 @@ static int filecopy(EPSComm *x, const char *in, const char *out)
       char *src = GSOutputTemp; \
       if ((CanInvert) && (c->set->term_current.TermInvert==SW_ONOFF_ON)) \
        { \
-        sprintf(c->errcontext.tempErrStr, "%s %s -negate %s", CONVERT_COMMAND, GSOutputTemp, GSOutputTemp2); \
-        if (system(c->errcontext.tempErrStr) != 0) /* Run convert to negate image */ \
-         { ppl_error(&c->errcontext, ERR_GENERIC, -1, -1, "Error encountered whilst using ImageMagick to generate negated " Y " output"); } \
+        if ((termtype!=SW_TERMTYPE_PNG) || (ppl_bmp_pngNegate(GSOutputTemp, GSOutputTemp2) != 0)) /* Negate PNGs in-process where possible */ \
+         { \
+          sprintf(c->errcontext.tempErrStr, "%s %s -negate %s", CONVERT_COMMAND, GSOutputTemp, GSOutputTemp2); \
+          if (system(c->errcontext.tempErrStr) != 0) /* Run convert to negate image */ \
+           { ppl_error(&c->errcontext, ERR_GENERIC, -1, -1, "Error encountered whilst using ImageMagick to generate negated " Y " output"); } \
+         } \
         src = GSOutputTemp2; \
         remove(GSOutputTemp); \
        } \
@@ -145,6 +153,41 @@ static void(*TextHandlers[] )(EPSComm *) = {NULL                       , NULL
 static void(*AfterHandlers[])(EPSComm *) = {NULL                       , NULL                    , NULL                     , canvas_CallLaTeX    , canvas_MakeEPSBuffer, canvas_EPSWrite    , NULL};
 
 
+// Start reading, in background threads, the datafiles which plots and piecharts on the canvas will read in the first
+// phase of rendering. Plotting a wildcard such as 'data_*.dat' produces one dataset per matching file.
+static void canvas_PrefetchDatafiles(ppl_context *c, canvas_itemlist *itemlist, unsigned char *unsuccessful_ops)
+ {
+  canvas_item     *item;
+  canvas_plotdesc *pd;
+  char           **filenames=NULL, **tmp, errtext[LSTR_LENGTH];
+  int              N=0, Nalloc=0;
+
+  if (itemlist==NULL) return;
+  for (item=itemlist->first; item!=NULL; item=item->next)
+   {
+    if ((item->deleted) || (unsuccessful_ops[item->id]) || ((item->type!=CANVAS_PLOT)&&(item->type!=CANVAS_PIE))) continue;
+    for (pd=item->plotitems; pd!=NULL; pd=pd->next)
+     {
+      char *filenameFinal;
+      if ((pd->function) || (pd->filename==NULL) || (pd->PersistentDataTable!=NULL)) continue;
+      if ((pd->filename[0]=='\0') || (strcmp(pd->filename,"-")==0) || (strcmp(pd->filename,"--")==0)) continue; // Not files on disk
+      if ((filenameFinal = ppldata_globFilename(c, pd->filename, 0, NULL, errtext))==NULL) continue;
+      if (ppldata_filterFor(c, filenameFinal)!=NULL) continue; // Input filters are run as coprocesses by ppldata_fromFile()
+      if (ppldata_cacheHoldsFile(c, filenameFinal)) continue;
+      if (N>=Nalloc)
+       {
+        Nalloc = 2*Nalloc+16;
+        if ((tmp = (char **)ppl_memAlloc(Nalloc*sizeof(char *)))==NULL) return;
+        if (N>0) memcpy(tmp, filenames, N*sizeof(char *));
+        filenames = tmp;
+       }
+      filenames[N++] = filenameFinal;
+     }
+   }
+  if (N>1) ppldata_prefetchStart(c, filenames, N);
+  return;
+ }
+
 void ppl_canvas_draw(ppl_context *c, unsigned char *unsuccessful_ops, int iterDepth)
  {
   static int lock=0;
@@ -260,6 +303,9 @@ void ppl_canvas_draw(ppl_context *c, unsigned char *unsuccessful_ops, int iterDe
     item->PlotBottomMargin = 0.0;
    }
 
+  // Datafiles are read in the first phase; start reading them in the background so that they can be parsed in parallel
+  canvas_PrefetchDatafiles(c, comm.itemlist, unsuccessful_ops);
+
   // Rendering of EPS occurs in a series of phases which we now loop over
   for (j=0 ; ; j++)
    {
@@ -303,6 +349,7 @@ void ppl_canvas_draw(ppl_context *c, unsigned char *unsuccessful_ops, int iterDe
       if (status) { unsuccessful_ops[item->id] = 1; } // If something went wrong... flag it up and give up on this object
       status = 0;
      }
+    if (j==0) ppldata_prefetchFinish(); // Discard any datafiles which were read in the background but not used
     if (AfterHandler != NULL) (*AfterHandler)(&comm); // At the end of each phase, a canvas-wide handler may be called
     if (status) { if (comm.epsbuffer!=NULL) fclose(comm.epsbuffer); lock=0; return; } // The failure of a canvas-wide handler is fatal
    }
@@ -411,10 +458,35 @@ void ppl_canvas_draw(ppl_context *c, unsigned char *unsuccessful_ops, int iterDe
 
   // Return to user's current working directory
   if (chdir(c->errcontext.session_default.cwd) < 0) { ppl_fatal(&c->errcontext, __FILE__,__LINE__,"chdir into cwd failed."); }
+
+  // Keep a note of the output file which was written, if anyone has asked for one
+  if ((c->outputFiles!=NULL) && (termtype!=SW_TERMTYPE_X11S) && (termtype!=SW_TERMTYPE_X11M) && (termtype!=SW_TERMTYPE_X11P) && (access(comm.FinalFilename, F_OK)==0))
+   {
+    char fullname[FNAME_LENGTH];
+    if (comm.FinalFilename[0]==PATHLINK[0]) snprintf(fullname, FNAME_LENGTH, "%s", comm.FinalFilename);
+    else                                    snprintf(fullname, FNAME_LENGTH, "%s%s%s", c->errcontext.session_default.cwd, PATHLINK, comm.FinalFilename);
+    fullname[FNAME_LENGTH-1]='\0';
+    ppl_listAppendCpy(c->outputFiles, fullname, strlen(fullname)+1);
+   }
   lock=0;
   return;
  }
 
+// Beginning of every LaTeX document we produce. Resident latex processes are started with this, and the user's
+// preamble, already loaded.
+static const char TextHeader1[] = "\\documentclass{article}\n\\pagestyle{empty}\n\\usepackage{upgreek}\n";
+
+// Start a resident latex process with the preamble which canvas_CallLaTeX() will next ask for. Used by server mode,
+// which hands one to each script that it runs.
+void canvas_forkLaTeXResident(ppl_context *c)
+ {
+  char *preamble = (char *)malloc(strlen(TextHeader1) + strlen(c->set->term_current.LatexPreamble) + 2);
+  if (preamble==NULL) return;
+  sprintf(preamble, "%s%s\n", TextHeader1, c->set->term_current.LatexPreamble);
+  pplcsp_forkLaTeXResident(c, preamble);
+  free(preamble);
+ }
+
 // Run LaTeX to turn set of strings for typesetting into eps code
 #define FPRINTF_LINECOUNT( X ) \
   fprintf(output, "%s", X); \
@@ -422,18 +494,21 @@ void ppl_canvas_draw(ppl_context *c, unsigned char *unsuccessful_ops, int iterDe
 
 void canvas_CallLaTeX(EPSComm *x)
  {
-  int   linecount=1, i, j, pid, LatexStatus, LatexStdIn, LatexOut;
-  char  filename[FNAME_LENGTH], *str_buffer;
+  int   linecount, i, j, pid, LatexStatus, LatexStdIn, LatexOut, resident;
+  char  filename[FNAME_LENGTH], TeXFilename[FNAME_LENGTH], *str_buffer, *preamble;
   FILE *output;
   listIterator *ListIter;
   CanvasTextItem *TempTextItem, *SuspectTextItem=NULL;
+  list *items = x->TextItems;      // The text items which need to be passed to latex
+  list *cachedFonts = NULL;        // Fonts used by text items found in the cache of typeset text,
+  postscriptPage **cached = NULL;  //   and the pages of postscript for each text item which was found there
   struct timespec waitperiod; // A time.h timespec specifier for a wait of zero seconds
   unsigned char   FirstIter;
   fd_set          readable;
   sigset_t        sigs;
 
-  int  ErrLineNo=0, ErrReadState=0, ErrReadPos=0, NCharsRead=0, ReadErrorState=0, TrialNumber;
-  char ErrFilename[FNAME_LENGTH]="", ErrMsg[FNAME_LENGTH]="";
+  int  ErrLineNo, ErrReadState, ErrReadPos, NCharsRead=0, ReadErrorState, TrialNumber;
+  char ErrFilename[FNAME_LENGTH], ErrMsg[FNAME_LENGTH];
   char TempErrFilename[FNAME_LENGTH], TempErrLineNo[FNAME_LENGTH], TempErrMsg[FNAME_LENGTH];
 
   if (ppl_listLen(x->TextItems) < 1) return; // We have no text to give to latex, and so don't need to fork
@@ -441,7 +516,6 @@ void canvas_CallLaTeX(EPSComm *x)
   sigemptyset(&sigs);
   sigaddset(&sigs,SIGCHLD);
 
-  const char TextHeader1[] = "\\documentclass{article}\n\\pagestyle{empty}\n\\usepackage{upgreek}\n";
   const char TextHeader2[] = "\\begin{document}\n\\begin{center}{\\bf This page has been left deliberately blank.}\\end{center}\n\\newpage\n";
   const char ItemHeader [] = "\\vbox{\\hbox{\n";
   const char ItemFooter [] = "\n\\hskip 0pt plus 1filll minus 1filll}\n\\vskip 0pt plus 1filll minus 1filll}\n\\newpage\n";
@@ -454,16 +528,59 @@ void canvas_CallLaTeX(EPSComm *x)
   str_buffer = (char *)ppl_memAlloc(LSTR_LENGTH);
   if (str_buffer==NULL) { ppl_error(&x->c->errcontext, ERR_MEMORY,-1,-1,"Out of memory (y)."); return; }
 
+  // The preamble which a resident latex process must have loaded if we are to use it
+  preamble = (char *)ppl_memAlloc(strlen(TextHeader1) + strlen(x->c->set->term_current.LatexPreamble) + 2);
+  if (preamble==NULL) { ppl_error(&x->c->errcontext, ERR_MEMORY,-1,-1,"Out of memory (y)."); return; }
+  sprintf(preamble, "%s%s\n", TextHeader1, x->c->set->term_current.LatexPreamble);
+
+  // Look up each text item in the cache of typeset text, if we have one, and only pass latex those which are not there
+  if (x->c->latexCache != NULL)
+   {
+    cached      = (postscriptPage **)ppl_memAlloc(ppl_listLen(x->TextItems) * sizeof(postscriptPage *));
+    cachedFonts = ppl_listInit(0);
+    items       = ppl_listInit(0);
+    if ((cached==NULL) || (cachedFonts==NULL) || (items==NULL)) { ppl_error(&x->c->errcontext, ERR_MEMORY,-1,-1,"Out of memory (y)."); return; }
+    for (ListIter=ppl_listIterateInit(x->TextItems), i=0; ListIter!=NULL; ppl_listIterate(&ListIter), i++)
+     {
+      TempTextItem = (CanvasTextItem *)ListIter->data;
+      cached[i] = dviCacheFetch(&x->c->errcontext, x->c->latexCache, preamble, TempTextItem->text, cachedFonts);
+      if (cached[i]==NULL) ppl_listAppend(items, (void *)TempTextItem);
+     }
+    if (DEBUG) { sprintf(x->c->errcontext.tempErrStr, "%d of %d text items found in cache of typeset text", ppl_listLen(x->TextItems)-ppl_listLen(items), ppl_listLen(x->TextItems)); ppl_log(&x->c->errcontext, NULL); }
+    if (ppl_listLen(items) < 1) // Everything was in the cache, so we don't need latex at all
+     {
+      x->dvi = dviNewInterpreter(&x->c->errcontext);
+      if (x->dvi == NULL) { *(x->status)=1; return; }
+      goto assemble;
+     }
+   }
+
+  // If a resident latex process is waiting, with our preamble already loaded, use it. If it fails for any reason,
+  // go round again and fork a fresh latex process, which will also produce any error messages that we report.
+  resident = pplcsp_takeLaTeXResident(x->c, preamble, TeXFilename, &pid, &LatexStdIn, &LatexOut);
+typeset:
+  if (!resident) strcpy(TeXFilename, x->TeXFilename);
+  linecount = 1;
+  ErrLineNo = ErrReadState = ErrReadPos = ReadErrorState = 0;
+  ErrFilename[0] = ErrMsg[0] = '\0';
+
   // Start writing LaTeX document
-  sprintf(filename, "%s.tex", x->TeXFilename);
+  sprintf(filename, "%s.tex", TeXFilename);
   output = fopen(filename, "w");
-  if (output == NULL) { ppl_error(&x->c->errcontext, ERR_INTERNAL, -1, -1, "Could not create temporary LaTeX document"); *(x->status)=1; return; }
-  FPRINTF_LINECOUNT(TextHeader1);
-  FPRINTF_LINECOUNT(x->c->set->term_current.LatexPreamble);
+  if (output == NULL)
+   {
+    if (resident) { close(LatexStdIn); close(LatexOut); kill(pid, SIGTERM); waitpid(pid, NULL, 0); }
+    ppl_error(&x->c->errcontext, ERR_INTERNAL, -1, -1, "Could not create temporary LaTeX document"); *(x->status)=1; return;
+   }
+  if (!resident)
+   {
+    FPRINTF_LINECOUNT(TextHeader1);
+    FPRINTF_LINECOUNT(x->c->set->term_current.LatexPreamble);
+   }
   FPRINTF_LINECOUNT(TextHeader2);
 
   // Sequentially print out text strings
-  ListIter = ppl_listIterateInit(x->TextItems);
+  ListIter = ppl_listIterateInit(items);
   while (ListIter != NULL)
    {
     TempTextItem = (CanvasTextItem *)ListIter->data;
@@ -479,13 +596,21 @@ void canvas_CallLaTeX(EPSComm *x)
   FPRINTF_LINECOUNT(TextFooter);
   fclose(output);
 
-  // Fork LaTeX process
-  pplcsp_forkLaTeX(x->c, filename, &pid, &LatexStdIn, &LatexOut);
+  // Fork LaTeX process, or tell the resident one which file to typeset
+  LatexStatus = 0;
+  if (!resident)
+   {
+    pplcsp_forkLaTeX(x->c, filename, &pid, &LatexStdIn, &LatexOut);
+   }
+  else
+   {
+    sprintf(str_buffer, "%s\n", filename);
+    if (write(LatexStdIn, str_buffer, strlen(str_buffer)) != (ssize_t)strlen(str_buffer)) LatexStatus=1;
+   }
 
   // Wait for latex process's stdout to become readable. Get bored if this takes too long.
   FirstIter = 1;
-  LatexStatus = 0;
-  while (1)
+  while (!LatexStatus)
    {
     for (TrialNumber=1;;)
      {
@@ -556,6 +681,24 @@ void canvas_CallLaTeX(EPSComm *x)
   close(LatexOut);
   sigprocmask(SIG_UNBLOCK, &sigs, NULL);
 
+  // We reap resident latex processes ourselves. Fall back to a fresh latex process if no DVI file was produced.
+  if (resident)
+   {
+    if (LatexStatus) kill(pid, SIGTERM);
+    waitpid(pid, NULL, 0);
+    sprintf(filename, "%s.dvi", TeXFilename);
+    if ((LatexStatus) || (access(filename, R_OK)!=0))
+     {
+      if (DEBUG) ppl_log(&x->c->errcontext, "Resident latex process failed; forking a new latex process instead.");
+      resident = 0;
+      goto typeset;
+     }
+    sprintf(filename, "%s.tex", TeXFilename);
+   }
+
+  // Start a resident latex process for the next time we are called
+  pplcsp_forkLaTeXResident(x->c, preamble);
+
   // Return error message if latex has failed
   if (LatexStatus)
    {
@@ -563,7 +706,7 @@ void canvas_CallLaTeX(EPSComm *x)
     if (strcmp(filename, ErrFilename)==0) // Case 1: Error in the LaTeX file which we just generated
      {
       unsigned char ExactHit=0; // Cycle through all text items and see whether error line number is in the middle of one of them
-      ListIter = ppl_listIterateInit(x->TextItems);
+      ListIter = ppl_listIterateInit(items);
       while (ListIter != NULL)
        {
         TempTextItem = (CanvasTextItem *)ListIter->data;
@@ -612,10 +755,44 @@ void canvas_CallLaTeX(EPSComm *x)
    }
 
   // Convert dvi into postscript fragments
-  sprintf(filename, "%s.dvi", x->TeXFilename);
+  sprintf(filename, "%s.dvi", TeXFilename);
   x->dvi = ReadDviFile(&x->c->errcontext, filename, x->status);
   if (*(x->status)) return; // DVI interpreter failed
 
+assemble:
+  // Merge the pages which latex has just typeset with those from the cache, storing the new ones in the cache
+  if (cached != NULL)
+   {
+    listIterator *PageIter = ppl_listIterateInit(x->dvi->output->pages);
+    list         *pages    = ppl_listInit(0);
+    if (pages==NULL) { ppl_error(&x->c->errcontext, ERR_MEMORY,-1,-1,"Out of memory (y)."); *(x->status)=1; return; }
+    if (PageIter != NULL) ppl_listIterate(&PageIter); // Skip the blank first page
+    ppl_listAppend(pages, (void *)dviNewPostscriptPage(&x->c->errcontext));
+    for (ListIter=ppl_listIterateInit(x->TextItems), i=0; ListIter!=NULL; ppl_listIterate(&ListIter), i++)
+     {
+      TempTextItem = (CanvasTextItem *)ListIter->data;
+      if (cached[i]==NULL)
+       {
+        if (PageIter==NULL) break; // Not all text items were rendered by LaTeX; this will be reported when they are drawn
+        cached[i] = (postscriptPage *)PageIter->data;
+        ppl_listIterate(&PageIter);
+        dviCacheStore(&x->c->errcontext, x->c->latexCache, preamble, TempTextItem->text, cached[i], x->dvi->fonts);
+       }
+      ppl_listAppend(pages, (void *)cached[i]);
+     }
+    x->dvi->output->pages  = pages;
+    x->dvi->output->Npages = ppl_listLen(pages);
+
+    // Add fonts used by cached text items which latex has not loaded
+    for (ListIter=ppl_listIterateInit(cachedFonts); ListIter!=NULL; ppl_listIterate(&ListIter))
+     {
+      listIterator *FontIter;
+      for (FontIter=ppl_listIterateInit(x->dvi->fonts); FontIter!=NULL; ppl_listIterate(&FontIter))
+        if ((((dviFontDetails *)FontIter->data)->psName!=NULL) && (strcmp(((dviFontDetails *)FontIter->data)->psName, ((dviFontDetails *)ListIter->data)->psName)==0)) break;
+      if (FontIter==NULL) ppl_listAppend(x->dvi->fonts, ListIter->data);
+     }
+   }
+
   // Return to user's current working directory after LaTeX has finished making a mess
   if (chdir(x->c->errcontext.session_default.cwd) < 0) { ppl_fatal(&x->c->errcontext,__FILE__,__LINE__,"chdir into cwd failed."); }
   return;
@@ -634,8 +811,9 @@ void canvas_EPSWrite(EPSComm *x)
  {
   int i;
   double PAGEwidth, PAGEheight, margin_left, margin_top, margin_bottom;
-  FILE *epsout, *PFAfile;
-  char LandscapifyText[FNAME_LENGTH], EnlargementText[FNAME_LENGTH], *PaperName, *PFAfilename;
+  long PFAlen;
+  FILE *epsout;
+  char LandscapifyText[FNAME_LENGTH], EnlargementText[FNAME_LENGTH], *PaperName, *PFAfilename, *PFAtext;
   listIterator *ListIter;
 
   // Check that we have a bounding box
@@ -722,17 +900,15 @@ void canvas_EPSWrite(EPSComm *x)
     if (PFAfilename != NULL)  // PFAfilename==NULL indicates that this is a built-in font that doesn't require a fontdef
      {
       fprintf(epsout, "%%%%BeginFont: %s\n", ((dviFontDetails *)ListIter->data)->psName);
-      PFAfile = fopen(PFAfilename,"r");
-      if (PFAfile==NULL) { sprintf(x->c->errcontext.tempErrStr, "Could not open pfa file '%s'", PFAfilename); ppl_error(&x->c->errcontext, ERR_FILE, -1, -1, NULL); *(x->status)=1; fclose(epsout); return; }
-      while (fgets(x->c->errcontext.tempErrStr, FNAME_LENGTH, PFAfile) != NULL)
-       if (fputs(x->c->errcontext.tempErrStr, epsout) == EOF)
-        {
-         sprintf(x->c->errcontext.tempErrStr, "Error while writing to file '%s'.", x->EPSFilename); ppl_error(&x->c->errcontext, ERR_FILE, -1, -1, NULL);
-         *(x->status)=1;
-         fclose(PFAfile); fclose(epsout);
-         return;
-        }
-      fclose(PFAfile);
+      PFAtext = dviGetPfaText(&x->c->errcontext, PFAfilename, &PFAlen); // Font files are kept in memory once read
+      if (PFAtext==NULL) { sprintf(x->c->errcontext.tempErrStr, "Could not open pfa file '%s'", PFAfilename); ppl_error(&x->c->errcontext, ERR_FILE, -1, -1, NULL); *(x->status)=1; fclose(epsout); return; }
+      if (fwrite(PFAtext, 1, PFAlen, epsout) != (size_t)PFAlen)
+       {
+        sprintf(x->c->errcontext.tempErrStr, "Error while writing to file '%s'.", x->EPSFilename); ppl_error(&x->c->errcontext, ERR_FILE, -1, -1, NULL);
+        *(x->status)=1;
+        fclose(epsout);
+        return;
+       }
       fprintf(epsout, "\n%%%%EndFont\n");
      }
     ppl_listIterate(&ListIter);
@@ -806,12 +982,22 @@ void canvas_EPSWrite(EPSComm *x)
   return;
  }
 
+// Send output from canvas_EPSRenderTextItem either straight to the EPS buffer file, or to the end of a string buffer
+static void canvas_EPSTextOut(EPSComm *x, char **strout, char *buffer, long BUFLEN, long *bufpos, const char *s, long len)
+ {
+  if (strout==NULL) { fwrite(s, 1, len, x->epsbuffer); return; }
+  if (len > BUFLEN-1-*bufpos) len = BUFLEN-1-*bufpos;
+  memcpy(buffer+*bufpos, s, len);
+  *bufpos += len;
+  buffer[*bufpos] = '\0';
+ }
+
 // Write a text item out from dvi buffer
 void canvas_EPSRenderTextItem(EPSComm *x, char **strout, int pageno, double xpos, double ypos, int halign, int valign, char *colstr, double fontsize, double rotate, double *width, double *height)
  {
-  postscriptPage *dviPage;
-  listIterator *ListIter;
-  char *cptr, *out;
+  postscriptPage  *dviPage;
+  postscriptChunk *chunk;
+  char *cptr, *end, *magic, *out;
   static char *buffer=NULL;
   const long   BUFLEN=131072;
   long         bufpos=0;
@@ -872,27 +1058,30 @@ void canvas_EPSRenderTextItem(EPSComm *x, char **strout, int pageno, double xpos
   snprintf(out+bufpos, BUFLEN-bufpos, "%f %f scale\n", fontsize, fontsize); bufpos+=strlen(out+bufpos);
   snprintf(out+bufpos, BUFLEN-bufpos, "%.2f %.2f translate\n", -xanchor, -yanchor); bufpos+=strlen(out+bufpos);
 
+  // When writing to file, the postscript of the page is written straight out, in as few pieces as possible
+  if (strout==NULL) { fwrite(buffer, 1, bufpos, x->epsbuffer); bufpos=0; }
+
   // Copy postscript description of page out of dvi buffer
-  ListIter = ppl_listIterateInit(dviPage->text);
-  while (ListIter!=NULL)
+  for (chunk=dviPage->first; chunk!=NULL; chunk=chunk->next)
    {
-    cptr = (char *)ListIter->data;
-    while (*cptr!='\0')
+    cptr = chunk->data;
+    end  = chunk->data + chunk->len;
+    while (cptr < end)
      {
-      if (*cptr!='\x01') snprintf(out+bufpos, BUFLEN-bufpos, "%c", *cptr);
-      else               snprintf(out+bufpos, BUFLEN-bufpos, "%s", colstr); // ASCII x01 is a magic code to tell us to revert to default color
-      bufpos+=strlen(out+bufpos);
-      cptr++;
+      magic = (char *)memchr(cptr, '\x01', end-cptr); // ASCII x01 is a magic code to tell us to revert to default color
+      if (magic==NULL) magic = end;
+      canvas_EPSTextOut(x, strout, buffer, BUFLEN, &bufpos, cptr, magic-cptr);
+      if (magic==end) break;
+      canvas_EPSTextOut(x, strout, buffer, BUFLEN, &bufpos, colstr, strlen(colstr));
+      cptr = magic+1;
      }
-    ppl_listIterate(&ListIter);
    }
 
   // Undo translation and we're finished
-  snprintf(out+bufpos, BUFLEN-bufpos, "grestore\n"); bufpos+=strlen(out+bufpos);
+  canvas_EPSTextOut(x, strout, buffer, BUFLEN, &bufpos, "grestore\n", 9);
 
-  // Either return string, or write output to file
-  if (strout==NULL) fprintf(x->epsbuffer, "%s", buffer);
-  else              *strout=buffer;
+  // Either return string, or we have written output to file
+  if (strout!=NULL) *strout=buffer;
   return;
  }
 
@@ -26,6 +26,7 @@
 #include "userspace/context.h"
 
 void ppl_canvas_draw(ppl_context *c, unsigned char *unsuccessful_ops, int iterDepth);
+void canvas_forkLaTeXResident(ppl_context *c);
 void canvas_CallLaTeX(EPSComm *x);
 void canvas_MakeEPSBuffer(EPSComm *x);
 void canvas_EPSWrite(EPSComm *x);
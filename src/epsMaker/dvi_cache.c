@@ -0,0 +1,250 @@
+// dvi_cache.c
+//
+// The code in this file is part of Pyxplot
+// <http://www.pyxplot.org.uk>
+//
+// Copyright (C) 2006-2013 Dominic Ford <coders@pyxplot.org.uk>
+//               2008-2013 Ross Church
+//
+// $Id$
+//
+// Pyxplot is free software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation; either version 2 of the License, or (at your option) any later
+// version.
+//
+// You should have received a copy of the GNU General Public License along with
+// Pyxplot; if not, write to the Free Software Foundation, Inc., 51 Franklin
+// Street, Fifth Floor, Boston, MA  02110-1301, USA
+
+// ----------------------------------------------------------------------------
+
+// Cache of typeset text items, whose format is described in dvi_cache.h
+
+#define _PPL_DVI_CACHE_C 1
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include "coreUtils/errorReport.h"
+#include "coreUtils/list.h"
+#include "coreUtils/memAlloc.h"
+#include "epsMaker/dvi_cache.h"
+#include "epsMaker/dvi_font.h"
+#include "epsMaker/dvi_read.h"
+#include "parser/parserCache.h"
+
+// Most fonts which a single cached text item may use
+#define DVICACHE_MAXFONTS 64
+
+// Turn a cache directory, which may be relative to the user's working directory, into an absolute path
+static void dviCacheDir(pplerr_context *ec, const char *dir, char *out)
+ {
+  if (dir[0]==PATHLINK[0]) snprintf(out, FNAME_LENGTH, "%s", dir);
+  else                     snprintf(out, FNAME_LENGTH, "%s%s%s", ec->session_default.cwd, PATHLINK, dir);
+  out[FNAME_LENGTH-1]='\0';
+ }
+
+// Name of the file in which a text item is stored
+static void dviCacheFilename(pplerr_context *ec, const char *dir, const char *preamble, const char *text, char *out)
+ {
+  char path[FNAME_LENGTH];
+  dviCacheDir(ec, dir, path);
+  snprintf(out, FNAME_LENGTH, "%s%s%016llx%016llx.tex", path, PATHLINK,
+           (unsigned long long)ppl_parserCacheHash((const unsigned char *)preamble, strlen(preamble)),
+           (unsigned long long)ppl_parserCacheHash((const unsigned char *)text    , strlen(text    )));
+  out[FNAME_LENGTH-1]='\0';
+ }
+
+// Read a whole file into a malloced buffer
+static char *dviCacheSlurp(const char *filename, long *len)
+ {
+  FILE *f;
+  char *buf;
+  long  n;
+  if ((f=fopen(filename,"rb"))==NULL) return NULL;
+  if ((fseek(f,0,SEEK_END)!=0) || ((n=ftell(f))<0) || (fseek(f,0,SEEK_SET)!=0)) { fclose(f); return NULL; }
+  buf = (char *)malloc(n+1);
+  if (buf==NULL) { fclose(f); return NULL; }
+  if (fread(buf,1,n,f)!=(size_t)n) { free(buf); fclose(f); return NULL; }
+  fclose(f);
+  buf[n]='\0';
+  *len=n;
+  return buf;
+ }
+
+postscriptPage *dviCacheFetch(pplerr_context *ec, const char *dir, const char *preamble, const char *text, list *fonts)
+ {
+  char            filename[FNAME_LENGTH], *buf, *p, *end, *psNames[DVICACHE_MAXFONTS], *pfaPaths[DVICACHE_MAXFONTS];
+  long            len, lenPre, lenText, lenPS, lenName, lenPfa;
+  int             Nfonts, i, n;
+  double          bb[8];
+  postscriptPage *page;
+  listIterator   *li;
+
+  dviCacheFilename(ec, dir, preamble, text, filename);
+  if ((buf=dviCacheSlurp(filename, &len))==NULL) return NULL;
+  end = buf+len;
+
+  // Header
+  p = buf;
+  if ((strncmp(p, DVICACHE_MAGIC "\n", strlen(DVICACHE_MAGIC)+1)!=0)) goto miss;
+  p += strlen(DVICACHE_MAGIC)+1;
+  if (sscanf(p, "%ld %ld %ld %d\n%n", &lenPre, &lenText, &lenPS, &Nfonts, &n)!=4) goto miss;
+  p += n;
+  if ((lenPre!=strlen(preamble)) || (lenText!=strlen(text)) || (lenPS<0) || (Nfonts<0) || (Nfonts>DVICACHE_MAXFONTS)) goto miss;
+  if (sscanf(p, "%la %la %la %la %la %la %la %la\n%n", bb, bb+1, bb+2, bb+3, bb+4, bb+5, bb+6, bb+7, &n)!=8) goto miss;
+  p += n;
+
+  // Fonts. A PFA path of length zero indicates a font which is built into postscript.
+  for (i=0; i<Nfonts; i++)
+   {
+    if ((p>=end) || (sscanf(p, "%ld %ld\n%n", &lenName, &lenPfa, &n)!=2)) goto miss;
+    p += n;
+    if ((lenName<1) || (lenPfa<0) || (lenName+lenPfa+2 > end-p)) goto miss;
+    psNames [i] = p; p+=lenName; *(p++)='\0';
+    pfaPaths[i] = p; p+=lenPfa;
+    if (*p!='\n') goto miss;
+    *(p++)='\0';
+    if ((lenPfa>0) && (access(pfaPaths[i], R_OK)!=0)) goto miss; // The font file has gone away
+   }
+
+  // The preamble and text must match exactly; the filename alone is only a hash of them
+  if (lenPre+lenText+lenPS != end-p) goto miss;
+  if ((memcmp(p, preamble, lenPre)!=0) || (memcmp(p+lenPre, text, lenText)!=0)) goto miss;
+  p += lenPre+lenText;
+
+  // Build page of postscript
+  if ((page = dviNewPostscriptPage(ec))==NULL) goto miss;
+  page->boundingBox = (double *)ppl_memAlloc(4*sizeof(double));
+  page->textSizeBox = (double *)ppl_memAlloc(4*sizeof(double));
+  if ((page->boundingBox==NULL) || (page->textSizeBox==NULL)) goto miss;
+  memcpy(page->boundingBox, bb  , 4*sizeof(double));
+  memcpy(page->textSizeBox, bb+4, 4*sizeof(double));
+  if (dviPageAppend(ec, page, p, lenPS)!=0) goto miss;
+
+  // Add any fonts which have not already been loaded
+  for (i=0; i<Nfonts; i++)
+   {
+    dviFontDetails *font;
+    for (li=ppl_listIterateInit(fonts); li!=NULL; ppl_listIterate(&li))
+      if (strcmp(((dviFontDetails *)li->data)->psName, psNames[i])==0) break;
+    if (li!=NULL) continue;
+    font = (dviFontDetails *)ppl_memAlloc(sizeof(dviFontDetails));
+    if (font==NULL) goto miss;
+    memset(font, 0, sizeof(dviFontDetails));
+    font->psName = (char *)ppl_memAlloc(strlen(psNames[i])+1);
+    if (font->psName==NULL) goto miss;
+    strcpy(font->psName, psNames[i]);
+    if (pfaPaths[i][0]!='\0')
+     {
+      font->pfaPath = (char *)ppl_memAlloc(strlen(pfaPaths[i])+1);
+      if (font->pfaPath==NULL) goto miss;
+      strcpy(font->pfaPath, pfaPaths[i]);
+     }
+    ppl_listAppend(fonts, (void *)font);
+   }
+
+  free(buf);
+  return page;
+
+miss:
+  free(buf);
+  return NULL;
+ }
+
+// Copy a PFA file which was converted into the temporary directory into the cache directory, since the temporary
+// directory will be deleted when Pyxplot exits. Returns the path of the copy, or NULL.
+static char *dviCachePfa(pplerr_context *ec, const char *dir, dviFontDetails *font, char *out)
+ {
+  char  path[FNAME_LENGTH], tmpname[FNAME_LENGTH], buf[4096];
+  FILE *fi, *fo;
+  int   n, fail=0;
+  if (strchr(font->psName, PATHLINK[0])!=NULL) return NULL;
+  dviCacheDir(ec, dir, path);
+  snprintf(out, FNAME_LENGTH, "%s%s%s.pfa", path, PATHLINK, font->psName);
+  out[FNAME_LENGTH-1]='\0';
+  if (access(out, R_OK)==0) return out;
+  snprintf(tmpname, FNAME_LENGTH, "%s.%d", out, (int)getpid());
+  tmpname[FNAME_LENGTH-1]='\0';
+  if ((fi=fopen(font->pfaPath,"rb"))==NULL) return NULL;
+  if ((fo=fopen(tmpname,"wb"))==NULL) { fclose(fi); return NULL; }
+  while ((!fail) && ((n=fread(buf,1,sizeof(buf),fi))>0)) if (fwrite(buf,1,n,fo)!=n) fail=1;
+  fclose(fi);
+  if (fclose(fo)!=0) fail=1;
+  if ((!fail) && (rename(tmpname, out)!=0)) fail=1;
+  if (fail) { remove(tmpname); return NULL; }
+  return out;
+ }
+
+// Gather the postscript text of a page into a single null-terminated string
+static char *dviCacheText(postscriptPage *page)
+ {
+  postscriptChunk *chunk;
+  char            *out = (char *)ppl_memAlloc(page->textLen+1);
+  long             pos = 0;
+  if (out==NULL) return NULL;
+  for (chunk=page->first; chunk!=NULL; chunk=chunk->next) { memcpy(out+pos, chunk->data, chunk->len); pos+=chunk->len; }
+  out[pos]='\0';
+  return out;
+ }
+
+void dviCacheStore(pplerr_context *ec, const char *dir, const char *preamble, const char *text, postscriptPage *page, list *fonts)
+ {
+  char            filename[FNAME_LENGTH], tmpname[FNAME_LENGTH], path[FNAME_LENGTH], key[SSTR_LENGTH], *ps;
+  char            pfaStore[DVICACHE_MAXFONTS][FNAME_LENGTH];
+  dviFontDetails *used[DVICACHE_MAXFONTS];
+  const char     *tempdir = ec->session_default.tempdir;
+  listIterator   *li;
+  long            lenPS=0;
+  int             Nfonts=0, i, fail=0;
+  FILE           *f;
+
+  if ((page==NULL) || (page->boundingBox==NULL) || (page->textSizeBox==NULL)) return;
+  dviCacheDir(ec, dir, path);
+  mkdir(path, 0755); // If this fails, so will writing the cache file
+
+  // Work out which fonts this page selects
+  if ((ps = dviCacheText(page))==NULL) return;
+  lenPS = page->textLen;
+  for (li=ppl_listIterateInit(fonts); li!=NULL; ppl_listIterate(&li))
+   {
+    dviFontDetails *font = (dviFontDetails *)li->data;
+    if (font->psName==NULL) continue;
+    snprintf(key, SSTR_LENGTH, "/%s ", font->psName);
+    for (i=0; i<Nfonts; i++) if (strcmp(used[i]->psName, font->psName)==0) break;
+    if (i<Nfonts) continue;
+    if (strstr(ps, key)==NULL) continue;
+    if (Nfonts>=DVICACHE_MAXFONTS) return;
+    pfaStore[Nfonts][0]='\0';
+    if (font->pfaPath!=NULL)
+     {
+      if (strncmp(font->pfaPath, tempdir, strlen(tempdir))!=0) snprintf(pfaStore[Nfonts], FNAME_LENGTH, "%s", font->pfaPath);
+      else if (dviCachePfa(ec, dir, font, pfaStore[Nfonts])==NULL) return;
+     }
+    used[Nfonts++] = font;
+   }
+
+  // Write to a temporary file, and then rename it into place, so that other processes never see a partial entry
+  dviCacheFilename(ec, dir, preamble, text, filename);
+  snprintf(tmpname, FNAME_LENGTH, "%s.%d", filename, (int)getpid());
+  tmpname[FNAME_LENGTH-1]='\0';
+  if ((f=fopen(tmpname,"wb"))==NULL) return;
+  if (fprintf(f, "%s\n%ld %ld %ld %d\n", DVICACHE_MAGIC, (long)strlen(preamble), (long)strlen(text), lenPS, Nfonts) < 0) fail=1;
+  for (i=0; i<4; i++) if (fprintf(f, "%a ", page->boundingBox[i]) < 0) fail=1;
+  for (i=0; i<4; i++) if (fprintf(f, (i<3)?"%a ":"%a\n", page->textSizeBox[i]) < 0) fail=1;
+  for (i=0; i<Nfonts; i++)
+    if (fprintf(f, "%ld %ld\n%s\n%s\n", (long)strlen(used[i]->psName), (long)strlen(pfaStore[i]), used[i]->psName, pfaStore[i]) < 0) fail=1;
+  if (fputs(preamble, f)==EOF) fail=1;
+  if (fputs(text    , f)==EOF) fail=1;
+  if (fwrite(ps, 1, lenPS, f)!=(size_t)lenPS) fail=1;
+  if (fclose(f)!=0) fail=1;
+  if ((!fail) && (rename(tmpname, filename)!=0)) fail=1;
+  if (fail) remove(tmpname);
+  return;
+ }
+
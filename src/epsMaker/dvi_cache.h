@@ -0,0 +1,47 @@
+// dvi_cache.h
+//
+// The code in this file is part of Pyxplot
+// <http://www.pyxplot.org.uk>
+//
+// Copyright (C) 2006-2013 Dominic Ford <coders@pyxplot.org.uk>
+//               2008-2013 Ross Church
+//
+// $Id$
+//
+// Pyxplot is free software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation; either version 2 of the License, or (at your option) any later
+// version.
+//
+// You should have received a copy of the GNU General Public License along with
+// Pyxplot; if not, write to the Free Software Foundation, Inc., 51 Franklin
+// Street, Fifth Floor, Boston, MA  02110-1301, USA
+
+// ----------------------------------------------------------------------------
+
+// Cache of typeset text items. When Pyxplot is run with the --latex-cache switch, the page of postscript which the
+// DVI interpreter produces for each text item is stored in the given directory, so that any later plot which
+// contains the same text, typeset with the same preamble, need not pass it to latex again. Each item is stored in a
+// file named after hashes of the preamble and of the text, which contains:
+//
+// the line DVICACHE_MAGIC, the lengths of the preamble, text and postscript, the number of fonts used, the bounding
+// box and the text size box, and for each font, its postscript name and the path of its PFA file. These are
+// followed by the preamble, the text and the postscript themselves.
+//
+// PFA files which were converted from PFB files into the temporary directory are copied into the cache directory.
+// An entry which does not match its preamble and text exactly, or whose PFA files have gone away, is ignored.
+
+#ifndef _PPL_DVI_CACHE_H
+#define _PPL_DVI_CACHE_H 1
+
+#include "coreUtils/errorReport.h"
+#include "coreUtils/list.h"
+#include "epsMaker/dvi_read.h"
+
+#define DVICACHE_MAGIC "PyxplotTeX1 " VERSION " " DATE
+
+postscriptPage *dviCacheFetch(pplerr_context *ec, const char *dir, const char *preamble, const char *text, list *fonts);
+void            dviCacheStore(pplerr_context *ec, const char *dir, const char *preamble, const char *text, postscriptPage *page, list *fonts);
+
+#endif
+
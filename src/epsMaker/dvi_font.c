@@ -25,6 +25,7 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "coreUtils/dict.h"
 #include "coreUtils/errorReport.h"
 #include "coreUtils/memAlloc.h"
 #include "stringTools/strConstants.h"
@@ -42,7 +43,140 @@ char builtinFontNames[N_BUILTIN_FONTS][L_BUILTIN_FPSNAME] = {"Times-Bold", "Time
 
 int dviGetPfa(pplerr_context *ec, dviFontDetails *font, char *filename);
 
+// Process-wide cache of the fonts which have been loaded, keyed on font name. A font's metrics, postscript name and
+// PFA file depend only on its name, and are held in malloced memory outside of ppl_memAlloc's contexts, so that they
+// outlive the render in which they were first loaded. PFA files converted from PFB files stay in the temporary
+// directory until Pyxplot exits. The maximum glyph sizes depend on the size at which a font is used, and are
+// recomputed, without any file access, for each font definition.
+typedef struct dviFontCacheEntry {
+  dviTFM *tfm;
+  char   *psName, *pfaPath;
+  int     fontType;
+ } dviFontCacheEntry;
+
+// Contents of PFA files which have been embedded in output, keyed on their paths
+typedef struct dviPfaCacheEntry {
+  long len;
+  char text[1];
+ } dviPfaCacheEntry;
+
+static dict *dviFontCache = NULL;
+static dict *dviPfaCache  = NULL;
+static long  dviFontCacheHits=0, dviFontCacheMisses=0, dviPfaCacheHits=0, dviPfaCacheMisses=0;
+
+static void *dviFontCacheDup(const void *in, long n)
+ {
+  void *out = malloc((n>0) ? n : 1);
+  if ((out!=NULL) && (n>0)) memcpy(out, in, n);
+  return out;
+ }
+
+static char *dviFontCacheStrdup(const char *in)
+ {
+  if (in==NULL) return NULL;
+  return (char *)dviFontCacheDup(in, strlen(in)+1);
+ }
+
+// Copy a TFM, which is read-only once loaded, into malloced memory
+static dviTFM *dviFontCacheTFM(dviTFM *in)
+ {
+  dviTFM *out = (dviTFM *)dviFontCacheDup(in, sizeof(dviTFM));
+  if (out==NULL) return NULL;
+  out->charInfo         = (TFMcharInfo *)dviFontCacheDup(in->charInfo        , (in->ec-in->bc+1)*sizeof(TFMcharInfo));
+  out->width            = (double      *)dviFontCacheDup(in->width           , in->nw*sizeof(double));
+  out->height           = (double      *)dviFontCacheDup(in->height          , in->nh*sizeof(double));
+  out->depth            = (double      *)dviFontCacheDup(in->depth           , in->nd*sizeof(double));
+  out->italic           = (double      *)dviFontCacheDup(in->italic          , in->ni*sizeof(double));
+  out->ligKern          = (TFMligKern  *)dviFontCacheDup(in->ligKern         , in->nl*sizeof(TFMligKern));
+  out->kern             = (double      *)dviFontCacheDup(in->kern            , in->nk*sizeof(double));
+  out->extensibleRecipe = (TFMextRec   *)dviFontCacheDup(in->extensibleRecipe, in->ne*sizeof(TFMextRec));
+  out->param            = NULL; // Never read
+  if ((out->charInfo==NULL) || (out->width==NULL) || (out->height==NULL) || (out->depth==NULL) || (out->italic==NULL) ||
+      (out->ligKern==NULL) || (out->kern==NULL) || (out->extensibleRecipe==NULL)) return NULL; // Leaks, but only when out of memory
+  return out;
+ }
+
+static int dviLoadFont(pplerr_context *ec, dviFontDetails *font);
+
 int dviGetTFM(pplerr_context *ec, dviFontDetails *font)
+ {
+  dviFontCacheEntry *e, new;
+  int                err;
+
+  if (dviFontCache==NULL) dviFontCache = ppl_dictInit(1);
+  if ((dviFontCache!=NULL) && ((e = (dviFontCacheEntry *)ppl_dictLookup(dviFontCache, font->name))!=NULL))
+   {
+    dviFontCacheHits++;
+    font->tfm      = e->tfm;
+    font->psName   = e->psName;
+    font->pfaPath  = e->pfaPath;
+    font->fontType = e->fontType;
+    return dviFindMaxSize(ec, font);
+   }
+  dviFontCacheMisses++;
+
+  err = dviLoadFont(ec, font);
+  if ((err) || (dviFontCache==NULL)) return err;
+
+  // Store font in cache. If we run out of memory, it simply doesn't get cached.
+  new.tfm      = dviFontCacheTFM(font->tfm);
+  new.psName   = dviFontCacheStrdup(font->psName);
+  new.pfaPath  = dviFontCacheStrdup(font->pfaPath);
+  new.fontType = font->fontType;
+  if ((new.tfm!=NULL) && (new.psName!=NULL) && ((new.pfaPath!=NULL) || (font->pfaPath==NULL)))
+    ppl_dictAppendCpy(dviFontCache, font->name, (void *)&new, sizeof(new));
+  return 0;
+ }
+
+// Return the contents of a PFA file, which are cached for the life of the process. Returns NULL if the file cannot
+// be read.
+char *dviGetPfaText(pplerr_context *ec, char *PFApath, long *len)
+ {
+  dviPfaCacheEntry *e;
+  FILE             *fp;
+  long              n;
+
+  if (dviPfaCache==NULL) dviPfaCache = ppl_dictInit(1);
+  if ((dviPfaCache!=NULL) && ((e = (dviPfaCacheEntry *)ppl_dictLookup(dviPfaCache, PFApath))!=NULL))
+   {
+    dviPfaCacheHits++;
+    *len = e->len;
+    return e->text;
+   }
+  dviPfaCacheMisses++;
+
+  if ((fp = fopen(PFApath, "r"))==NULL) return NULL;
+  if ((fseek(fp,0,SEEK_END)!=0) || ((n=ftell(fp))<0) || (fseek(fp,0,SEEK_SET)!=0)) { fclose(fp); return NULL; }
+  e = (dviPfaCacheEntry *)malloc(sizeof(dviPfaCacheEntry) + n);
+  if (e==NULL) { ppl_error(ec, ERR_MEMORY, -1, -1,"Out of memory"); fclose(fp); return NULL; }
+  if (fread(e->text, 1, n, fp)!=(size_t)n) { free(e); fclose(fp); return NULL; }
+  fclose(fp);
+  e->len = n;
+  e->text[n] = '\0';
+  if ((dviPfaCache==NULL) || (ppl_dictAppend(dviPfaCache, PFApath, (void *)e)!=0))
+   {
+    // Could not cache the file; hand it back in the current memory context instead
+    char *s = (char *)ppl_memAlloc(n+1);
+    if (s!=NULL) memcpy(s, e->text, n+1);
+    free(e);
+    *len = n;
+    return s;
+   }
+  *len = n;
+  return e->text;
+ }
+
+void dviFontCacheStats(int *Nfonts, long *fontHits, long *fontMisses, long *pfaHits, long *pfaMisses)
+ {
+  if (Nfonts    !=NULL) *Nfonts     = (dviFontCache==NULL) ? 0 : ppl_dictLen(dviFontCache);
+  if (fontHits  !=NULL) *fontHits   = dviFontCacheHits;
+  if (fontMisses!=NULL) *fontMisses = dviFontCacheMisses;
+  if (pfaHits   !=NULL) *pfaHits    = dviPfaCacheHits;
+  if (pfaMisses !=NULL) *pfaMisses  = dviPfaCacheMisses;
+ }
+
+// Find a font's TFM and PFA files, and read its metrics
+static int dviLoadFont(pplerr_context *ec, dviFontDetails *font)
  {
   char *TFMpath;
   char *s;
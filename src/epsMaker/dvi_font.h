@@ -108,6 +108,8 @@ typedef struct dviFontDetails
 
 // Call the first of these functions, passing it a font structure. It will find and read the corresponding TFM file.
 int     dviGetTFM     (pplerr_context *ec, dviFontDetails *font);
+char   *dviGetPfaText (pplerr_context *ec, char *PFApath, long *len);
+void    dviFontCacheStats(int *Nfonts, long *fontHits, long *fontMisses, long *pfaHits, long *pfaMisses);
 dviTFM *dviReadTFM    (pplerr_context *ec, FILE *fp, int *err);
 int     dviFindMaxSize(pplerr_context *ec, dviFontDetails *font);
 int     pfb2pfa       (pplerr_context *ec, FILE *in, FILE *out);
@@ -869,8 +869,8 @@ postscriptPage *dviNewPostscriptPage(pplerr_context *ec)
   page->textSizeBox = NULL;
   //page->position[0] = 0;
   //page->position[1] = 0;
-  page->text = ppl_listInit(0);
-  if (page->text==NULL) { ppl_error(ec, ERR_MEMORY, -1, -1, "Out of memory"); return NULL; }
+  page->first = page->last = NULL;
+  page->textLen = 0;
   //page->currentPosition = NULL; // No position set initially
   return page;
  }
@@ -907,18 +907,31 @@ int dviDeletePostscriptState(pplerr_context *ec, postscriptState *state)
 // Functions for producing postscript commands
 // -------------------------------------------
 
-// Append a string to the set of postscript strings
+// Append a string to the postscript text of the current page
 int dviPostscriptAppend(pplerr_context *ec, dviInterpreterState *interp, char *new)
  {
-  char *s;  // A temporary string pointer
-  int len;
+  return dviPageAppend(ec, interp->output->currentPage, new, strlen(new));
+ }
 
-  // Grab the new string and copy it into place
-  len = strlen(new)+1;
-  s = (char *)ppl_memAlloc(len);
-  if (s==NULL) { ppl_error(ec, ERR_MEMORY, -1, -1, "Out of memory"); return DVIE_MEMORY; }
-  strncpy(s, new, len);
-  ppl_listAppend(interp->output->currentPage->text, (void *)s);
+// Append len bytes to the postscript text of a page, starting a new chunk when the last one is full
+int dviPageAppend(pplerr_context *ec, postscriptPage *page, const char *s, long len)
+ {
+  postscriptChunk *chunk = page->last;
+  if ((chunk==NULL) || (chunk->alloc - chunk->len < len))
+   {
+    long alloc = (len > DVI_PSCHUNK) ? len : DVI_PSCHUNK;
+    chunk = (postscriptChunk *)ppl_memAlloc(sizeof(postscriptChunk) + alloc);
+    if (chunk==NULL) { ppl_error(ec, ERR_MEMORY, -1, -1, "Out of memory"); return DVIE_MEMORY; }
+    chunk->next  = NULL;
+    chunk->len   = 0;
+    chunk->alloc = alloc;
+    if (page->last==NULL) page->first      = chunk;
+    else                  page->last->next = chunk;
+    page->last = chunk;
+   }
+  memcpy(chunk->data + chunk->len, s, len);
+  chunk->len    += len;
+  page->textLen += len;
   return 0;
  }
 
@@ -1003,7 +1016,7 @@ int dviTypeset(pplerr_context *ec, dviInterpreterState *interp)
   char *s;
   double width, height, depth, italic;
   double size[4];               // Width, height, depth
-  int chars, err=0;
+  int err=0;
 
   postPos = interp->output->currentPosition;
   dviPos = interp->state;
@@ -1045,14 +1058,10 @@ int dviTypeset(pplerr_context *ec, dviInterpreterState *interp)
   // Only need to consider extra italic width for the final glyph
   if ((err=dviUpdateBoundingBox(ec, interp, width+italic, height, depth))!=0) return err;
 
-  // Count the number of characters to write to the ps string
-  chars = strlen(interp->currentString)+9;
-  s = (char *)ppl_memAlloc(chars);
-  if (s==NULL) { ppl_error(ec, ERR_MEMORY, -1, -1, "Out of memory"); return DVIE_MEMORY; }
-  snprintf(s, chars, "(%s) show\n", interp->currentString);
-
   // Send the string off to the postscript routine and clean up memory
-  if ((err=dviPostscriptAppend(ec, interp, s))!=0) return err;
+  if ((err=dviPostscriptAppend(ec, interp, "("                  ))!=0) return err;
+  if ((err=dviPostscriptAppend(ec, interp, interp->currentString))!=0) return err;
+  if ((err=dviPostscriptAppend(ec, interp, ") show\n"           ))!=0) return err;
   //free(s);
   //free(interp->currentString);
   interp->currentString = NULL;
@@ -1068,8 +1077,8 @@ int dviTypeset(pplerr_context *ec, dviInterpreterState *interp)
 int dviChngFnt(pplerr_context *ec, dviInterpreterState *interp, int fn)
  {
   listIterator *listIter;
-  int len, err=0;
-  char *s;
+  int err=0;
+  char s[SSTR_LENGTH];
   dviFontDetails *font;
   double size;
 
@@ -1097,12 +1106,9 @@ int dviChngFnt(pplerr_context *ec, dviInterpreterState *interp, int fn)
 
   // Produce an appropriate postscript command
   font = (dviFontDetails *)listIter->data;
-  len = strlen(font->psName) + 20;
-  s = (char *)ppl_memAlloc(len);
-  if (s==NULL) { ppl_error(ec, ERR_MEMORY, -1, -1, "Out of memory"); return DVIE_MEMORY; }
   size = font->useSize*interp->scale;
   if (DEBUG) { sprintf(ec->tempErrStr, "DVI: Font useSize %d size %g changed to %d", font->useSize, size, (int)ceil(size-.5)); ppl_log(ec, NULL); }
-  snprintf(s, len, "/%s %d selectfont\n", font->psName, (int)ceil(size-.5));
+  snprintf(s, SSTR_LENGTH, "/%s %d selectfont\n", font->psName, (int)ceil(size-.5));
   if ((err=dviPostscriptAppend(ec, interp, s))!=0) return err;
   //free(s);
   return 0;
@@ -46,12 +46,23 @@ typedef struct dviStackState
   signed long int h,v,w,x,y,z;
  } dviStackState;
 
+// Postscript text is accumulated in a chain of chunks, each of which holds at least DVI_PSCHUNK bytes
+#define DVI_PSCHUNK 8192
+
+typedef struct postscriptChunk
+ {
+  struct postscriptChunk *next;
+  long len, alloc;      // Number of bytes used, and available, in data
+  char data[1];
+ } postscriptChunk;
+
 // Structure to store a page of postscript
 typedef struct postscriptPage
  {
   double *boundingBox;  // The current bounding box
   double *textSizeBox;  // The current text size box (b.box plus oversize text)
-  list *text;           // The big list of strings of postscript
+  postscriptChunk *first, *last; // The postscript text (not null terminated)
+  long textLen;         //   and its total length
  } postscriptPage;
 
 // Structure to store the state of some postscript in the process of being produced
@@ -98,6 +109,7 @@ int dviDeletePostscriptState(pplerr_context *ec, postscriptState *state);
 
 int dviPostscriptMoveto(pplerr_context *ec, dviInterpreterState *interp);
 int dviPostscriptAppend(pplerr_context *ec, dviInterpreterState *interp, char *s);
+int dviPageAppend(pplerr_context *ec, postscriptPage *page, const char *s, long len);
 
 int dviGetCharSize(pplerr_context *ec, dviInterpreterState *interp, unsigned char s, double *size);
 
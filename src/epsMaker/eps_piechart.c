@@ -58,6 +58,7 @@
 #include "epsMaker/eps_settings.h"
 
 #include "datafile.h"
+#include "datafile_cache.h"
 #include "datafile_rasters.h"
 
 #define COUNTERR_BEGIN if (errCount> 0) { errCount--;
@@ -131,7 +132,7 @@ void eps_pie_ReadAccessibleData(EPSComm *x)
   if (pd->filename != NULL) // Read data from file
    {
     if (DEBUG) { sprintf(c->errcontext.tempErrStr, "Reading data from file '%s' for piechart item %d", pd->filename, x->current->id); ppl_log(&c->errcontext,NULL); }
-    if (pd->PersistentDataTable==NULL) ppldata_fromFile(c, x->current->plotdata, pd->filename, 0, NULL, NULL, pd->index, UsingList, autoUsingList, NExpect, nObjs, LabelExpr, pd->SelectCriterion, NULL, pd->UsingRowCols, pd->EveryList, pd->continuity, 0, &status, c->errcontext.tempErrStr, &errCount, x->iterDepth+1);
+    if (pd->PersistentDataTable==NULL) ppldata_fromFileCached(c, x->current->plotdata, pd->filename, NULL, pd->index, UsingList, autoUsingList, NExpect, nObjs, LabelExpr, pd->SelectCriterion, pd->UsingRowCols, pd->EveryList, pd->continuity, &status, c->errcontext.tempErrStr, &errCount, x->iterDepth+1);
     else                               x->current->plotdata[0] = pd->PersistentDataTable;
    }
   else if (pd->vectors != NULL)
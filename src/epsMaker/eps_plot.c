@@ -69,6 +69,7 @@
 #include "epsMaker/eps_settings.h"
 
 #include "datafile.h"
+#include "datafile_cache.h"
 #include "datafile_rasters.h"
 
 // If a plot dataset has any with_words of the form "with linewidth $4", these
@@ -469,7 +470,7 @@ void eps_plot_ReadAccessibleData(EPSComm *x)
           if (pd->PersistentDataTable==NULL)
            {
             char *fnameFinal, tmp[FNAME_LENGTH]="";
-            ppldata_fromFile(c, x->current->plotdata+i, pd->filename, 0, tmp, NULL, pd->index, UsingList, autoUsingList, NExpect, nObjs, pd->label, pd->SelectCriterion, NULL, pd->UsingRowCols, pd->EveryList, pd->continuity, 0, &status, c->errcontext.tempErrStr, &errCount, x->iterDepth+1);
+            ppldata_fromFileCached(c, x->current->plotdata+i, pd->filename, tmp, pd->index, UsingList, autoUsingList, NExpect, nObjs, pd->label, pd->SelectCriterion, pd->UsingRowCols, pd->EveryList, pd->continuity, &status, c->errcontext.tempErrStr, &errCount, x->iterDepth+1);
             fnameFinal = (char *)ppl_memAlloc(strlen(tmp)+1);
             if (fnameFinal!=NULL) strcpy(fnameFinal, tmp);
             pd->filenameFinal = fnameFinal;
@@ -710,7 +711,7 @@ void eps_plot_SampleFunctions(EPSComm *x)
 
       if (DEBUG) { sprintf(c->errcontext.tempErrStr, "Reading data from functions for dataset %d in plot item %d", i+1, x->current->id); ppl_log(&c->errcontext,NULL); }
 
-      // Get data from functions
+      // Get data from functions; ppldata_fromFuncs() evaluates these row by row, as they depend upon the ordinate
       SpecialRaster = OrdinateRaster;
       Nsamples      = OrdinateRasterLen;
       if (!SampleGrid)
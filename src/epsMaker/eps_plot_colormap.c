@@ -28,6 +28,7 @@
 #include <gsl/gsl_math.h>
 
 #include "coreUtils/memAlloc.h"
+#include "coreUtils/workerPool.h"
 
 #include "canvasItems.h"
 #include "coreUtils/errorReport.h"
@@ -209,6 +210,51 @@ void eps_plot_colormap_YieldText(EPSComm *x, dataTable *data, pplset_graph *sg,
   return;
  }
 
+// Work shared between the threads which render rows of a colormap in eps_plot_colormap_greyRows
+typedef struct colormapGreyJob
+ {
+  const double  *data;
+  unsigned char *out;
+  int            XSize, YSize, Ncol_real;
+  unsigned char  renorm, log;
+  double         CMin, CMax;
+ } colormapGreyJob;
+
+// Render rows jMin <= j < jMax of a colormap which has neither a mask nor a custom color expression, in which case
+// each pixel is a grey level depending only upon c1. This does exactly the same arithmetic as SET_RGB_COLOR below,
+// but touches no interpreter state, and so rows may be processed concurrently.
+static void eps_plot_colormap_greyRows(void *arg, int jMin, int jMax)
+ {
+  const colormapGreyJob *job = (const colormapGreyJob *)arg;
+  int i, j;
+  for (j=jMin; j<jMax; j++)
+   {
+    long p = 3*((long)job->XSize)*(job->YSize-1-j); // Postscript images are top-first. Data block is bottom-first.
+    for (i=0; i<job->XSize; i++)
+     {
+      double        val = job->data[2 + job->Ncol_real*(i+((long)job->XSize)*j)];
+      double        comp[4]={0,0,0,0};
+      unsigned char component_r, component_g, component_b;
+
+      if      (!job->renorm)             comp[0] = val;
+      else if (job->CMax==job->CMin)     comp[0] = gsl_finite(val)?0.5:(GSL_NAN);
+      else if (!job->log)                comp[0] = (val - job->CMin) / (job->CMax - job->CMin);
+      else                               comp[0] = log(val / job->CMin) / log(job->CMax / job->CMin);
+      comp[1] = comp[2] = comp[0];
+      CLIP_COMPS;
+
+      component_r = (unsigned char)floor(comp[0] * 255.99);
+      component_g = (unsigned char)floor(comp[1] * 255.99);
+      component_b = (unsigned char)floor(comp[2] * 255.99);
+      if ((component_r==TRANS_R)&&(component_g==TRANS_G)&&(component_b==TRANS_B)) component_b++;
+      job->out[p++] = component_r;
+      job->out[p++] = component_g;
+      job->out[p++] = component_b;
+     }
+   }
+  return;
+ }
+
 // Render a colormap to postscript
 int  eps_plot_colormap(EPSComm *x, dataTable *data, unsigned char ThreeDim, int xn, int yn, int zn, pplset_graph *sg, canvas_plotdesc *pd, int pdn, double origin_x, double origin_y, double width, double height, double zdepth)
  {
@@ -372,8 +418,23 @@ int  eps_plot_colormap(EPSComm *x, dataTable *data, unsigned char ThreeDim, int
      return 1;
     }
 
-  // Populate bitmap data array
-  for (p=0, j=YSize-1; j>=0; j--) // Postscript images are top-first. Data block is bottom-first.
+  // Populate bitmap data array. Greyscale colormaps may be rendered by many threads, but mask and color expressions
+  // must be evaluated by the interpreter, which is single threaded.
+  if ((sg->MaskExpr==NULL) && (sg->ColMapExpr==NULL) && (cmax>=0))
+   {
+    colormapGreyJob job;
+    job.data      = blk->data_real;
+    job.out       = img.data;
+    job.XSize     = XSize;
+    job.YSize     = YSize;
+    job.Ncol_real = Ncol_real;
+    job.renorm    = (sg->Crenorm[0]!=SW_BOOL_FALSE);
+    job.log       = CLog[0];
+    job.CMin      = CMin[0];
+    job.CMax      = CMax[0];
+    ppl_workerRunRows(x->c->set->term_current.threads, YSize, eps_plot_colormap_greyRows, &job);
+   }
+  else for (p=0, j=YSize-1; j>=0; j--) // Postscript images are top-first. Data block is bottom-first.
    for (i=0; i<XSize; i++)
     {
      // Set values of c1...c4
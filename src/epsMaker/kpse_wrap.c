@@ -49,8 +49,24 @@ char          *ppl_kpse_PathList     [3][MAX_PATHS];
 unsigned char  ppl_kpse_PathRecursive[3][MAX_PATHS];
 #endif
 
+// Font search paths are looked up on the first call to ppl_kpse_wrap_load(), rather than at startup, since scripts
+// which produce no text output never need them
+static ppl_context *ppl_kpse_context = NULL;
+static int          ppl_kpse_loaded  = 0;
+
 void ppl_kpse_wrap_init(ppl_context *c)
  {
+  ppl_kpse_context = c;
+  ppl_kpse_loaded  = 0;
+  return;
+ }
+
+void ppl_kpse_wrap_load()
+ {
+  ppl_context    *c = ppl_kpse_context;
+  if (ppl_kpse_loaded) return;
+  ppl_kpse_loaded = 1;
+  if (DEBUG) ppl_log(&c->errcontext, "Looking up font search paths.");
   #ifdef HAVE_KPATHSEA
   kpse_set_program_name("dvips", "dvips");
   #else
@@ -191,6 +207,7 @@ char *ppl_kpse_wrap_find_file(pplerr_context *ec, char *s, char **paths, unsigne
 
 char *ppl_kpse_wrap_find_pfa(pplerr_context *ec, char *s)
  {
+  ppl_kpse_wrap_load();
   #ifdef HAVE_KPATHSEA
   return (char *)kpse_find_file(s, kpse_type1_format, true);
   #else
@@ -200,6 +217,7 @@ char *ppl_kpse_wrap_find_pfa(pplerr_context *ec, char *s)
 
 char *ppl_kpse_wrap_find_pfb(pplerr_context *ec, char *s)
  {
+  ppl_kpse_wrap_load();
   #ifdef HAVE_KPATHSEA
   return (char *)kpse_find_file(s, kpse_type1_format, true);
   #else
@@ -209,6 +227,7 @@ char *ppl_kpse_wrap_find_pfb(pplerr_context *ec, char *s)
 
 char *ppl_kpse_wrap_find_tfm(pplerr_context *ec, char *s)
  {
+  ppl_kpse_wrap_load();
   #ifdef HAVE_KPATHSEA
   return (char *)kpse_find_tfm(s);
   #else
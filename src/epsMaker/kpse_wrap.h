@@ -25,6 +25,7 @@
 #include "userspace/context.h"
 
 void  ppl_kpse_wrap_init    (ppl_context *c);
+void  ppl_kpse_wrap_load    ();
 char *ppl_kpse_wrap_find_pfa(pplerr_context *ec, char *s);
 char *ppl_kpse_wrap_find_pfb(pplerr_context *ec, char *s);
 char *ppl_kpse_wrap_find_tfm(pplerr_context *ec, char *s);
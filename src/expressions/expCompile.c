@@ -598,6 +598,7 @@ void ppl_expCompile(ppl_context *context, int srcLineN, long srcId, char *srcFna
   int              outpos = 0, lastoutpos = -1;
   pplExprBytecode *out;
   int              outlen = 512;
+  int              Nslots = 0;
 
   // malloc output structure
   *outExpr = (pplExpr *)calloc(1,sizeof(pplExpr));
@@ -606,7 +607,7 @@ void ppl_expCompile(ppl_context *context, int srcLineN, long srcId, char *srcFna
   (*outExpr)->srcId    = srcId;
   (*outExpr)->srcLineN = srcLineN;
   (*outExpr)->srcFname = (char *)malloc(strlen(srcFname)+1);
-  out = (*outExpr)->bytecode = malloc(outlen * sizeof(pplExprBytecode));
+  out = (*outExpr)->bytecode = calloc(outlen, sizeof(pplExprBytecode)); // Zeroed, so that padding and unused operand bytes are the same on every run
   if (((*outExpr)->bytecode==NULL)||((*outExpr)->srcFname==NULL)) { *errPos=0; *errType=ERR_MEMORY; strcpy(errText, "Out of memory."); *end=-1; return; }
   strcpy((*outExpr)->srcFname , srcFname);
 
@@ -655,6 +656,7 @@ void ppl_expCompile(ppl_context *context, int srcLineN, long srcId, char *srcFna
       outlen+=2048;
       out = (*outExpr)->bytecode = realloc(out, outlen*sizeof(pplExprBytecode));
       if (out==NULL) { *errPos=0; *errType=ERR_MEMORY; strcpy(errText, "Out of memory."); *end=-1; return; }
+      memset(out+outlen-2048, 0, 2048*sizeof(pplExprBytecode));
      }
 
     if (o=='B') // Process a string literal
@@ -829,7 +831,7 @@ void ppl_expCompile(ppl_context *context, int srcLineN, long srcId, char *srcFna
      {
       char *strout = (char *)(out+outpos+1);
       int   slen   = 0;
-      if      (o=='G') BYTECODE_OP(3) // foo -- op 3: variable lookup "foo"
+      if      (o=='G') { BYTECODE_OP(3); out[outpos].auxil.i = Nslots++; } // foo -- op 3: variable lookup "foo", with inline cache slot
       else if (o=='T') BYTECODE_OP(5) // foo.bar -- op 5: dereference "bar"
       else             BYTECODE_OP(2) // $foo -- push "foo" onto stack as a string constant
       while ((tpos<tlen) && (tdata[tpos].state == o))
@@ -970,6 +972,14 @@ void ppl_expCompile(ppl_context *context, int srcLineN, long srcId, char *srcFna
   BYTECODE_ENDOP;
   (*outExpr)->bcLen = outpos * sizeof(pplExprBytecode);
 
+  // Allocate inline caches for variable lookups
+  if (Nslots>0)
+   {
+    (*outExpr)->slots = (pplExprSlot *)calloc(Nslots, sizeof(pplExprSlot));
+    if ((*outExpr)->slots==NULL) { *errPos=0; *errType=ERR_MEMORY; strcpy(errText, "Out of memory."); *end=-1; return; }
+    (*outExpr)->Nslots = Nslots;
+   }
+
   // Optimise gotos that point directly at other gotos
    {
     int optimised;
@@ -1205,6 +1215,7 @@ void pplExpr_free(pplExpr *inExpr)
   if (inExpr->ascii!=NULL) free(inExpr->ascii);
   if (inExpr->srcFname!=NULL) free(inExpr->srcFname);
   if (inExpr->bytecode!=NULL) free(inExpr->bytecode);
+  if (inExpr->slots!=NULL) free(inExpr->slots);
   free(inExpr);
   return;
  }
@@ -1220,6 +1231,7 @@ pplExpr *pplExpr_cpy(pplExpr *i)
   if (i->ascii   !=NULL) { if ((o->ascii   =malloc(strlen(i->ascii   )+1))==NULL) return NULL; strcpy(o->ascii   , i->ascii   ); }
   if (i->srcFname!=NULL) { if ((o->srcFname=malloc(strlen(i->srcFname)+1))==NULL) return NULL; strcpy(o->srcFname, i->srcFname); }
   if (i->bytecode!=NULL) { if ((o->bytecode=malloc(i->bcLen             ))==NULL) return NULL; memcpy(o->bytecode, i->bytecode, i->bcLen); }
+  if (i->slots   !=NULL) { if ((o->slots   =calloc(i->Nslots, sizeof(pplExprSlot)))==NULL) return NULL; }
   return o;
  }
 
@@ -1234,6 +1246,7 @@ pplExpr *pplExpr_tmpcpy(pplExpr *i)
   if (i->ascii   !=NULL) { if ((o->ascii   =ppl_memAlloc(strlen(i->ascii   )+1))==NULL) return NULL; strcpy(o->ascii   , i->ascii   ); }
   if (i->srcFname!=NULL) { if ((o->srcFname=ppl_memAlloc(strlen(i->srcFname)+1))==NULL) return NULL; strcpy(o->srcFname, i->srcFname); }
   if (i->bytecode!=NULL) { if ((o->bytecode=ppl_memAlloc(i->bcLen             ))==NULL) return NULL; memcpy(o->bytecode, i->bytecode, i->bcLen); }
+  if (i->slots   !=NULL) { if ((o->slots   =ppl_memAlloc(i->Nslots*sizeof(pplExprSlot)))==NULL) return NULL; memset(o->slots, 0, i->Nslots*sizeof(pplExprSlot)); }
   return o;
  }
 
@@ -22,10 +22,20 @@
 #ifndef _EXPCOMPILE_H
 #define _EXPCOMPILE_H 1
 
+// Inline cache for a variable lookup instruction. Records where a name was
+// last resolved, together with the generation stamps of the namespaces that
+// were searched, so that repeat evaluations can skip hashing the name.
+typedef struct pplExprSlot {
+  int   nsPtr, nsN, nsFound;
+  long  nsGen[3];
+  void *obj;
+ } pplExprSlot;
+
 typedef struct pplExpr {
   int  refCount;
   long srcId; int srcLineN; char *srcFname;
   char *ascii; void *bytecode; int bcLen;
+  pplExprSlot *slots; int Nslots;
  } pplExpr;
 
 typedef struct pplTokenCode {
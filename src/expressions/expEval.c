@@ -162,6 +162,37 @@ static void expEval_stringSubs(ppl_context *context, pplExpr *inExpr, int charpo
     return;
  }
 
+// Inline caching of variable lookups. A slot is valid only if ns_ptr is unchanged and none of the namespaces
+// searched has had keys added, removed or rebound since the name was resolved, since any of these could
+// change which object the name refers to. Contexts which share bytecode with other threads don't use the cache.
+
+static pplObj *expEval_slotGet(ppl_context *context, pplExprSlot *slot)
+ {
+  int i, n;
+  if ((context->inlineCacheOff) || (slot->obj==NULL) || (slot->nsPtr!=context->ns_ptr)) return NULL;
+  for (i=context->ns_ptr, n=0; n<slot->nsN; i=(i>1)?1:i-1, n++)
+   if ((context->namespaces[i]==NULL) || (context->namespaces[i]->generation!=slot->nsGen[n])) return NULL;
+  return (pplObj *)slot->obj;
+ }
+
+static void expEval_slotSet(ppl_context *context, pplExprSlot *slot, int nsFound, pplObj *obj)
+ {
+  int i, n;
+  if (context->inlineCacheOff) return;
+  slot->obj = NULL;
+  for (i=context->ns_ptr, n=0; n<3; i=(i>1)?1:i-1, n++)
+   {
+    if (context->namespaces[i]==NULL) return;
+    slot->nsGen[n] = context->namespaces[i]->generation;
+    if (i==nsFound) break;
+   }
+  if (n>=3) return;
+  slot->nsPtr   = context->ns_ptr;
+  slot->nsN     = n+1;
+  slot->nsFound = nsFound;
+  slot->obj     = obj;
+ }
+
 #define STACK_POP \
    { \
     context->stackPtr--; \
@@ -222,18 +253,29 @@ pplObj *ppl_expEval(ppl_context *context, pplExpr *inExpr, int *lastOpAssign, in
        }
       case 3: // Lookup value
        {
-        int i , got=0;
+        int i , got=0, shadowed=0;
         char *key = charaux;
+        pplExprSlot *slot = (inExpr->slots!=NULL) ? &inExpr->slots[in[j].auxil.i] : NULL;
+        pplObj *obj = (slot!=NULL) ? expEval_slotGet(context, slot) : NULL;
         *lastOpAssign=0;
+        if ((obj!=NULL)&&(obj->objType!=PPLOBJ_GLOB)&&(obj->objType!=PPLOBJ_ZOM)) // Inline cache hit
+         {
+          pplObjCpy(stk , obj , 1 , 0 , 1);
+          stk->immutable = stk->immutable || context->namespaces[slot->nsFound]->immutable;
+          stk->refCount=1;
+          context->stackPtr++;
+          break;
+         }
         for (i=context->ns_ptr ; i>=0 ; i=(i>1)?1:i-1)
          {
-          pplObj *obj = (pplObj *)ppl_dictLookup(context->namespaces[i] , key);
+          obj = (pplObj *)ppl_dictLookup(context->namespaces[i] , key);
           if (obj==NULL) continue;
-          if ((obj->objType==PPLOBJ_GLOB)||(obj->objType==PPLOBJ_ZOM)) continue;
+          if ((obj->objType==PPLOBJ_GLOB)||(obj->objType==PPLOBJ_ZOM)) { shadowed=1; continue; }
           pplObjCpy(stk , obj , 1 , 0 , 1);
           stk->immutable = stk->immutable || context->namespaces[i]->immutable;
           stk->refCount=1;
           context->stackPtr++;
+          if ((slot!=NULL)&&(!shadowed)) expEval_slotSet(context, slot, i, obj); // A zombie passed over here could be revived in place, so don't cache past one
           got=1;
           break;
          }
@@ -244,7 +286,16 @@ pplObj *ppl_expEval(ppl_context *context, pplExpr *inExpr, int *lastOpAssign, in
        {
         int i;
         char *key = charaux;
+        pplExprSlot *slot = (inExpr->slots!=NULL) ? &inExpr->slots[in[j].auxil.i] : NULL;
+        pplObj *cached = (slot!=NULL) ? expEval_slotGet(context, slot) : NULL;
         *lastOpAssign=0;
+        if ((cached!=NULL)&&(cached->objType!=PPLOBJ_GLOB)&&(!context->namespaces[slot->nsFound]->immutable)) // Inline cache hit
+         {
+          pplObjCpy(stk , cached , 1 , 0 , 1);
+          stk->refCount=1;
+          context->stackPtr++;
+          break;
+         }
         for (i=context->ns_ptr ; ; i=1)
          {
           pplObj *obj = (pplObj *)ppl_dictLookup(context->namespaces[i] , key);
@@ -262,6 +313,7 @@ pplObj *ppl_expEval(ppl_context *context, pplExpr *inExpr, int *lastOpAssign, in
           pplObjCpy(stk , obj , 1 , 0 , 1);
           stk->refCount=1;
           context->stackPtr++;
+          if ((slot!=NULL)&&(i==context->ns_ptr)) expEval_slotSet(context, slot, i, obj);
           break;
          }
         break;
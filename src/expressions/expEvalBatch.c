@@ -0,0 +1,307 @@
+// expEvalBatch.c
+//
+// The code in this file is part of Pyxplot
+// <http://www.pyxplot.org.uk>
+//
+// Copyright (C) 2006-2013 Dominic Ford <coders@pyxplot.org.uk>
+//               2008-2013 Ross Church
+//
+// $Id$
+//
+// Pyxplot is free software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation; either version 2 of the License, or (at your option) any later
+// version.
+//
+// You should have received a copy of the GNU General Public License along with
+// Pyxplot; if not, write to the Free Software Foundation, Inc., 51 Franklin
+// Street, Fifth Floor, Boston, MA  02110-1301, USA
+
+// ----------------------------------------------------------------------------
+
+// Evaluation of pure numeric expressions over whole columns of data at once. An expression is first translated
+// into a short program of arithmetic operations on arrays of doubles; the physical units of every intermediate
+// result are worked out once, at that stage, by applying the usual units arithmetic to a single representative
+// value. The program is then run over chunks of rows without touching the interpreter's stack. Expressions which
+// use anything beyond column references, numeric constants, arithmetic and a handful of common mathematical
+// functions are rejected, and must be evaluated row by row with ppl_expEval().
+
+#define _EXPEVALBATCH_C 1
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <gsl/gsl_math.h>
+
+#include "coreUtils/dict.h"
+#include "coreUtils/memAlloc.h"
+#include "defaultObjs/defaultFuncs.h"
+#include "expressions/expEvalBatch.h"
+#include "settings/settingTypes.h"
+#include "stringTools/strConstants.h"
+#include "userspace/context.h"
+#include "userspace/pplObj_fns.h"
+#include "userspace/pplObjFunc.h"
+#include "userspace/unitsArithmetic.h"
+
+#define BATCH_CONST 0
+#define BATCH_COL   1
+#define BATCH_NEG   2
+#define BATCH_ADD   3
+#define BATCH_SUB   4
+#define BATCH_MUL   5
+#define BATCH_DIV   6
+#define BATCH_POW   7
+#define BATCH_FN    8
+
+#define BATCH_MAXSTACK 64
+
+// System functions which, for real arguments within their domains, return exactly what the C library function
+// alongside returns. Outside of their domains the latter return NaN, and the row is handed back to ppl_expEval().
+static const struct { void *sysFn; double (*fn)(double); } ppl_batchFuncs[] =
+ {
+  { (void *)&pplfunc_abs , &fabs },
+  { (void *)&pplfunc_atan, &atan },
+  { (void *)&pplfunc_cos , &cos  },
+  { (void *)&pplfunc_cosh, &cosh },
+  { (void *)&pplfunc_exp , &exp  },
+  { (void *)&pplfunc_log , &log  },
+  { (void *)&pplfunc_sin , &sin  },
+  { (void *)&pplfunc_sinh, &sinh },
+  { (void *)&pplfunc_sqrt, &sqrt },
+  { (void *)&pplfunc_tan , &tan  },
+  { (void *)&pplfunc_tanh, &tanh },
+  { NULL                 , NULL  }
+ };
+
+typedef struct batchSlot
+ {
+  int      reg;
+  pplFunc *fn;   // Non-NULL if this stack item is a function waiting to be called
+  pplObj   unit;
+ } batchSlot;
+
+static void batchUnit(pplObj *o, const pplObj *src)
+ {
+  pplObjNum(o,0,1,0);
+  o->refCount = 1;
+  if (src!=NULL) ppl_unitsDimCpy(o,src);
+ }
+
+#define BATCH_EMIT(OP,IN0,IN1) \
+ { \
+  if (Ninstr>=PPL_BATCH_MAXINSTR) return 1; \
+  prog[Ninstr].op=OP; prog[Ninstr].in0=IN0; prog[Ninstr].in1=IN1; prog[Ninstr].colNum=0; prog[Ninstr].k=0; prog[Ninstr].fn=NULL; \
+  Ninstr++; \
+ }
+
+// Translate the expression e into a batch program, given the physical units of the Ncols columns of data which it
+// may refer to. Only the first NcolUnits columns have units listed in colUnits; any further columns are dimensionless. Returns zero on success, or one if the expression cannot be evaluated in this way. No error is
+// reported in the latter case; the caller should fall back to ppl_expEval(). Storage is allocated in the current
+// memory context.
+int ppl_expBatchCompile(ppl_context *c, pplExpr *e, int Ncols, pplObj *colUnits, int NcolUnits, pplExprBatch *out)
+ {
+  pplExprBytecode *in = (pplExprBytecode *)e->bytecode;
+  pplBatchInstr    prog[PPL_BATCH_MAXINSTR];
+  batchSlot        stk[BATCH_MAXSTACK];
+  char             errText[LSTR_LENGTH];
+  int              Ninstr=0, sp=0, j=0;
+
+  if (in==NULL) return 1;
+  if (c->set->term_current.ComplexNumbers == SW_ONOFF_ON) return 1;
+
+  while (1)
+   {
+    const int o = in[j].opcode;
+    if (sp>=BATCH_MAXSTACK-1) return 1;
+    switch (o)
+     {
+      case 0: // Return
+        break;
+      case 1: // Numeric literal
+        BATCH_EMIT(BATCH_CONST,-1,-1);
+        prog[Ninstr-1].k = in[j].auxil.d;
+        stk[sp].reg = Ninstr-1;
+        stk[sp].fn  = NULL;
+        batchUnit(&stk[sp].unit, NULL);
+        sp++;
+        break;
+      case 3: // Lookup value; this is bound once, as evaluating the expression cannot change it
+       {
+        char   *key = (char *)&in[j+1];
+        pplObj *obj = NULL;
+        int     i;
+        for (i=c->ns_ptr ; i>=0 ; i=(i>1)?1:i-1)
+         {
+          obj = (pplObj *)ppl_dictLookup(c->namespaces[i] , key);
+          if ((obj==NULL)||(obj->objType==PPLOBJ_GLOB)||(obj->objType==PPLOBJ_ZOM)) { obj=NULL; continue; }
+          break;
+         }
+        if (obj==NULL) return 1;
+        if (obj->objType==PPLOBJ_NUM)
+         {
+          if (obj->flagComplex || obj->tempType) return 1;
+          BATCH_EMIT(BATCH_CONST,-1,-1);
+          prog[Ninstr-1].k = obj->real;
+          stk[sp].reg = Ninstr-1;
+          stk[sp].fn  = NULL;
+          batchUnit(&stk[sp].unit, obj);
+         }
+        else if (obj->objType==PPLOBJ_FUNC)
+         {
+          stk[sp].reg = -1;
+          stk[sp].fn  = (pplFunc *)obj->auxil;
+          if ((stk[sp].fn==NULL)||(obj->self_this!=NULL)) return 1;
+         }
+        else return 1;
+        sp++;
+        break;
+       }
+      case 10: // Function call; only single-argument system functions with C library equivalents are allowed
+       {
+        pplFunc *fn;
+        pplObj   call[2];
+        int      i, status=0, errType=-1;
+        if ((in[j].auxil.i!=1)||(sp<2)) return 1;
+        fn = stk[sp-2].fn;
+        if ((fn==NULL)||(stk[sp-1].fn!=NULL)||(fn->functionType!=PPL_FUNC_SYSTEM)||(fn->minArgs>1)||(fn->maxArgs<1)||fn->needSelfThis) return 1;
+        if (fn->dimlessOnly && !stk[sp-1].unit.dimensionless) return 1;
+        for (i=0; ppl_batchFuncs[i].sysFn!=NULL; i++) if (ppl_batchFuncs[i].sysFn==fn->functionPtr) break;
+        if (ppl_batchFuncs[i].sysFn==NULL) return 1;
+
+        // Call the function once on a representative value to check the units of its argument, and find those of its output
+        batchUnit(&call[0], NULL);
+        batchUnit(&call[1], &stk[sp-1].unit);
+        call[1].real = 0.5;
+        ((void(*)(ppl_context *, pplObj *, int, int *, int *, char *))fn->functionPtr)(c, call+1, 1, &status, &errType, errText);
+        if (status || call[0].flagComplex || (call[0].objType!=PPLOBJ_NUM) || call[0].tempType) return 1;
+
+        BATCH_EMIT(BATCH_FN, stk[sp-1].reg, -1);
+        prog[Ninstr-1].fn = ppl_batchFuncs[i].fn;
+        sp--;
+        stk[sp-1].reg = Ninstr-1;
+        stk[sp-1].fn  = NULL;
+        batchUnit(&stk[sp-1].unit, &call[0]);
+        break;
+       }
+      case 11: // Operator
+       {
+        const int t = in[j].auxil.i;
+        pplObj    res;
+        int       status=0, errType=-1, op;
+        batchUnit(&res, NULL);
+        if ((t==0x25)||(t==0x26)) // Unary operators
+         {
+          if ((sp<1)||(stk[sp-1].fn!=NULL)) return 1;
+          if (t==0x26) break;
+          BATCH_EMIT(BATCH_NEG, stk[sp-1].reg, -1);
+          stk[sp-1].reg = Ninstr-1;
+          break;
+         }
+        if ((sp<2)||(stk[sp-1].fn!=NULL)||(stk[sp-2].fn!=NULL)) return 1;
+        switch (t)
+         {
+          case 0xC9: // **; the units of the result may only depend upon the exponent if it is a constant
+            op = BATCH_POW;
+            if (!stk[sp-1].unit.dimensionless) return 1;
+            if (!stk[sp-2].unit.dimensionless)
+             {
+              pplObj ex;
+              if (prog[stk[sp-1].reg].op!=BATCH_CONST) return 1;
+              batchUnit(&ex, NULL);
+              ex.real = prog[stk[sp-1].reg].k;
+              ppl_uaPow(c, &stk[sp-2].unit, &ex, &res, &status, &errType, errText);
+              if (!gsl_finite(res.real)) return 1;
+             }
+            break;
+          case 0x4A: op=BATCH_MUL; ppl_uaMul(c, &stk[sp-2].unit, &stk[sp-1].unit, &res, &status, &errType, errText); break;
+          case 0x4B: op=BATCH_DIV; ppl_uaDiv(c, &stk[sp-2].unit, &stk[sp-1].unit, &res, &status, &errType, errText); break;
+          case 0x4D: op=BATCH_ADD; ppl_uaAdd(c, &stk[sp-2].unit, &stk[sp-1].unit, &res, &status, &errType, errText); break;
+          case 0x4E: op=BATCH_SUB; ppl_uaSub(c, &stk[sp-2].unit, &stk[sp-1].unit, &res, &status, &errType, errText); break;
+          default: return 1;
+         }
+        if (status || res.tempType) return 1;
+        BATCH_EMIT(op, stk[sp-2].reg, stk[sp-1].reg);
+        sp--;
+        stk[sp-1].reg = Ninstr-1;
+        batchUnit(&stk[sp-1].unit, &res);
+        break;
+       }
+      case 15: // Dollar operator; the column number must be a constant
+       {
+        const pplBatchInstr *col;
+        int n;
+        if ((sp<1)||(stk[sp-1].fn!=NULL)) return 1;
+        col = &prog[stk[sp-1].reg];
+        if ((col->op!=BATCH_CONST)||(!stk[sp-1].unit.dimensionless)||(!gsl_finite(col->k))) return 1;
+        n = (int)round(col->k);
+        if ((n<1)||(n>Ncols)||((n<=NcolUnits)&&(colUnits[n-1].tempType))) return 1;
+        BATCH_EMIT(BATCH_COL,-1,-1);
+        prog[Ninstr-1].colNum = n;
+        stk[sp-1].reg = Ninstr-1;
+        batchUnit(&stk[sp-1].unit, (n<=NcolUnits) ? &colUnits[n-1] : NULL);
+        break;
+       }
+      default:
+        return 1;
+     }
+    if (o==0) break;
+    j += in[j].len;
+   }
+  if ((sp!=1)||(stk[0].fn!=NULL)) return 1;
+
+  out->prog = (pplBatchInstr *)ppl_memAlloc(Ninstr*sizeof(pplBatchInstr));
+  out->regs = (double *)ppl_memAlloc(Ninstr*PPL_BATCH_CHUNK*sizeof(double));
+  if ((out->prog==NULL)||(out->regs==NULL)) return 1;
+  memcpy(out->prog, prog, Ninstr*sizeof(pplBatchInstr));
+  out->Ninstr = Ninstr;
+  out->outReg = stk[0].reg;
+  batchUnit(&out->unit, &stk[0].unit);
+  return 0;
+ }
+
+// Constants are read with a stride of zero, so that they need not be copied into arrays
+#define BATCH_OPERAND(REG,PTR,STRIDE) \
+ { \
+  if      ((REG)<0)                          { PTR=NULL; STRIDE=0; } \
+  else if (b->prog[REG].op==BATCH_CONST)     { PTR=&b->prog[REG].k; STRIDE=0; } \
+  else                                       { PTR=b->regs+(long)(REG)*PPL_BATCH_CHUNK; STRIDE=1; } \
+ }
+
+// Evaluate the batch program b for N <= PPL_BATCH_CHUNK rows starting at rowMin, putting the results into out. The
+// data in each column are requested from fetch(). Any row in which a non-finite value arises, at any stage, has its
+// entry in bad set to one; the caller should evaluate such rows with ppl_expEval(), which knows whether to raise an
+// error or return NaN.
+void ppl_expBatchRun(pplExprBatch *b, ppl_batchFetchFn fetch, void *arg, long rowMin, long N, double *out, unsigned char *bad)
+ {
+  const double *x, *y;
+  long          r;
+  int           i, sx, sy;
+
+  for (i=0; i<b->Ninstr; i++)
+   {
+    const pplBatchInstr *I = &b->prog[i];
+    double              *o = b->regs + (long)i*PPL_BATCH_CHUNK;
+    if (I->op==BATCH_CONST) continue;
+    BATCH_OPERAND(I->in0,x,sx);
+    BATCH_OPERAND(I->in1,y,sy);
+    switch (I->op)
+     {
+      case BATCH_COL: (*fetch)(arg, I->colNum, rowMin, N, o); break;
+      case BATCH_NEG: for (r=0; r<N; r++) o[r] = -x[r*sx]; break;
+      case BATCH_ADD: for (r=0; r<N; r++) o[r] = x[r*sx] + y[r*sy]; break;
+      case BATCH_SUB: for (r=0; r<N; r++) o[r] = x[r*sx] - y[r*sy]; break;
+      case BATCH_MUL: for (r=0; r<N; r++) o[r] = x[r*sx] * y[r*sy]; break;
+      case BATCH_DIV: for (r=0; r<N; r++) o[r] = (fabs(y[r*sy])<1e-200) ? GSL_NAN : (x[r*sx] / y[r*sy]); break; // As in ppl_uaDiv()
+      case BATCH_POW: for (r=0; r<N; r++) o[r] = pow(x[r*sx], y[r*sy]); break;
+      case BATCH_FN : for (r=0; r<N; r++) o[r] = (*I->fn)(x[r*sx]); break;
+     }
+    for (r=0; r<N; r++) if (!gsl_finite(o[r])) bad[r]=1;
+   }
+
+  BATCH_OPERAND(b->outReg,x,sx);
+  for (r=0; r<N; r++) { out[r] = x[r*sx]; if (!gsl_finite(out[r])) bad[r]=1; }
+  return;
+ }
+
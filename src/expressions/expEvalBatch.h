@@ -0,0 +1,57 @@
+// expEvalBatch.h
+//
+// The code in this file is part of Pyxplot
+// <http://www.pyxplot.org.uk>
+//
+// Copyright (C) 2006-2013 Dominic Ford <coders@pyxplot.org.uk>
+//               2008-2013 Ross Church
+//
+// $Id$
+//
+// Pyxplot is free software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation; either version 2 of the License, or (at your option) any later
+// version.
+//
+// You should have received a copy of the GNU General Public License along with
+// Pyxplot; if not, write to the Free Software Foundation, Inc., 51 Franklin
+// Street, Fifth Floor, Boston, MA  02110-1301, USA
+
+// ----------------------------------------------------------------------------
+
+// Evaluation of pure numeric expressions over whole columns of data at once
+
+#ifndef _EXPEVALBATCH_H
+#define _EXPEVALBATCH_H 1
+
+#include "expressions/expCompile.h"
+#include "userspace/context.h"
+#include "userspace/pplObj.h"
+
+// Maximum number of rows passed to ppl_expBatchRun() at once, and the maximum length of a batch program
+#define PPL_BATCH_CHUNK    1024
+#define PPL_BATCH_MAXINSTR 128
+
+// Function which fetches rows rowMin <= row < rowMin+N of column number colNum, counting from one, into out
+typedef void (*ppl_batchFetchFn)(void *arg, int colNum, long rowMin, long N, double *out);
+
+typedef struct pplBatchInstr
+ {
+  int      op, in0, in1, colNum;
+  double   k;
+  double (*fn)(double);
+ } pplBatchInstr;
+
+typedef struct pplExprBatch
+ {
+  pplBatchInstr *prog;
+  int            Ninstr, outReg;
+  double        *regs;
+  pplObj         unit; // Physical units of every value produced
+ } pplExprBatch;
+
+int  ppl_expBatchCompile(ppl_context *c, pplExpr *e, int Ncols, pplObj *colUnits, int NcolUnits, pplExprBatch *out);
+void ppl_expBatchRun    (pplExprBatch *b, ppl_batchFetchFn fetch, void *arg, long rowMin, long N, double *out, unsigned char *bad);
+
+#endif
+
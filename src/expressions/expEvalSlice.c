@@ -228,8 +228,7 @@ void ppl_sliceRange(ppl_context *context, int minset, int min, int maxset, int m
       list         *lout;
       const int     inl = lin->length;
       int           i;
-      listIterator *li;
-      pplObj        obj, *objptr;
+      pplObj        obj;
       if (!minset)    min =0;
       else if (min<0) min+=inl;
       if (!maxset)    max =inl;
@@ -238,13 +237,11 @@ void ppl_sliceRange(ppl_context *context, int minset, int min, int maxset, int m
       if (pplObjList(out,0,1,NULL)==NULL) { *status=1; *errType=ERR_MEMORY; sprintf(errText,"Out of memory."); goto fail; }
       lout = (list *)out->auxil;
       obj.refCount=1;
-      li = ppl_listIterateInit(lin);
-      for (i=0; ((objptr=(pplObj*)ppl_listIterate(&li))!=NULL); i++)
-       if ((i>=min)&&(i<max))
-        {
-         pplObjCpy(&obj,objptr,0,1,1);
-         ppl_listAppendCpy(lout, &obj, sizeof(pplObj));
-        }
+      for (i=min; i<max; i++)
+       {
+        pplObjCpy(&obj,(pplObj*)ppl_listGetItem(lin,i),0,1,1);
+        ppl_listAppendCpy(lout, &obj, sizeof(pplObj));
+       }
       break;
      }
     case PPLOBJ_VEC:
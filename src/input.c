@@ -38,6 +38,7 @@
 #include "expressions/traceback_fns.h"
 
 #include "parser/parser.h"
+#include "parser/parserCache.h"
 
 #include "stringTools/asciidouble.h"
 #include "stringTools/strConstants.h"
@@ -156,17 +157,57 @@ void ppl_interactiveSession(ppl_context *context)
   return;
  }
 
+// Read the whole of a script, if it is a file which can be rewound afterwards, so that it can be hashed
+static unsigned char *ppl_scriptText(FILE *infile, long *len)
+ {
+  unsigned char *out;
+  if ((fseek(infile, 0, SEEK_END)!=0) || ((*len = ftell(infile))<0) || (fseek(infile, 0, SEEK_SET)!=0)) return NULL;
+  out = (unsigned char *)malloc(*len+1);
+  if (out==NULL) return NULL;
+  if ((fread(out, 1, *len, infile)!=(size_t)*len) || (fseek(infile, 0, SEEK_SET)!=0)) { free(out); rewind(infile); return NULL; }
+  return out;
+ }
+
+// Execute the statements of a script which were read from a cache file, in place of compiling them afresh
+static void ppl_processScriptCached(ppl_context *context, parserCacheRecord *r, char *filename_description, int iterDepth)
+ {
+  long i;
+  for (i=0; (i<r->N)&&(!context->shellExiting)&&(!context->shellBroken)&&(!context->shellContinued)&&(!context->shellReturned)&&(!cancellationFlag); i++)
+   {
+    int status=0;
+    ppl_error_setstreaminfo(&context->errcontext, r->units[i].linenumber, filename_description);
+    ppl_tbClear(context);
+    ppl_parserExecute(context, r->units[i].pl, NULL, 0, iterDepth);
+    if (context->errStat.status) { status=1; if (iterDepth==0) ppl_tbWrite(context); }
+    ppl_error_setstreaminfo(&context->errcontext, -1, "");
+    pplcsp_killAllHelpers(context);
+    if ( (status>0) || context->shellExiting || cancellationFlag )// If an error occurs in a script, aborted processing it
+     {
+      if (!context->shellExiting) ppl_error(&context->errcontext, ERR_FILE, -1, -1, "Aborting.");
+      break;
+     }
+   }
+ }
+
 void ppl_processScript(ppl_context *context, char *input, int iterDepth)
  {
   int           linenumber = 1;
-  int           status;
+  int           status=0;
   char          full_filename[FNAME_LENGTH];
   char          filename_description[FNAME_LENGTH];
+  char          cache_filename[FNAME_LENGTH];
   FILE         *infile;
   parserLine   *pl = NULL;
   parserStatus *ps = NULL;
   int           shellBreakableOld  = context->shellBreakable;
   int           shellReturnableOld = context->shellReturnable;
+  int           complete = 0;
+
+  parserCacheRecord record;
+  void             *oldParserRecord = context->parserRecord;
+  unsigned char    *srcText = NULL;
+  long              srcLen  = 0;
+  uint64_t          srcHash = 0;
 
   char   *oldInputLineBuffer    = context->inputLineBuffer;
   int     oldInputLineBufferLen = context->inputLineBufferLen;
@@ -188,6 +229,23 @@ void ppl_processScript(ppl_context *context, char *input, int iterDepth)
   context->shellExiting    = 0;
   context->shellBreakable  = 0;
   context->shellReturnable = 0;
+
+  // If compiled scripts are cached, run this one from its cache file if it has one; otherwise record its statements
+  context->parserRecord = NULL;
+  if ( (context->scriptCache) && (snprintf(cache_filename, FNAME_LENGTH, "%sc", full_filename) < FNAME_LENGTH) && ((srcText = ppl_scriptText(infile, &srcLen)) != NULL) )
+   {
+    srcHash = ppl_parserCacheHash(srcText, srcLen);
+    free(srcText);
+    if (ppl_parserCacheLoad(context, cache_filename, srcHash, srcLen, &record, iterDepth)==0)
+     {
+      ppl_processScriptCached(context, &record, filename_description, iterDepth);
+      ppl_parserCacheRecordFree(&record);
+      goto finish;
+     }
+    ppl_parserCacheRecordInit(&record, iterDepth, ppl_error_reserveSourceIds(0));
+    context->parserRecord = (void *)&record;
+   }
+
   while ((!context->shellExiting)&&(!context->shellBroken)&&(!context->shellContinued)&&(!context->shellReturned)&&(!cancellationFlag))
    {
     ppl_error_setstreaminfo(&context->errcontext, linenumber, filename_description);
@@ -203,9 +261,15 @@ void ppl_processScript(ppl_context *context, char *input, int iterDepth)
      {
       if (!context->shellExiting) ppl_error(&context->errcontext, ERR_FILE, -1, -1, "Aborting.");
       if (context->inputLineAddBuffer != NULL) { free(context->inputLineAddBuffer); context->inputLineAddBuffer=NULL; }
+      status=-1;
       break;
      }
    }
+
+  // Only a script which ran from start to end is cached, since every statement of it has then been compiled
+  complete = (status>=0) && feof(infile) && (!ferror(infile)) && (context->inputLineAddBuffer==NULL) &&
+             (!context->shellExiting)&&(!context->shellBroken)&&(!context->shellContinued)&&(!context->shellReturned)&&(!cancellationFlag);
+
   if ((!context->shellExiting)&&(!context->shellBroken)&&(!context->shellContinued)&&(!context->shellReturned)&&(!cancellationFlag))
    if (context->inputLineAddBuffer != NULL) // Process last line of file if there is still text buffered
     {
@@ -216,6 +280,13 @@ void ppl_processScript(ppl_context *context, char *input, int iterDepth)
      if (status>0) ppl_error(&context->errcontext, ERR_FILE, -1, -1, "Aborting.");
      if (context->inputLineAddBuffer != NULL) { free(context->inputLineAddBuffer); context->inputLineAddBuffer=NULL; }
     }
+  if (context->parserRecord == (void *)&record)
+   {
+    if (complete) ppl_parserCacheSave(context, cache_filename, srcHash, srcLen, &record);
+    ppl_parserCacheRecordFree(&record);
+   }
+
+finish:
   context->shellExiting       = 0;
   context->shellBreakable     = shellBreakableOld;
   context->shellReturnable    = shellReturnableOld;
@@ -225,6 +296,7 @@ void ppl_processScript(ppl_context *context, char *input, int iterDepth)
   pplcsp_checkForGvOutput(context);
 
 restore:
+  context->parserRecord = oldParserRecord;
   if (context->inputLineBuffer!=NULL) free(context->inputLineBuffer);
   context->inputLineBuffer    = oldInputLineBuffer;
   context->inputLineBufferLen = oldInputLineBufferLen;
@@ -326,6 +398,8 @@ int ppl_ProcessStatement(ppl_context *context, parserStatus *ps, char *line, int
 
   if ( (!stat) && (!context->errStat.status) && (ps->blockDepth==0) )
    {
+    parserCacheRecord *record = (parserCacheRecord *)context->parserRecord;
+    if ((record!=NULL) && (record->iterDepth==iterDepth)) ppl_parserCacheRecordAdd(record, context->errcontext.error_input_linenumber, ps->pl[iterDepth]);
     ppl_parserExecute(context, ps->pl[iterDepth], NULL, interactive, iterDepth);
    }
 
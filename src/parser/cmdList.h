@@ -0,0 +1,2122 @@
+// This file autogenerated by parser_data.py
+
+#ifndef _CMDLIST_H
+#define _CMDLIST_H 1
+
+extern const char ppl_cmdList[];
+#define PARSE_var_set_directive 0
+#define PARSE_var_set_editno 1
+#define PARSE_var_set_set_option 2
+#define PARSE_var_set_X 3
+#define PARSE_var_set_varname_varnames 1
+#define PARSE_var_set_varnames 4
+#define PARSE_var_set_regex 5
+#define PARSE_var_set_value 6
+#define PARSE_func_set_directive 0
+#define PARSE_func_set_editno 1
+#define PARSE_func_set_set_option 2
+#define PARSE_func_set_X 3
+#define PARSE_func_set_function_name_function_names 1
+#define PARSE_func_set_function_names 4
+#define PARSE_func_set_argument_name_0argument_list 1
+#define PARSE_func_set_0argument_list 5
+#define PARSE_func_set_X_0range_list 1
+#define PARSE_func_set_min_0range_list 2
+#define PARSE_func_set_minauto_0range_list 3
+#define PARSE_func_set_max_0range_list 4
+#define PARSE_func_set_maxauto_0range_list 5
+#define PARSE_func_set_0range_list 6
+#define PARSE_func_set_definition 7
+#define PARSE_arc_directive 0
+#define PARSE_arc_editno 1
+#define PARSE_arc_set_option 2
+#define PARSE_arc_X 3
+#define PARSE_arc_p 4
+#define PARSE_arc_r 6
+#define PARSE_arc_angle1 7
+#define PARSE_arc_angle2 8
+#define PARSE_arc_linetype 9
+#define PARSE_arc_linewidth 10
+#define PARSE_arc_style_number 11
+#define PARSE_arc_color 12
+#define PARSE_arc_fillcolor 13
+#define PARSE_arrow_directive 0
+#define PARSE_arrow_editno 1
+#define PARSE_arrow_set_option 2
+#define PARSE_arrow_X 3
+#define PARSE_arrow_p1 4
+#define PARSE_arrow_p2 6
+#define PARSE_arrow_linetype 8
+#define PARSE_arrow_linewidth 9
+#define PARSE_arrow_style_number 10
+#define PARSE_arrow_color 11
+#define PARSE_arrow_arrow_style 12
+#define PARSE_assert_directive 0
+#define PARSE_assert_editno 1
+#define PARSE_assert_set_option 2
+#define PARSE_assert_X 3
+#define PARSE_assert_gtreq 4
+#define PARSE_assert_lt 5
+#define PARSE_assert_version 6
+#define PARSE_assert_expr 7
+#define PARSE_assert_message 8
+#define PARSE_box_directive 0
+#define PARSE_box_editno 1
+#define PARSE_box_set_option 2
+#define PARSE_box_X 3
+#define PARSE_box_p1 4
+#define PARSE_box_p2 6
+#define PARSE_box_rotation 8
+#define PARSE_box_p3 9
+#define PARSE_box_width 11
+#define PARSE_box_height 12
+#define PARSE_box_linetype 13
+#define PARSE_box_linewidth 14
+#define PARSE_box_style_number 15
+#define PARSE_box_color 16
+#define PARSE_box_fillcolor 17
+#define PARSE_break_directive 0
+#define PARSE_break_editno 1
+#define PARSE_break_set_option 2
+#define PARSE_break_X 3
+#define PARSE_break_loopname 4
+#define PARSE_call_directive 0
+#define PARSE_call_editno 1
+#define PARSE_call_set_option 2
+#define PARSE_call_X 3
+#define PARSE_call_object 4
+#define PARSE_cd_directive 0
+#define PARSE_cd_editno 1
+#define PARSE_cd_set_option 2
+#define PARSE_cd_X 3
+#define PARSE_cd_directory_path 1
+#define PARSE_cd_path 4
+#define PARSE_circle_directive 0
+#define PARSE_circle_editno 1
+#define PARSE_circle_set_option 2
+#define PARSE_circle_X 3
+#define PARSE_circle_p 4
+#define PARSE_circle_r 6
+#define PARSE_circle_linetype 7
+#define PARSE_circle_linewidth 8
+#define PARSE_circle_style_number 9
+#define PARSE_circle_color 10
+#define PARSE_circle_fillcolor 11
+#define PARSE_clear_directive 0
+#define PARSE_clear_editno 1
+#define PARSE_clear_set_option 2
+#define PARSE_clear_X 3
+#define PARSE_continue_directive 0
+#define PARSE_continue_editno 1
+#define PARSE_continue_set_option 2
+#define PARSE_continue_X 3
+#define PARSE_continue_loopname 4
+#define PARSE_delete_directive 0
+#define PARSE_delete_editno 1
+#define PARSE_delete_set_option 2
+#define PARSE_delete_X 3
+#define PARSE_delete_number_deleteno 1
+#define PARSE_delete_deleteno 4
+#define PARSE_do_directive 0
+#define PARSE_do_editno 1
+#define PARSE_do_set_option 2
+#define PARSE_do_X 3
+#define PARSE_do_loopname 4
+#define PARSE_do_code 5
+#define PARSE_do_condition 6
+#define PARSE_ellipse_directive 0
+#define PARSE_ellipse_editno 1
+#define PARSE_ellipse_set_option 2
+#define PARSE_ellipse_X 3
+#define PARSE_ellipse_p1 4
+#define PARSE_ellipse_p2 6
+#define PARSE_ellipse_rotation 8
+#define PARSE_ellipse_arcfrom 9
+#define PARSE_ellipse_arcto 10
+#define PARSE_ellipse_center 11
+#define PARSE_ellipse_focus 13
+#define PARSE_ellipse_majoraxis 15
+#define PARSE_ellipse_semimajoraxis 16
+#define PARSE_ellipse_minoraxis 17
+#define PARSE_ellipse_semiminoraxis 18
+#define PARSE_ellipse_eccentricity 19
+#define PARSE_ellipse_slr 20
+#define PARSE_ellipse_lr 21
+#define PARSE_ellipse_linetype 22
+#define PARSE_ellipse_linewidth 23
+#define PARSE_ellipse_style_number 24
+#define PARSE_ellipse_color 25
+#define PARSE_ellipse_fillcolor 26
+#define PARSE_eps_directive 0
+#define PARSE_eps_editno 1
+#define PARSE_eps_set_option 2
+#define PARSE_eps_X 3
+#define PARSE_eps_filename 4
+#define PARSE_eps_p 5
+#define PARSE_eps_rotation 7
+#define PARSE_eps_width 8
+#define PARSE_eps_height 9
+#define PARSE_eps_clip 10
+#define PARSE_eps_calcbbox 11
+#define PARSE_exec_directive 0
+#define PARSE_exec_editno 1
+#define PARSE_exec_set_option 2
+#define PARSE_exec_X 3
+#define PARSE_exec_command 4
+#define PARSE_quit_directive 0
+#define PARSE_quit_editno 1
+#define PARSE_quit_set_option 2
+#define PARSE_quit_X 3
+#define PARSE_fit_directive 0
+#define PARSE_fit_editno 1
+#define PARSE_fit_set_option 2
+#define PARSE_fit_X 3
+#define PARSE_fit_X_0range_list 1
+#define PARSE_fit_min_0range_list 2
+#define PARSE_fit_minauto_0range_list 3
+#define PARSE_fit_max_0range_list 4
+#define PARSE_fit_maxauto_0range_list 5
+#define PARSE_fit_0range_list 4
+#define PARSE_fit_fit_function 5
+#define PARSE_fit_inputvar_0operands 1
+#define PARSE_fit_0operands 6
+#define PARSE_fit_withouterrors 7
+#define PARSE_fit_filename 8
+#define PARSE_fit_every_item_every_list 1
+#define PARSE_fit_every_list 9
+#define PARSE_fit_index 10
+#define PARSE_fit_select_criterion 11
+#define PARSE_fit_use_rows 12
+#define PARSE_fit_use_columns 13
+#define PARSE_fit_using_item_using_list 1
+#define PARSE_fit_using_list 14
+#define PARSE_fit_fit_variable_fit_variables 1
+#define PARSE_fit_fit_variables 15
+#define PARSE_fit_method 16
+#define PARSE_ifft_directive 0
+#define PARSE_ifft_editno 1
+#define PARSE_ifft_set_option 2
+#define PARSE_ifft_X 3
+#define PARSE_ifft_X_range_list 1
+#define PARSE_ifft_min_range_list 2
+#define PARSE_ifft_max_range_list 3
+#define PARSE_ifft_step_range_list 4
+#define PARSE_ifft_range_list 4
+#define PARSE_ifft_varname_varnames 1
+#define PARSE_ifft_varnames 5
+#define PARSE_ifft_inputvar_0in_operands 1
+#define PARSE_ifft_0in_operands 6
+#define PARSE_ifft_fnname_fnnames 1
+#define PARSE_ifft_fnnames 7
+#define PARSE_ifft_outvar_0out_operands 1
+#define PARSE_ifft_0out_operands 8
+#define PARSE_ifft_every_item_every_list 1
+#define PARSE_ifft_every_list 9
+#define PARSE_ifft_index 10
+#define PARSE_ifft_select_criterion 11
+#define PARSE_ifft_use_rows 12
+#define PARSE_ifft_use_columns 13
+#define PARSE_ifft_using_item_using_list 1
+#define PARSE_ifft_using_list 14
+#define PARSE_ifft_window 15
+#define PARSE_ifft_filename 16
+#define PARSE_ifft_data 17
+#define PARSE_for_directive 0
+#define PARSE_for_editno 1
+#define PARSE_for_set_option 2
+#define PARSE_for_X 3
+#define PARSE_for_var_name 4
+#define PARSE_for_start_value 5
+#define PARSE_for_final_value 6
+#define PARSE_for_step 7
+#define PARSE_for_step_size 8
+#define PARSE_for_begin 9
+#define PARSE_for_criterion 10
+#define PARSE_for_iterate 11
+#define PARSE_for_loopname 12
+#define PARSE_for_code 13
+#define PARSE_foreachdatum_directive 0
+#define PARSE_foreachdatum_editno 1
+#define PARSE_foreachdatum_set_option 2
+#define PARSE_foreachdatum_X 3
+#define PARSE_foreachdatum_df 4
+#define PARSE_foreachdatum_variable_variables 1
+#define PARSE_foreachdatum_variables 5
+#define PARSE_foreachdatum_in 6
+#define PARSE_foreachdatum_X_0range_list 1
+#define PARSE_foreachdatum_min_0range_list 2
+#define PARSE_foreachdatum_minauto_0range_list 3
+#define PARSE_foreachdatum_max_0range_list 4
+#define PARSE_foreachdatum_maxauto_0range_list 5
+#define PARSE_foreachdatum_0range_list 7
+#define PARSE_foreachdatum_parametric 8
+#define PARSE_foreachdatum_tmin 9
+#define PARSE_foreachdatum_tmax 10
+#define PARSE_foreachdatum_vmin 11
+#define PARSE_foreachdatum_vmax 12
+#define PARSE_foreachdatum_expression_expression_list 1
+#define PARSE_foreachdatum_expression_list 13
+#define PARSE_foreachdatum_every_item_every_list 1
+#define PARSE_foreachdatum_every_list 14
+#define PARSE_foreachdatum_index 15
+#define PARSE_foreachdatum_select_criterion 16
+#define PARSE_foreachdatum_use_rows 17
+#define PARSE_foreachdatum_use_columns 18
+#define PARSE_foreachdatum_using_item_using_list 1
+#define PARSE_foreachdatum_using_list 19
+#define PARSE_foreachdatum_loopname 20
+#define PARSE_foreachdatum_code 21
+#define PARSE_foreachdatum_data 22
+#define PARSE_foreach_directive 0
+#define PARSE_foreach_editno 1
+#define PARSE_foreach_set_option 2
+#define PARSE_foreach_X 3
+#define PARSE_foreach_var_name 4
+#define PARSE_foreach_in 5
+#define PARSE_foreach_item_list 6
+#define PARSE_foreach_loopname 7
+#define PARSE_foreach_code 8
+#define PARSE_global_directive 0
+#define PARSE_global_editno 1
+#define PARSE_global_set_option 2
+#define PARSE_global_X 3
+#define PARSE_global_var_name_var_names 1
+#define PARSE_global_var_names 4
+#define PARSE_help_directive 0
+#define PARSE_help_editno 1
+#define PARSE_help_set_option 2
+#define PARSE_help_X 3
+#define PARSE_help_topic 4
+#define PARSE_history_directive 0
+#define PARSE_history_editno 1
+#define PARSE_history_set_option 2
+#define PARSE_history_X 3
+#define PARSE_history_number_lines 4
+#define PARSE_histogram_directive 0
+#define PARSE_histogram_editno 1
+#define PARSE_histogram_set_option 2
+#define PARSE_histogram_X 3
+#define PARSE_histogram_X_0range_list 1
+#define PARSE_histogram_min_0range_list 2
+#define PARSE_histogram_minauto_0range_list 3
+#define PARSE_histogram_max_0range_list 4
+#define PARSE_histogram_maxauto_0range_list 5
+#define PARSE_histogram_0range_list 4
+#define PARSE_histogram_varname_varnames 1
+#define PARSE_histogram_varnames 5
+#define PARSE_histogram_parametric 6
+#define PARSE_histogram_tmin 7
+#define PARSE_histogram_tmax 8
+#define PARSE_histogram_vmin 9
+#define PARSE_histogram_vmax 10
+#define PARSE_histogram_expression_expression_list 1
+#define PARSE_histogram_expression_list 11
+#define PARSE_histogram_every_item_every_list 1
+#define PARSE_histogram_every_list 12
+#define PARSE_histogram_index 13
+#define PARSE_histogram_select_criterion 14
+#define PARSE_histogram_use_rows 15
+#define PARSE_histogram_use_columns 16
+#define PARSE_histogram_using_item_using_list 1
+#define PARSE_histogram_using_list 17
+#define PARSE_histogram_binwidth 18
+#define PARSE_histogram_binorigin 19
+#define PARSE_histogram_x_bin_list 1
+#define PARSE_histogram_bin_list 20
+#define PARSE_histogram_data 21
+#define PARSE_image_directive 0
+#define PARSE_image_editno 1
+#define PARSE_image_set_option 2
+#define PARSE_image_X 3
+#define PARSE_image_filename 4
+#define PARSE_image_p 5
+#define PARSE_image_smooth 7
+#define PARSE_image_notrans 8
+#define PARSE_image_colorR 9
+#define PARSE_image_colorG 10
+#define PARSE_image_colorB 11
+#define PARSE_image_rotation 12
+#define PARSE_image_width 13
+#define PARSE_image_height 14
+#define PARSE_if_directive 0
+#define PARSE_if_editno 1
+#define PARSE_if_set_option 2
+#define PARSE_if_X 3
+#define PARSE_if_criterion 4
+#define PARSE_if_code 5
+#define PARSE_if_X_0elifs 1
+#define PARSE_if_criterion_0elifs 2
+#define PARSE_if_code_elif_0elifs 3
+#define PARSE_if_0elifs 6
+#define PARSE_if_code_else 7
+#define PARSE_list_directive 0
+#define PARSE_list_editno 1
+#define PARSE_list_set_option 2
+#define PARSE_list_X 3
+#define PARSE_load_directive 0
+#define PARSE_load_editno 1
+#define PARSE_load_set_option 2
+#define PARSE_load_X 3
+#define PARSE_load_filename 4
+#define PARSE_local_directive 0
+#define PARSE_local_editno 1
+#define PARSE_local_set_option 2
+#define PARSE_local_X 3
+#define PARSE_local_var_name_var_names 1
+#define PARSE_local_var_names 4
+#define PARSE_maximise_directive 0
+#define PARSE_maximise_editno 1
+#define PARSE_maximise_set_option 2
+#define PARSE_maximise_X 3
+#define PARSE_maximise_expression 4
+#define PARSE_maximise_fit_variable_fit_variables 1
+#define PARSE_maximise_fit_variables 5
+#define PARSE_minimise_directive 0
+#define PARSE_minimise_editno 1
+#define PARSE_minimise_set_option 2
+#define PARSE_minimise_X 3
+#define PARSE_minimise_expression 4
+#define PARSE_minimise_fit_variable_fit_variables 1
+#define PARSE_minimise_fit_variables 5
+#define PARSE_move_directive 0
+#define PARSE_move_editno 1
+#define PARSE_move_set_option 2
+#define PARSE_move_X 3
+#define PARSE_move_moveno 4
+#define PARSE_move_p 5
+#define PARSE_move_rotation 7
+#define PARSE_help_directive 0
+#define PARSE_help_editno 1
+#define PARSE_help_set_option 2
+#define PARSE_help_X 3
+#define PARSE_help_topic 4
+#define PARSE_pling_directive 0
+#define PARSE_pling_editno 1
+#define PARSE_pling_set_option 2
+#define PARSE_pling_X 3
+#define PARSE_pling_cmd 4
+#define PARSE_piechart_directive 0
+#define PARSE_piechart_editno 1
+#define PARSE_piechart_set_option 2
+#define PARSE_piechart_X 3
+#define PARSE_piechart_expression_expression_list 1
+#define PARSE_piechart_expression_list 4
+#define PARSE_piechart_every_item_every_list 1
+#define PARSE_piechart_every_list 5
+#define PARSE_piechart_index 6
+#define PARSE_piechart_piekeypos 7
+#define PARSE_piechart_label 8
+#define PARSE_piechart_select_criterion 9
+#define PARSE_piechart_use_rows 10
+#define PARSE_piechart_use_columns 11
+#define PARSE_piechart_using_item_using_list 1
+#define PARSE_piechart_using_list 12
+#define PARSE_piechart_linetype 13
+#define PARSE_piechart_linewidth 14
+#define PARSE_piechart_style_number 15
+#define PARSE_piechart_color 16
+#define PARSE_piechart_auto_format 17
+#define PARSE_piechart_format_string 18
+#define PARSE_piechart_data 19
+#define PARSE_replot_directive 0
+#define PARSE_replot_editno 1
+#define PARSE_replot_set_option 2
+#define PARSE_replot_X 3
+#define PARSE_replot_threedim 4
+#define PARSE_replot_X_0range_list 1
+#define PARSE_replot_min_0range_list 2
+#define PARSE_replot_minauto_0range_list 3
+#define PARSE_replot_max_0range_list 4
+#define PARSE_replot_maxauto_0range_list 5
+#define PARSE_replot_0range_list 5
+#define PARSE_replot_parametric_0plot_list 1
+#define PARSE_replot_X_0plot_list 2
+#define PARSE_replot_tmin_0plot_list 3
+#define PARSE_replot_tmax_0plot_list 4
+#define PARSE_replot_vmin_0plot_list 5
+#define PARSE_replot_vmax_0plot_list 6
+#define PARSE_replot_expression_expression_list_0plot_list 1
+#define PARSE_replot_expression_list_0plot_list 7
+#define PARSE_replot_axis_1_0plot_list 8
+#define PARSE_replot_axis_2_0plot_list 9
+#define PARSE_replot_axis_3_0plot_list 10
+#define PARSE_replot_every_item_every_list_0plot_list 1
+#define PARSE_replot_every_list_0plot_list 11
+#define PARSE_replot_index_0plot_list 12
+#define PARSE_replot_label_0plot_list 13
+#define PARSE_replot_select_criterion_0plot_list 14
+#define PARSE_replot_continuous_0plot_list 15
+#define PARSE_replot_discontinuous_0plot_list 16
+#define PARSE_replot_title_0plot_list 17
+#define PARSE_replot_notitle_0plot_list 18
+#define PARSE_replot_use_rows_0plot_list 19
+#define PARSE_replot_use_columns_0plot_list 20
+#define PARSE_replot_using_item_using_list_0plot_list 1
+#define PARSE_replot_using_list_0plot_list 21
+#define PARSE_replot_linetype_0plot_list 22
+#define PARSE_replot_linewidth_0plot_list 23
+#define PARSE_replot_pointsize_0plot_list 24
+#define PARSE_replot_pointtype_0plot_list 25
+#define PARSE_replot_style_number_0plot_list 26
+#define PARSE_replot_pointlinewidth_0plot_list 27
+#define PARSE_replot_color_0plot_list 28
+#define PARSE_replot_fillcolor_0plot_list 29
+#define PARSE_replot_style_0plot_list 30
+#define PARSE_replot_0plot_list 6
+#define PARSE_replot_data 7
+#define PARSE_point_directive 0
+#define PARSE_point_editno 1
+#define PARSE_point_set_option 2
+#define PARSE_point_X 3
+#define PARSE_point_p 4
+#define PARSE_point_label 6
+#define PARSE_point_pointsize 7
+#define PARSE_point_pointtype 8
+#define PARSE_point_style_number 9
+#define PARSE_point_pointlinewidth 10
+#define PARSE_point_color 11
+#define PARSE_polygon_directive 0
+#define PARSE_polygon_editno 1
+#define PARSE_polygon_set_option 2
+#define PARSE_polygon_X 3
+#define PARSE_polygon_pointlist 4
+#define PARSE_polygon_linetype 5
+#define PARSE_polygon_linewidth 6
+#define PARSE_polygon_style_number 7
+#define PARSE_polygon_color 8
+#define PARSE_polygon_fillcolor 9
+#define PARSE_print_directive 0
+#define PARSE_print_editno 1
+#define PARSE_print_set_option 2
+#define PARSE_print_X 3
+#define PARSE_print_expression_0print_list 1
+#define PARSE_print_0print_list 4
+#define PARSE_pwd_directive 0
+#define PARSE_pwd_editno 1
+#define PARSE_pwd_set_option 2
+#define PARSE_pwd_X 3
+#define PARSE_quit_directive 0
+#define PARSE_quit_editno 1
+#define PARSE_quit_set_option 2
+#define PARSE_quit_X 3
+#define PARSE_refresh_directive 0
+#define PARSE_refresh_editno 1
+#define PARSE_refresh_set_option 2
+#define PARSE_refresh_X 3
+#define PARSE_reset_directive 0
+#define PARSE_reset_editno 1
+#define PARSE_reset_set_option 2
+#define PARSE_reset_X 3
+#define PARSE_return_directive 0
+#define PARSE_return_editno 1
+#define PARSE_return_set_option 2
+#define PARSE_return_X 3
+#define PARSE_return_return_value 4
+#define PARSE_save_directive 0
+#define PARSE_save_editno 1
+#define PARSE_save_set_option 2
+#define PARSE_save_X 3
+#define PARSE_save_filename 4
+#define PARSE_set_xformat_directive 0
+#define PARSE_set_xformat_editno 1
+#define PARSE_set_xformat_set_option 2
+#define PARSE_set_xformat_X 3
+#define PARSE_set_xformat_axis 4
+#define PARSE_set_xformat_auto_format 5
+#define PARSE_set_xformat_format_string 6
+#define PARSE_set_xformat_orient 7
+#define PARSE_set_xformat_rotation 8
+#define PARSE_set_xlabel_directive 0
+#define PARSE_set_xlabel_editno 1
+#define PARSE_set_xlabel_set_option 2
+#define PARSE_set_xlabel_X 3
+#define PARSE_set_xlabel_axis 4
+#define PARSE_set_xlabel_rotation 5
+#define PARSE_set_xlabel_label_text 6
+#define PARSE_set_range_directive 0
+#define PARSE_set_range_editno 1
+#define PARSE_set_range_set_option 2
+#define PARSE_set_range_X 3
+#define PARSE_set_range_axis 4
+#define PARSE_set_range_reverse 5
+#define PARSE_set_range_noreverse 6
+#define PARSE_set_range_min 7
+#define PARSE_set_range_minauto 8
+#define PARSE_set_range_max 9
+#define PARSE_set_range_maxauto 10
+#define PARSE_set_tics_directive 0
+#define PARSE_set_tics_editno 1
+#define PARSE_set_tics_set_option 2
+#define PARSE_set_tics_X 3
+#define PARSE_set_tics_minor 4
+#define PARSE_set_tics_axis 5
+#define PARSE_set_tics_dir 6
+#define PARSE_set_tics_autofreq 7
+#define PARSE_set_tics_got_list 8
+#define PARSE_set_tics_x_0tick_list 1
+#define PARSE_set_tics_label_0tick_list 2
+#define PARSE_set_tics_0tick_list 9
+#define PARSE_set_tics_start 10
+#define PARSE_set_tics_increment 11
+#define PARSE_set_tics_end 12
+#define PARSE_set_arrow_directive 0
+#define PARSE_set_arrow_editno 1
+#define PARSE_set_arrow_set_option 2
+#define PARSE_set_arrow_X 3
+#define PARSE_set_arrow_arrow_id 4
+#define PARSE_set_arrow_x0_system 5
+#define PARSE_set_arrow_x0_axis 6
+#define PARSE_set_arrow_x0 7
+#define PARSE_set_arrow_y0_system 8
+#define PARSE_set_arrow_y0_axis 9
+#define PARSE_set_arrow_y0 10
+#define PARSE_set_arrow_z0_system 11
+#define PARSE_set_arrow_z0_axis 12
+#define PARSE_set_arrow_z0 13
+#define PARSE_set_arrow_x1_system 14
+#define PARSE_set_arrow_x1_axis 15
+#define PARSE_set_arrow_x1 16
+#define PARSE_set_arrow_y1_system 17
+#define PARSE_set_arrow_y1_axis 18
+#define PARSE_set_arrow_y1 19
+#define PARSE_set_arrow_z1_system 20
+#define PARSE_set_arrow_z1_axis 21
+#define PARSE_set_arrow_z1 22
+#define PARSE_set_arrow_linetype 23
+#define PARSE_set_arrow_linewidth 24
+#define PARSE_set_arrow_style_number 25
+#define PARSE_set_arrow_color 26
+#define PARSE_set_arrow_arrow_style 27
+#define PARSE_set_autoscale_directive 0
+#define PARSE_set_autoscale_editno 1
+#define PARSE_set_autoscale_set_option 2
+#define PARSE_set_autoscale_X 3
+#define PARSE_set_autoscale_axis_0axes 1
+#define PARSE_set_autoscale_0axes 4
+#define PARSE_set_axescolor_directive 0
+#define PARSE_set_axescolor_editno 1
+#define PARSE_set_axescolor_set_option 2
+#define PARSE_set_axescolor_X 3
+#define PARSE_set_axescolor_color 4
+#define PARSE_set_axis_directive 0
+#define PARSE_set_axis_editno 1
+#define PARSE_set_axis_set_option 2
+#define PARSE_set_axis_X 3
+#define PARSE_set_axis_axis_axes 1
+#define PARSE_set_axis_axes 4
+#define PARSE_set_axis_invisible 5
+#define PARSE_set_axis_visible 6
+#define PARSE_set_axis_xorient 7
+#define PARSE_set_axis_yorient 8
+#define PARSE_set_axis_zorient 9
+#define PARSE_set_axis_mirror 10
+#define PARSE_set_axis_atzero 11
+#define PARSE_set_axis_notatzero 12
+#define PARSE_set_axis_axisdisp 13
+#define PARSE_set_axis_notlinked 14
+#define PARSE_set_axis_linked 15
+#define PARSE_set_axis_linktoid 16
+#define PARSE_set_axis_linkaxis 17
+#define PARSE_set_axis_usingexp 18
+#define PARSE_set_axisunitstyle_directive 0
+#define PARSE_set_axisunitstyle_editno 1
+#define PARSE_set_axisunitstyle_set_option 2
+#define PARSE_set_axisunitstyle_X 3
+#define PARSE_set_axisunitstyle_unitstyle 4
+#define PARSE_set_backup_directive 0
+#define PARSE_set_backup_editno 1
+#define PARSE_set_backup_set_option 2
+#define PARSE_set_backup_X 3
+#define PARSE_set_bar_directive 0
+#define PARSE_set_bar_editno 1
+#define PARSE_set_bar_set_option 2
+#define PARSE_set_bar_X 3
+#define PARSE_set_bar_bar_size_large 4
+#define PARSE_set_bar_bar_size_small 5
+#define PARSE_set_bar_bar_size 6
+#define PARSE_set_binorigin_directive 0
+#define PARSE_set_binorigin_editno 1
+#define PARSE_set_binorigin_set_option 2
+#define PARSE_set_binorigin_X 3
+#define PARSE_set_binorigin_auto 4
+#define PARSE_set_binorigin_bin_origin 5
+#define PARSE_set_binwidth_directive 0
+#define PARSE_set_binwidth_editno 1
+#define PARSE_set_binwidth_set_option 2
+#define PARSE_set_binwidth_X 3
+#define PARSE_set_binwidth_auto 4
+#define PARSE_set_binwidth_bin_width 5
+#define PARSE_set_boxfrom_directive 0
+#define PARSE_set_boxfrom_editno 1
+#define PARSE_set_boxfrom_set_option 2
+#define PARSE_set_boxfrom_X 3
+#define PARSE_set_boxfrom_auto 4
+#define PARSE_set_boxfrom_box_from 5
+#define PARSE_set_boxwidth_directive 0
+#define PARSE_set_boxwidth_editno 1
+#define PARSE_set_boxwidth_set_option 2
+#define PARSE_set_boxwidth_X 3
+#define PARSE_set_boxwidth_auto 4
+#define PARSE_set_boxwidth_box_width 5
+#define PARSE_set_c1format_directive 0
+#define PARSE_set_c1format_editno 1
+#define PARSE_set_c1format_set_option 2
+#define PARSE_set_c1format_X 3
+#define PARSE_set_c1format_auto_format 4
+#define PARSE_set_c1format_format_string 5
+#define PARSE_set_c1format_orient 6
+#define PARSE_set_c1format_rotation 7
+#define PARSE_set_c1label_directive 0
+#define PARSE_set_c1label_editno 1
+#define PARSE_set_c1label_set_option 2
+#define PARSE_set_c1label_X 3
+#define PARSE_set_c1label_rotation 4
+#define PARSE_set_c1label_label_text 5
+#define PARSE_set_c1tics_directive 0
+#define PARSE_set_c1tics_editno 1
+#define PARSE_set_c1tics_set_option 2
+#define PARSE_set_c1tics_X 3
+#define PARSE_set_c1tics_minor 4
+#define PARSE_set_c1tics_dir 5
+#define PARSE_set_c1tics_autofreq 6
+#define PARSE_set_c1tics_got_list 7
+#define PARSE_set_c1tics_x_0tick_list 1
+#define PARSE_set_c1tics_label_0tick_list 2
+#define PARSE_set_c1tics_0tick_list 8
+#define PARSE_set_c1tics_start 9
+#define PARSE_set_c1tics_increment 10
+#define PARSE_set_c1tics_end 11
+#define PARSE_set_calendar_directive 0
+#define PARSE_set_calendar_editno 1
+#define PARSE_set_calendar_set_option 2
+#define PARSE_set_calendar_X 3
+#define PARSE_set_calendar_calendar 4
+#define PARSE_set_calendar_calendarin 5
+#define PARSE_set_calendar_calendarout 6
+#define PARSE_set_clip_directive 0
+#define PARSE_set_clip_editno 1
+#define PARSE_set_clip_set_option 2
+#define PARSE_set_clip_X 3
+#define PARSE_set_colkey_directive 0
+#define PARSE_set_colkey_editno 1
+#define PARSE_set_colkey_set_option 2
+#define PARSE_set_colkey_X 3
+#define PARSE_set_colkey_pos 4
+#define PARSE_set_colmap_directive 0
+#define PARSE_set_colmap_editno 1
+#define PARSE_set_colmap_set_option 2
+#define PARSE_set_colmap_X 3
+#define PARSE_set_colmap_color 4
+#define PARSE_set_colmap_mask 5
+#define PARSE_set_colmap_nomask 6
+#define PARSE_set_contours_directive 0
+#define PARSE_set_contours_editno 1
+#define PARSE_set_contours_set_option 2
+#define PARSE_set_contours_X 3
+#define PARSE_set_contours_label 4
+#define PARSE_set_contours_nolabel 5
+#define PARSE_set_contours_contour_contour_list 1
+#define PARSE_set_contours_contour_list 6
+#define PARSE_set_contours_contours 7
+#define PARSE_set_crange_directive 0
+#define PARSE_set_crange_editno 1
+#define PARSE_set_crange_set_option 2
+#define PARSE_set_crange_X 3
+#define PARSE_set_crange_c_number 4
+#define PARSE_set_crange_reverse 5
+#define PARSE_set_crange_noreverse 6
+#define PARSE_set_crange_min 7
+#define PARSE_set_crange_minauto 8
+#define PARSE_set_crange_max 9
+#define PARSE_set_crange_maxauto 10
+#define PARSE_set_crange_renormalise 11
+#define PARSE_set_crange_norenormalise 12
+#define PARSE_set_style_numbered_directive 0
+#define PARSE_set_style_numbered_editno 1
+#define PARSE_set_style_numbered_set_option 2
+#define PARSE_set_style_numbered_X 3
+#define PARSE_set_style_numbered_dataset_type 4
+#define PARSE_set_style_numbered_style_set_number 5
+#define PARSE_set_style_numbered_linetype 6
+#define PARSE_set_style_numbered_linewidth 7
+#define PARSE_set_style_numbered_pointsize 8
+#define PARSE_set_style_numbered_pointtype 9
+#define PARSE_set_style_numbered_style_number 10
+#define PARSE_set_style_numbered_pointlinewidth 11
+#define PARSE_set_style_numbered_color 12
+#define PARSE_set_style_numbered_fillcolor 13
+#define PARSE_set_style_numbered_style 14
+#define PARSE_set_datacache_directive 0
+#define PARSE_set_datacache_editno 1
+#define PARSE_set_datacache_set_option 2
+#define PARSE_set_datacache_X 3
+#define PARSE_set_datacache_datacache 4
+#define PARSE_set_display_directive 0
+#define PARSE_set_display_editno 1
+#define PARSE_set_display_set_option 2
+#define PARSE_set_display_X 3
+#define PARSE_set_filter_directive 0
+#define PARSE_set_filter_editno 1
+#define PARSE_set_filter_set_option 2
+#define PARSE_set_filter_X 3
+#define PARSE_set_filter_filename 4
+#define PARSE_set_filter_filter 5
+#define PARSE_set_fontsize_directive 0
+#define PARSE_set_fontsize_editno 1
+#define PARSE_set_fontsize_set_option 2
+#define PARSE_set_fontsize_X 3
+#define PARSE_set_fontsize_fontsize 4
+#define PARSE_set_grid_directive 0
+#define PARSE_set_grid_editno 1
+#define PARSE_set_grid_set_option 2
+#define PARSE_set_grid_X 3
+#define PARSE_set_grid_axis_0axes 1
+#define PARSE_set_grid_0axes 4
+#define PARSE_set_gridmajcolor_directive 0
+#define PARSE_set_gridmajcolor_editno 1
+#define PARSE_set_gridmajcolor_set_option 2
+#define PARSE_set_gridmajcolor_X 3
+#define PARSE_set_gridmajcolor_color 4
+#define PARSE_set_gridmincolor_directive 0
+#define PARSE_set_gridmincolor_editno 1
+#define PARSE_set_gridmincolor_set_option 2
+#define PARSE_set_gridmincolor_X 3
+#define PARSE_set_gridmincolor_color 4
+#define PARSE_set_key_directive 0
+#define PARSE_set_key_editno 1
+#define PARSE_set_key_set_option 2
+#define PARSE_set_key_X 3
+#define PARSE_set_key_pos 4
+#define PARSE_set_key_xpos 5
+#define PARSE_set_key_ypos 6
+#define PARSE_set_key_offset 7
+#define PARSE_set_keycolumns_directive 0
+#define PARSE_set_keycolumns_editno 1
+#define PARSE_set_keycolumns_set_option 2
+#define PARSE_set_keycolumns_X 3
+#define PARSE_set_keycolumns_auto_columns 4
+#define PARSE_set_keycolumns_key_columns 5
+#define PARSE_set_label_directive 0
+#define PARSE_set_label_editno 1
+#define PARSE_set_label_set_option 2
+#define PARSE_set_label_X 3
+#define PARSE_set_label_label_id 4
+#define PARSE_set_label_label_text 5
+#define PARSE_set_label_x_system 6
+#define PARSE_set_label_x_axis 7
+#define PARSE_set_label_x 8
+#define PARSE_set_label_y_system 9
+#define PARSE_set_label_y_axis 10
+#define PARSE_set_label_y 11
+#define PARSE_set_label_z_system 12
+#define PARSE_set_label_z_axis 13
+#define PARSE_set_label_z 14
+#define PARSE_set_label_rotation 15
+#define PARSE_set_label_gap 16
+#define PARSE_set_label_halign 17
+#define PARSE_set_label_valign 18
+#define PARSE_set_label_color 19
+#define PARSE_set_label_fontsize 20
+#define PARSE_set_linewidth_directive 0
+#define PARSE_set_linewidth_editno 1
+#define PARSE_set_linewidth_set_option 2
+#define PARSE_set_linewidth_X 3
+#define PARSE_set_linewidth_linewidth 4
+#define PARSE_set_logscale_directive 0
+#define PARSE_set_logscale_editno 1
+#define PARSE_set_logscale_set_option 2
+#define PARSE_set_logscale_X 3
+#define PARSE_set_logscale_axis_0axes 1
+#define PARSE_set_logscale_tlog_0axes 2
+#define PARSE_set_logscale_ulog_0axes 3
+#define PARSE_set_logscale_vlog_0axes 4
+#define PARSE_set_logscale_c1log_0axes 5
+#define PARSE_set_logscale_c2log_0axes 6
+#define PARSE_set_logscale_c3log_0axes 7
+#define PARSE_set_logscale_c4log_0axes 8
+#define PARSE_set_logscale_0axes 4
+#define PARSE_set_logscale_base 5
+#define PARSE_set_multiplot_directive 0
+#define PARSE_set_multiplot_editno 1
+#define PARSE_set_multiplot_set_option 2
+#define PARSE_set_multiplot_X 3
+#define PARSE_set_noarrow_directive 0
+#define PARSE_set_noarrow_editno 1
+#define PARSE_set_noarrow_set_option 2
+#define PARSE_set_noarrow_X 3
+#define PARSE_set_noarrow_arrow_id_0arrow_list 1
+#define PARSE_set_noarrow_0arrow_list 4
+#define PARSE_unset_axis_directive 0
+#define PARSE_unset_axis_editno 1
+#define PARSE_unset_axis_set_option 2
+#define PARSE_unset_axis_X 3
+#define PARSE_unset_axis_axis_axes 1
+#define PARSE_unset_axis_axes 4
+#define PARSE_set_nobackup_directive 0
+#define PARSE_set_nobackup_editno 1
+#define PARSE_set_nobackup_set_option 2
+#define PARSE_set_nobackup_X 3
+#define PARSE_set_noclip_directive 0
+#define PARSE_set_noclip_editno 1
+#define PARSE_set_noclip_set_option 2
+#define PARSE_set_noclip_X 3
+#define PARSE_set_nocolkey_directive 0
+#define PARSE_set_nocolkey_editno 1
+#define PARSE_set_nocolkey_set_option 2
+#define PARSE_set_nocolkey_X 3
+#define PARSE_set_nodisplay_directive 0
+#define PARSE_set_nodisplay_editno 1
+#define PARSE_set_nodisplay_set_option 2
+#define PARSE_set_nodisplay_X 3
+#define PARSE_set_nogrid_directive 0
+#define PARSE_set_nogrid_editno 1
+#define PARSE_set_nogrid_set_option 2
+#define PARSE_set_nogrid_X 3
+#define PARSE_set_nogrid_axis_0axes 1
+#define PARSE_set_nogrid_0axes 4
+#define PARSE_set_nokey_directive 0
+#define PARSE_set_nokey_editno 1
+#define PARSE_set_nokey_set_option 2
+#define PARSE_set_nokey_X 3
+#define PARSE_set_nolabel_directive 0
+#define PARSE_set_nolabel_editno 1
+#define PARSE_set_nolabel_set_option 2
+#define PARSE_set_nolabel_X 3
+#define PARSE_set_nolabel_label_id_0label_list 1
+#define PARSE_set_nolabel_0label_list 4
+#define PARSE_set_noxlabel_directive 0
+#define PARSE_set_noxlabel_editno 1
+#define PARSE_set_noxlabel_set_option 2
+#define PARSE_set_noxlabel_X 3
+#define PARSE_set_noxlabel_axis 4
+#define PARSE_set_noc1label_directive 0
+#define PARSE_set_noc1label_editno 1
+#define PARSE_set_noc1label_set_option 2
+#define PARSE_set_noc1label_X 3
+#define PARSE_set_nostyle_directive 0
+#define PARSE_set_nostyle_editno 1
+#define PARSE_set_nostyle_set_option 2
+#define PARSE_set_nostyle_X 3
+#define PARSE_set_nostyle_dataset_type 4
+#define PARSE_set_nostyle_id_0style_ids 1
+#define PARSE_set_nostyle_0style_ids 5
+#define PARSE_set_nologscale_directive 0
+#define PARSE_set_nologscale_editno 1
+#define PARSE_set_nologscale_set_option 2
+#define PARSE_set_nologscale_X 3
+#define PARSE_set_nologscale_axis_0axes 1
+#define PARSE_set_nologscale_tlog_0axes 2
+#define PARSE_set_nologscale_ulog_0axes 3
+#define PARSE_set_nologscale_vlog_0axes 4
+#define PARSE_set_nologscale_c1log_0axes 5
+#define PARSE_set_nologscale_c2log_0axes 6
+#define PARSE_set_nologscale_c3log_0axes 7
+#define PARSE_set_nologscale_c4log_0axes 8
+#define PARSE_set_nologscale_0axes 4
+#define PARSE_set_nomultiplot_directive 0
+#define PARSE_set_nomultiplot_editno 1
+#define PARSE_set_nomultiplot_set_option 2
+#define PARSE_set_nomultiplot_X 3
+#define PARSE_set_notics_directive 0
+#define PARSE_set_notics_editno 1
+#define PARSE_set_notics_set_option 2
+#define PARSE_set_notics_X 3
+#define PARSE_set_notics_minor 4
+#define PARSE_set_notics_axis 5
+#define PARSE_set_noc1tics_directive 0
+#define PARSE_set_noc1tics_editno 1
+#define PARSE_set_noc1tics_set_option 2
+#define PARSE_set_noc1tics_X 3
+#define PARSE_set_noc1tics_minor 4
+#define PARSE_set_noc1format_directive 0
+#define PARSE_set_noc1format_editno 1
+#define PARSE_set_noc1format_set_option 2
+#define PARSE_set_noc1format_X 3
+#define PARSE_set_notitle_directive 0
+#define PARSE_set_notitle_editno 1
+#define PARSE_set_notitle_set_option 2
+#define PARSE_set_notitle_X 3
+#define PARSE_set_noxformat_directive 0
+#define PARSE_set_noxformat_editno 1
+#define PARSE_set_noxformat_set_option 2
+#define PARSE_set_noxformat_X 3
+#define PARSE_set_noxformat_axis 4
+#define PARSE_set_numerics_directive 0
+#define PARSE_set_numerics_editno 1
+#define PARSE_set_numerics_set_option 2
+#define PARSE_set_numerics_X 3
+#define PARSE_set_numerics_number_significant_figures 4
+#define PARSE_set_numerics_errortype 5
+#define PARSE_set_numerics_complex 6
+#define PARSE_set_numerics_display 7
+#define PARSE_set_origin_directive 0
+#define PARSE_set_origin_editno 1
+#define PARSE_set_origin_set_option 2
+#define PARSE_set_origin_X 3
+#define PARSE_set_origin_origin 4
+#define PARSE_set_output_directive 0
+#define PARSE_set_output_editno 1
+#define PARSE_set_output_set_option 2
+#define PARSE_set_output_X 3
+#define PARSE_set_output_filename 4
+#define PARSE_set_palette_directive 0
+#define PARSE_set_palette_editno 1
+#define PARSE_set_palette_set_option 2
+#define PARSE_set_palette_X 3
+#define PARSE_set_palette_list 4
+#define PARSE_set_palette_color_palette 1
+#define PARSE_set_palette_palette 5
+#define PARSE_set_papersize_directive 0
+#define PARSE_set_papersize_editno 1
+#define PARSE_set_papersize_set_option 2
+#define PARSE_set_papersize_X 3
+#define PARSE_set_papersize_size 4
+#define PARSE_set_papersize_paper_name 6
+#define PARSE_set_pointlinewidth_directive 0
+#define PARSE_set_pointlinewidth_editno 1
+#define PARSE_set_pointlinewidth_set_option 2
+#define PARSE_set_pointlinewidth_X 3
+#define PARSE_set_pointlinewidth_pointlinewidth 4
+#define PARSE_set_pointsize_directive 0
+#define PARSE_set_pointsize_editno 1
+#define PARSE_set_pointsize_set_option 2
+#define PARSE_set_pointsize_X 3
+#define PARSE_set_pointsize_pointsize 4
+#define PARSE_set_preamble_directive 0
+#define PARSE_set_preamble_editno 1
+#define PARSE_set_preamble_set_option 2
+#define PARSE_set_preamble_X 3
+#define PARSE_set_preamble_preamble 4
+#define PARSE_set_samples_directive 0
+#define PARSE_set_samples_editno 1
+#define PARSE_set_samples_set_option 2
+#define PARSE_set_samples_X 3
+#define PARSE_set_samples_samplesX 4
+#define PARSE_set_samples_samplesXauto 5
+#define PARSE_set_samples_samplesY 6
+#define PARSE_set_samples_samplesYauto 7
+#define PARSE_set_samples_method 8
+#define PARSE_set_samples_samples 9
+#define PARSE_set_seed_directive 0
+#define PARSE_set_seed_editno 1
+#define PARSE_set_seed_set_option 2
+#define PARSE_set_seed_X 3
+#define PARSE_set_seed_seed 4
+#define PARSE_set_size_directive 0
+#define PARSE_set_size_editno 1
+#define PARSE_set_size_set_option 2
+#define PARSE_set_size_X 3
+#define PARSE_set_size_height 4
+#define PARSE_set_size_noratio 5
+#define PARSE_set_size_ratio 6
+#define PARSE_set_size_square 7
+#define PARSE_set_size_depth 8
+#define PARSE_set_size_nozratio 9
+#define PARSE_set_size_zratio 10
+#define PARSE_set_size_width 11
+#define PARSE_set_terminal_directive 0
+#define PARSE_set_terminal_editno 1
+#define PARSE_set_terminal_set_option 2
+#define PARSE_set_terminal_X 3
+#define PARSE_set_terminal_term 4
+#define PARSE_set_terminal_col 5
+#define PARSE_set_terminal_enlarge 6
+#define PARSE_set_terminal_land 7
+#define PARSE_set_terminal_trans 8
+#define PARSE_set_terminal_invert 9
+#define PARSE_set_terminal_antiali 10
+#define PARSE_set_terminal_dpi 11
+#define PARSE_set_textcolor_directive 0
+#define PARSE_set_textcolor_editno 1
+#define PARSE_set_textcolor_set_option 2
+#define PARSE_set_textcolor_X 3
+#define PARSE_set_textcolor_color 4
+#define PARSE_set_texthalign_directive 0
+#define PARSE_set_texthalign_editno 1
+#define PARSE_set_texthalign_set_option 2
+#define PARSE_set_texthalign_X 3
+#define PARSE_set_texthalign_left 4
+#define PARSE_set_texthalign_center 5
+#define PARSE_set_texthalign_right 6
+#define PARSE_set_textvalign_directive 0
+#define PARSE_set_textvalign_editno 1
+#define PARSE_set_textvalign_set_option 2
+#define PARSE_set_textvalign_X 3
+#define PARSE_set_textvalign_top 4
+#define PARSE_set_textvalign_center 5
+#define PARSE_set_textvalign_bottom 6
+#define PARSE_set_threads_directive 0
+#define PARSE_set_threads_editno 1
+#define PARSE_set_threads_set_option 2
+#define PARSE_set_threads_X 3
+#define PARSE_set_threads_auto_threads 4
+#define PARSE_set_threads_threads 5
+#define PARSE_set_timezone_directive 0
+#define PARSE_set_timezone_editno 1
+#define PARSE_set_timezone_set_option 2
+#define PARSE_set_timezone_X 3
+#define PARSE_set_timezone_timezone 4
+#define PARSE_set_title_directive 0
+#define PARSE_set_title_editno 1
+#define PARSE_set_title_set_option 2
+#define PARSE_set_title_X 3
+#define PARSE_set_title_title 4
+#define PARSE_set_title_offset 5
+#define PARSE_set_trange_directive 0
+#define PARSE_set_trange_editno 1
+#define PARSE_set_trange_set_option 2
+#define PARSE_set_trange_X 3
+#define PARSE_set_trange_range 4
+#define PARSE_set_trange_min 5
+#define PARSE_set_trange_max 6
+#define PARSE_set_trange_reverse 7
+#define PARSE_set_unit_directive 0
+#define PARSE_set_unit_editno 1
+#define PARSE_set_unit_set_option 2
+#define PARSE_set_unit_X 3
+#define PARSE_set_unit_angle 4
+#define PARSE_set_unit_abbrev 5
+#define PARSE_set_unit_prefix 6
+#define PARSE_set_unit_scheme 7
+#define PARSE_set_unit_X_preferred_units 1
+#define PARSE_set_unit_quantity_preferred_units 2
+#define PARSE_set_unit_unit_preferred_units 3
+#define PARSE_set_unit_preferred_units 8
+#define PARSE_set_unit_preferred_unit 9
+#define PARSE_set_unit_unpreferred_unit 10
+#define PARSE_set_urange_directive 0
+#define PARSE_set_urange_editno 1
+#define PARSE_set_urange_set_option 2
+#define PARSE_set_urange_X 3
+#define PARSE_set_urange_range 4
+#define PARSE_set_urange_min 5
+#define PARSE_set_urange_max 6
+#define PARSE_set_urange_reverse 7
+#define PARSE_set_view_directive 0
+#define PARSE_set_view_editno 1
+#define PARSE_set_view_set_option 2
+#define PARSE_set_view_X 3
+#define PARSE_set_view_xy_angle 4
+#define PARSE_set_view_yz_angle 5
+#define PARSE_set_viewer_directive 0
+#define PARSE_set_viewer_editno 1
+#define PARSE_set_viewer_set_option 2
+#define PARSE_set_viewer_X 3
+#define PARSE_set_viewer_auto_viewer 4
+#define PARSE_set_viewer_viewer 5
+#define PARSE_set_vrange_directive 0
+#define PARSE_set_vrange_editno 1
+#define PARSE_set_vrange_set_option 2
+#define PARSE_set_vrange_X 3
+#define PARSE_set_vrange_range 4
+#define PARSE_set_vrange_min 5
+#define PARSE_set_vrange_max 6
+#define PARSE_set_vrange_reverse 7
+#define PARSE_set_width_directive 0
+#define PARSE_set_width_editno 1
+#define PARSE_set_width_set_option 2
+#define PARSE_set_width_X 3
+#define PARSE_set_width_width 4
+#define PARSE_set_error_directive 0
+#define PARSE_set_error_editno 1
+#define PARSE_set_error_set_option 2
+#define PARSE_set_error_X 3
+#define PARSE_set_error_restofline 4
+#define PARSE_show_directive 0
+#define PARSE_show_editno 1
+#define PARSE_show_set_option 2
+#define PARSE_show_X 3
+#define PARSE_show_setting_0setting_list 1
+#define PARSE_show_0setting_list 4
+#define PARSE_solve_directive 0
+#define PARSE_solve_editno 1
+#define PARSE_solve_set_option 2
+#define PARSE_solve_X 3
+#define PARSE_solve_left_expression_expressions 1
+#define PARSE_solve_X_expressions 2
+#define PARSE_solve_right_expression_expressions 3
+#define PARSE_solve_expressions 4
+#define PARSE_solve_fit_variable_fit_variables 1
+#define PARSE_solve_fit_variables 5
+#define PARSE_interpolate2d_directive 0
+#define PARSE_interpolate2d_editno 1
+#define PARSE_interpolate2d_set_option 2
+#define PARSE_interpolate2d_X 3
+#define PARSE_interpolate2d_bmp 4
+#define PARSE_interpolate2d_X_0range_list 1
+#define PARSE_interpolate2d_min_0range_list 2
+#define PARSE_interpolate2d_minauto_0range_list 3
+#define PARSE_interpolate2d_max_0range_list 4
+#define PARSE_interpolate2d_maxauto_0range_list 5
+#define PARSE_interpolate2d_0range_list 5
+#define PARSE_interpolate2d_varname_varnames 1
+#define PARSE_interpolate2d_varnames 6
+#define PARSE_interpolate2d_parametric 7
+#define PARSE_interpolate2d_tmin 8
+#define PARSE_interpolate2d_tmax 9
+#define PARSE_interpolate2d_vmin 10
+#define PARSE_interpolate2d_vmax 11
+#define PARSE_interpolate2d_expression_expression_list 1
+#define PARSE_interpolate2d_expression_list 12
+#define PARSE_interpolate2d_every_item_every_list 1
+#define PARSE_interpolate2d_every_list 13
+#define PARSE_interpolate2d_index 14
+#define PARSE_interpolate2d_select_criterion 15
+#define PARSE_interpolate2d_use_rows 16
+#define PARSE_interpolate2d_use_columns 17
+#define PARSE_interpolate2d_using_item_using_list 1
+#define PARSE_interpolate2d_using_list 18
+#define PARSE_interpolate2d_data 19
+#define PARSE_subroutine_directive 0
+#define PARSE_subroutine_editno 1
+#define PARSE_subroutine_set_option 2
+#define PARSE_subroutine_X 3
+#define PARSE_subroutine_subroutine_name_subroutine_names 1
+#define PARSE_subroutine_subroutine_names 4
+#define PARSE_subroutine_argument_name_0argument_list 1
+#define PARSE_subroutine_0argument_list 5
+#define PARSE_subroutine_code 6
+#define PARSE_swap_directive 0
+#define PARSE_swap_editno 1
+#define PARSE_swap_set_option 2
+#define PARSE_swap_X 3
+#define PARSE_swap_item1 4
+#define PARSE_swap_item2 5
+#define PARSE_tabulate_directive 0
+#define PARSE_tabulate_editno 1
+#define PARSE_tabulate_set_option 2
+#define PARSE_tabulate_X 3
+#define PARSE_tabulate_X_0range_list 1
+#define PARSE_tabulate_min_0range_list 2
+#define PARSE_tabulate_minauto_0range_list 3
+#define PARSE_tabulate_max_0range_list 4
+#define PARSE_tabulate_maxauto_0range_list 5
+#define PARSE_tabulate_0range_list 4
+#define PARSE_tabulate_parametric_0tabulate_list 1
+#define PARSE_tabulate_X_0tabulate_list 2
+#define PARSE_tabulate_tmin_0tabulate_list 3
+#define PARSE_tabulate_tmax_0tabulate_list 4
+#define PARSE_tabulate_vmin_0tabulate_list 5
+#define PARSE_tabulate_vmax_0tabulate_list 6
+#define PARSE_tabulate_expression_expression_list_0tabulate_list 1
+#define PARSE_tabulate_expression_list_0tabulate_list 7
+#define PARSE_tabulate_every_item_every_list_0tabulate_list 1
+#define PARSE_tabulate_every_list_0tabulate_list 8
+#define PARSE_tabulate_index_0tabulate_list 9
+#define PARSE_tabulate_select_criterion_0tabulate_list 10
+#define PARSE_tabulate_sort_expression_0tabulate_list 11
+#define PARSE_tabulate_use_rows_0tabulate_list 12
+#define PARSE_tabulate_use_columns_0tabulate_list 13
+#define PARSE_tabulate_using_item_using_list_0tabulate_list 1
+#define PARSE_tabulate_using_list_0tabulate_list 14
+#define PARSE_tabulate_binary_0tabulate_list 15
+#define PARSE_tabulate_format_0tabulate_list 16
+#define PARSE_tabulate_spacing_0tabulate_list 17
+#define PARSE_tabulate_0tabulate_list 5
+#define PARSE_tabulate_data 6
+#define PARSE_text_directive 0
+#define PARSE_text_editno 1
+#define PARSE_text_set_option 2
+#define PARSE_text_X 3
+#define PARSE_text_string 4
+#define PARSE_text_p 5
+#define PARSE_text_rotation 7
+#define PARSE_text_gap 8
+#define PARSE_text_halign 9
+#define PARSE_text_valign 10
+#define PARSE_text_color 11
+#define PARSE_undelete_directive 0
+#define PARSE_undelete_editno 1
+#define PARSE_undelete_set_option 2
+#define PARSE_undelete_X 3
+#define PARSE_undelete_number_undeleteno 1
+#define PARSE_undelete_undeleteno 4
+#define PARSE_unset_xformat_directive 0
+#define PARSE_unset_xformat_editno 1
+#define PARSE_unset_xformat_set_option 2
+#define PARSE_unset_xformat_X 3
+#define PARSE_unset_xformat_axis 4
+#define PARSE_unset_xlabel_directive 0
+#define PARSE_unset_xlabel_editno 1
+#define PARSE_unset_xlabel_set_option 2
+#define PARSE_unset_xlabel_X 3
+#define PARSE_unset_xlabel_axis 4
+#define PARSE_unset_range_directive 0
+#define PARSE_unset_range_editno 1
+#define PARSE_unset_range_set_option 2
+#define PARSE_unset_range_X 3
+#define PARSE_unset_range_axis 4
+#define PARSE_unset_tics_directive 0
+#define PARSE_unset_tics_editno 1
+#define PARSE_unset_tics_set_option 2
+#define PARSE_unset_tics_X 3
+#define PARSE_unset_tics_minor 4
+#define PARSE_unset_tics_axis 5
+#define PARSE_unset_c1tics_directive 0
+#define PARSE_unset_c1tics_editno 1
+#define PARSE_unset_c1tics_set_option 2
+#define PARSE_unset_c1tics_X 3
+#define PARSE_unset_c1tics_minor 4
+#define PARSE_unset_arrow_directive 0
+#define PARSE_unset_arrow_editno 1
+#define PARSE_unset_arrow_set_option 2
+#define PARSE_unset_arrow_X 3
+#define PARSE_unset_arrow_arrow_id_0arrow_list 1
+#define PARSE_unset_arrow_0arrow_list 4
+#define PARSE_unset_autoscale_directive 0
+#define PARSE_unset_autoscale_editno 1
+#define PARSE_unset_autoscale_set_option 2
+#define PARSE_unset_autoscale_X 3
+#define PARSE_unset_autoscale_axis_axes 1
+#define PARSE_unset_autoscale_axes 4
+#define PARSE_unset_axescolor_directive 0
+#define PARSE_unset_axescolor_editno 1
+#define PARSE_unset_axescolor_set_option 2
+#define PARSE_unset_axescolor_X 3
+#define PARSE_unset_axis_directive 0
+#define PARSE_unset_axis_editno 1
+#define PARSE_unset_axis_set_option 2
+#define PARSE_unset_axis_X 3
+#define PARSE_unset_axis_axis_0axes 1
+#define PARSE_unset_axis_0axes 4
+#define PARSE_unset_axisunitstyle_directive 0
+#define PARSE_unset_axisunitstyle_editno 1
+#define PARSE_unset_axisunitstyle_set_option 2
+#define PARSE_unset_axisunitstyle_X 3
+#define PARSE_unset_backup_directive 0
+#define PARSE_unset_backup_editno 1
+#define PARSE_unset_backup_set_option 2
+#define PARSE_unset_backup_X 3
+#define PARSE_unset_bar_directive 0
+#define PARSE_unset_bar_editno 1
+#define PARSE_unset_bar_set_option 2
+#define PARSE_unset_bar_X 3
+#define PARSE_unset_binorigin_directive 0
+#define PARSE_unset_binorigin_editno 1
+#define PARSE_unset_binorigin_set_option 2
+#define PARSE_unset_binorigin_X 3
+#define PARSE_unset_binwidth_directive 0
+#define PARSE_unset_binwidth_editno 1
+#define PARSE_unset_binwidth_set_option 2
+#define PARSE_unset_binwidth_X 3
+#define PARSE_unset_boxfrom_directive 0
+#define PARSE_unset_boxfrom_editno 1
+#define PARSE_unset_boxfrom_set_option 2
+#define PARSE_unset_boxfrom_X 3
+#define PARSE_unset_boxwidth_directive 0
+#define PARSE_unset_boxwidth_editno 1
+#define PARSE_unset_boxwidth_set_option 2
+#define PARSE_unset_boxwidth_X 3
+#define PARSE_unset_c1format_directive 0
+#define PARSE_unset_c1format_editno 1
+#define PARSE_unset_c1format_set_option 2
+#define PARSE_unset_c1format_X 3
+#define PARSE_unset_c1label_directive 0
+#define PARSE_unset_c1label_editno 1
+#define PARSE_unset_c1label_set_option 2
+#define PARSE_unset_c1label_X 3
+#define PARSE_unset_calendar_directive 0
+#define PARSE_unset_calendar_editno 1
+#define PARSE_unset_calendar_set_option 2
+#define PARSE_unset_calendar_X 3
+#define PARSE_unset_clip_directive 0
+#define PARSE_unset_clip_editno 1
+#define PARSE_unset_clip_set_option 2
+#define PARSE_unset_clip_X 3
+#define PARSE_unset_colkey_directive 0
+#define PARSE_unset_colkey_editno 1
+#define PARSE_unset_colkey_set_option 2
+#define PARSE_unset_colkey_X 3
+#define PARSE_unset_colmap_directive 0
+#define PARSE_unset_colmap_editno 1
+#define PARSE_unset_colmap_set_option 2
+#define PARSE_unset_colmap_X 3
+#define PARSE_unset_contours_directive 0
+#define PARSE_unset_contours_editno 1
+#define PARSE_unset_contours_set_option 2
+#define PARSE_unset_contours_X 3
+#define PARSE_unset_crange_directive 0
+#define PARSE_unset_crange_editno 1
+#define PARSE_unset_crange_set_option 2
+#define PARSE_unset_crange_X 3
+#define PARSE_unset_crange_c_number 4
+#define PARSE_unset_datacache_directive 0
+#define PARSE_unset_datacache_editno 1
+#define PARSE_unset_datacache_set_option 2
+#define PARSE_unset_datacache_X 3
+#define PARSE_unset_display_directive 0
+#define PARSE_unset_display_editno 1
+#define PARSE_unset_display_set_option 2
+#define PARSE_unset_display_X 3
+#define PARSE_unset_filter_directive 0
+#define PARSE_unset_filter_editno 1
+#define PARSE_unset_filter_set_option 2
+#define PARSE_unset_filter_X 3
+#define PARSE_unset_filter_filename 4
+#define PARSE_unset_fontsize_directive 0
+#define PARSE_unset_fontsize_editno 1
+#define PARSE_unset_fontsize_set_option 2
+#define PARSE_unset_fontsize_X 3
+#define PARSE_unset_grid_directive 0
+#define PARSE_unset_grid_editno 1
+#define PARSE_unset_grid_set_option 2
+#define PARSE_unset_grid_X 3
+#define PARSE_unset_gridmajcolor_directive 0
+#define PARSE_unset_gridmajcolor_editno 1
+#define PARSE_unset_gridmajcolor_set_option 2
+#define PARSE_unset_gridmajcolor_X 3
+#define PARSE_unset_gridmincolor_directive 0
+#define PARSE_unset_gridmincolor_editno 1
+#define PARSE_unset_gridmincolor_set_option 2
+#define PARSE_unset_gridmincolor_X 3
+#define PARSE_unset_key_directive 0
+#define PARSE_unset_key_editno 1
+#define PARSE_unset_key_set_option 2
+#define PARSE_unset_key_X 3
+#define PARSE_unset_keycolumns_directive 0
+#define PARSE_unset_keycolumns_editno 1
+#define PARSE_unset_keycolumns_set_option 2
+#define PARSE_unset_keycolumns_X 3
+#define PARSE_unset_label_directive 0
+#define PARSE_unset_label_editno 1
+#define PARSE_unset_label_set_option 2
+#define PARSE_unset_label_X 3
+#define PARSE_unset_label_label_id_0label_list 1
+#define PARSE_unset_label_0label_list 4
+#define PARSE_unset_style_directive 0
+#define PARSE_unset_style_editno 1
+#define PARSE_unset_style_set_option 2
+#define PARSE_unset_style_X 3
+#define PARSE_unset_style_dataset_type 4
+#define PARSE_unset_style_id_0style_ids 1
+#define PARSE_unset_style_0style_ids 5
+#define PARSE_unset_linewidth_directive 0
+#define PARSE_unset_linewidth_editno 1
+#define PARSE_unset_linewidth_set_option 2
+#define PARSE_unset_linewidth_X 3
+#define PARSE_unset_logscale_directive 0
+#define PARSE_unset_logscale_editno 1
+#define PARSE_unset_logscale_set_option 2
+#define PARSE_unset_logscale_X 3
+#define PARSE_unset_logscale_axis_0axes 1
+#define PARSE_unset_logscale_tlog_0axes 2
+#define PARSE_unset_logscale_ulog_0axes 3
+#define PARSE_unset_logscale_vlog_0axes 4
+#define PARSE_unset_logscale_c1log_0axes 5
+#define PARSE_unset_logscale_c2log_0axes 6
+#define PARSE_unset_logscale_c3log_0axes 7
+#define PARSE_unset_logscale_c4log_0axes 8
+#define PARSE_unset_logscale_0axes 4
+#define PARSE_unset_multiplot_directive 0
+#define PARSE_unset_multiplot_editno 1
+#define PARSE_unset_multiplot_set_option 2
+#define PARSE_unset_multiplot_X 3
+#define PARSE_unset_arrow_directive 0
+#define PARSE_unset_arrow_editno 1
+#define PARSE_unset_arrow_set_option 2
+#define PARSE_unset_arrow_X 3
+#define PARSE_unset_arrow_arrow_id_0arrow_list 1
+#define PARSE_unset_arrow_0arrow_list 4
+#define PARSE_unset_axis_directive 0
+#define PARSE_unset_axis_editno 1
+#define PARSE_unset_axis_set_option 2
+#define PARSE_unset_axis_X 3
+#define PARSE_unset_axis_axis_axes 1
+#define PARSE_unset_axis_axes 4
+#define PARSE_unset_backup_directive 0
+#define PARSE_unset_backup_editno 1
+#define PARSE_unset_backup_set_option 2
+#define PARSE_unset_backup_X 3
+#define PARSE_unset_clip_directive 0
+#define PARSE_unset_clip_editno 1
+#define PARSE_unset_clip_set_option 2
+#define PARSE_unset_clip_X 3
+#define PARSE_unset_colkey_directive 0
+#define PARSE_unset_colkey_editno 1
+#define PARSE_unset_colkey_set_option 2
+#define PARSE_unset_colkey_X 3
+#define PARSE_unset_display_directive 0
+#define PARSE_unset_display_editno 1
+#define PARSE_unset_display_set_option 2
+#define PARSE_unset_display_X 3
+#define PARSE_unset_grid_directive 0
+#define PARSE_unset_grid_editno 1
+#define PARSE_unset_grid_set_option 2
+#define PARSE_unset_grid_X 3
+#define PARSE_unset_key_directive 0
+#define PARSE_unset_key_editno 1
+#define PARSE_unset_key_set_option 2
+#define PARSE_unset_key_X 3
+#define PARSE_unset_label_directive 0
+#define PARSE_unset_label_editno 1
+#define PARSE_unset_label_set_option 2
+#define PARSE_unset_label_X 3
+#define PARSE_unset_label_label_id_0label_list 1
+#define PARSE_unset_label_0label_list 4
+#define PARSE_unset_linewidth_directive 0
+#define PARSE_unset_linewidth_editno 1
+#define PARSE_unset_linewidth_set_option 2
+#define PARSE_unset_linewidth_X 3
+#define PARSE_unset_logscale_directive 0
+#define PARSE_unset_logscale_editno 1
+#define PARSE_unset_logscale_set_option 2
+#define PARSE_unset_logscale_X 3
+#define PARSE_unset_logscale_axis_axes 1
+#define PARSE_unset_logscale_tlog_axes 2
+#define PARSE_unset_logscale_ulog_axes 3
+#define PARSE_unset_logscale_vlog_axes 4
+#define PARSE_unset_logscale_c1log_axes 5
+#define PARSE_unset_logscale_c2log_axes 6
+#define PARSE_unset_logscale_c3log_axes 7
+#define PARSE_unset_logscale_c4log_axes 8
+#define PARSE_unset_logscale_axes 4
+#define PARSE_unset_multiplot_directive 0
+#define PARSE_unset_multiplot_editno 1
+#define PARSE_unset_multiplot_set_option 2
+#define PARSE_unset_multiplot_X 3
+#define PARSE_unset_title_directive 0
+#define PARSE_unset_title_editno 1
+#define PARSE_unset_title_set_option 2
+#define PARSE_unset_title_X 3
+#define PARSE_unset_numerics_display_directive 0
+#define PARSE_unset_numerics_display_editno 1
+#define PARSE_unset_numerics_display_set_option 2
+#define PARSE_unset_numerics_display_X 3
+#define PARSE_unset_origin_directive 0
+#define PARSE_unset_origin_editno 1
+#define PARSE_unset_origin_set_option 2
+#define PARSE_unset_origin_X 3
+#define PARSE_unset_output_directive 0
+#define PARSE_unset_output_editno 1
+#define PARSE_unset_output_set_option 2
+#define PARSE_unset_output_X 3
+#define PARSE_unset_palette_directive 0
+#define PARSE_unset_palette_editno 1
+#define PARSE_unset_palette_set_option 2
+#define PARSE_unset_palette_X 3
+#define PARSE_unset_papersize_directive 0
+#define PARSE_unset_papersize_editno 1
+#define PARSE_unset_papersize_set_option 2
+#define PARSE_unset_papersize_X 3
+#define PARSE_unset_pointlinewidth_directive 0
+#define PARSE_unset_pointlinewidth_editno 1
+#define PARSE_unset_pointlinewidth_set_option 2
+#define PARSE_unset_pointlinewidth_X 3
+#define PARSE_unset_pointsize_directive 0
+#define PARSE_unset_pointsize_editno 1
+#define PARSE_unset_pointsize_set_option 2
+#define PARSE_unset_pointsize_X 3
+#define PARSE_unset_preamble_directive 0
+#define PARSE_unset_preamble_editno 1
+#define PARSE_unset_preamble_set_option 2
+#define PARSE_unset_preamble_X 3
+#define PARSE_unset_samples_directive 0
+#define PARSE_unset_samples_editno 1
+#define PARSE_unset_samples_set_option 2
+#define PARSE_unset_samples_X 3
+#define PARSE_unset_seed_directive 0
+#define PARSE_unset_seed_editno 1
+#define PARSE_unset_seed_set_option 2
+#define PARSE_unset_seed_X 3
+#define PARSE_set_noaxis_directive 0
+#define PARSE_set_noaxis_editno 1
+#define PARSE_set_noaxis_set_option 2
+#define PARSE_set_noaxis_X 3
+#define PARSE_set_noaxis_axis_axes 1
+#define PARSE_set_noaxis_axes 4
+#define PARSE_unset_size_directive 0
+#define PARSE_unset_size_editno 1
+#define PARSE_unset_size_set_option 2
+#define PARSE_unset_size_X 3
+#define PARSE_unset_terminal_directive 0
+#define PARSE_unset_terminal_editno 1
+#define PARSE_unset_terminal_set_option 2
+#define PARSE_unset_terminal_X 3
+#define PARSE_unset_threads_directive 0
+#define PARSE_unset_threads_editno 1
+#define PARSE_unset_threads_set_option 2
+#define PARSE_unset_threads_X 3
+#define PARSE_unset_textcolor_directive 0
+#define PARSE_unset_textcolor_editno 1
+#define PARSE_unset_textcolor_set_option 2
+#define PARSE_unset_textcolor_X 3
+#define PARSE_unset_texthalign_directive 0
+#define PARSE_unset_texthalign_editno 1
+#define PARSE_unset_texthalign_set_option 2
+#define PARSE_unset_texthalign_X 3
+#define PARSE_unset_textvalign_directive 0
+#define PARSE_unset_textvalign_editno 1
+#define PARSE_unset_textvalign_set_option 2
+#define PARSE_unset_textvalign_X 3
+#define PARSE_unset_title_directive 0
+#define PARSE_unset_title_editno 1
+#define PARSE_unset_title_set_option 2
+#define PARSE_unset_title_X 3
+#define PARSE_unset_trange_directive 0
+#define PARSE_unset_trange_editno 1
+#define PARSE_unset_trange_set_option 2
+#define PARSE_unset_trange_X 3
+#define PARSE_unset_unit_preferred_directive 0
+#define PARSE_unset_unit_preferred_editno 1
+#define PARSE_unset_unit_preferred_set_option 2
+#define PARSE_unset_unit_preferred_X 3
+#define PARSE_unset_unit_preferred_quantity 4
+#define PARSE_unset_urange_directive 0
+#define PARSE_unset_urange_editno 1
+#define PARSE_unset_urange_set_option 2
+#define PARSE_unset_urange_X 3
+#define PARSE_unset_view_directive 0
+#define PARSE_unset_view_editno 1
+#define PARSE_unset_view_set_option 2
+#define PARSE_unset_view_X 3
+#define PARSE_unset_viewer_directive 0
+#define PARSE_unset_viewer_editno 1
+#define PARSE_unset_viewer_set_option 2
+#define PARSE_unset_viewer_X 3
+#define PARSE_unset_vrange_directive 0
+#define PARSE_unset_vrange_editno 1
+#define PARSE_unset_vrange_set_option 2
+#define PARSE_unset_vrange_X 3
+#define PARSE_unset_width_directive 0
+#define PARSE_unset_width_editno 1
+#define PARSE_unset_width_set_option 2
+#define PARSE_unset_width_X 3
+#define PARSE_unset_error_directive 0
+#define PARSE_unset_error_editno 1
+#define PARSE_unset_error_set_option 2
+#define PARSE_unset_error_X 3
+#define PARSE_unset_error_restofline 4
+#define PARSE_while_directive 0
+#define PARSE_while_editno 1
+#define PARSE_while_set_option 2
+#define PARSE_while_X 3
+#define PARSE_while_criterion 4
+#define PARSE_while_loopname 5
+#define PARSE_while_code 6
+#define PARSE_with_directive 0
+#define PARSE_with_editno 1
+#define PARSE_with_set_option 2
+#define PARSE_with_X 3
+#define PARSE_with_namespace 4
+#define PARSE_with_code 5
+#define PARSE_INDEX_0argument_list 0
+#define PARSE_INDEX_0arrow_list 1
+#define PARSE_INDEX_0axes 2
+#define PARSE_INDEX_0elifs 3
+#define PARSE_INDEX_0in_operands 4
+#define PARSE_INDEX_0label_list 5
+#define PARSE_INDEX_0operands 6
+#define PARSE_INDEX_0out_operands 7
+#define PARSE_INDEX_0plot_list 8
+#define PARSE_INDEX_0print_list 9
+#define PARSE_INDEX_0range_list 10
+#define PARSE_INDEX_0setting_list 11
+#define PARSE_INDEX_0style_ids 12
+#define PARSE_INDEX_0tabulate_list 13
+#define PARSE_INDEX_0tick_list 14
+#define PARSE_INDEX_X 15
+#define PARSE_INDEX_abbrev 16
+#define PARSE_INDEX_angle 17
+#define PARSE_INDEX_angle1 18
+#define PARSE_INDEX_angle2 19
+#define PARSE_INDEX_antiali 20
+#define PARSE_INDEX_arcfrom 21
+#define PARSE_INDEX_arcto 22
+#define PARSE_INDEX_argument_name 23
+#define PARSE_INDEX_arrow_id 24
+#define PARSE_INDEX_arrow_style 25
+#define PARSE_INDEX_atzero 26
+#define PARSE_INDEX_auto 27
+#define PARSE_INDEX_auto_columns 28
+#define PARSE_INDEX_auto_format 29
+#define PARSE_INDEX_auto_threads 30
+#define PARSE_INDEX_auto_viewer 31
+#define PARSE_INDEX_autofreq 32
+#define PARSE_INDEX_axes 33
+#define PARSE_INDEX_axis 34
+#define PARSE_INDEX_axis_1 35
+#define PARSE_INDEX_axis_2 36
+#define PARSE_INDEX_axis_3 37
+#define PARSE_INDEX_axisdisp 38
+#define PARSE_INDEX_bar_size 39
+#define PARSE_INDEX_bar_size_large 40
+#define PARSE_INDEX_bar_size_small 41
+#define PARSE_INDEX_base 42
+#define PARSE_INDEX_begin 43
+#define PARSE_INDEX_bin_list 44
+#define PARSE_INDEX_bin_origin 45
+#define PARSE_INDEX_bin_width 46
+#define PARSE_INDEX_binary 47
+#define PARSE_INDEX_binorigin 48
+#define PARSE_INDEX_binwidth 49
+#define PARSE_INDEX_bmp 50
+#define PARSE_INDEX_bottom 51
+#define PARSE_INDEX_box_from 52
+#define PARSE_INDEX_box_width 53
+#define PARSE_INDEX_c1log 54
+#define PARSE_INDEX_c2log 55
+#define PARSE_INDEX_c3log 56
+#define PARSE_INDEX_c4log 57
+#define PARSE_INDEX_c_number 58
+#define PARSE_INDEX_calcbbox 59
+#define PARSE_INDEX_calendar 60
+#define PARSE_INDEX_calendarin 61
+#define PARSE_INDEX_calendarout 62
+#define PARSE_INDEX_center 63
+#define PARSE_INDEX_clip 64
+#define PARSE_INDEX_cmd 65
+#define PARSE_INDEX_code 66
+#define PARSE_INDEX_code_elif 67
+#define PARSE_INDEX_code_else 68
+#define PARSE_INDEX_col 69
+#define PARSE_INDEX_color 70
+#define PARSE_INDEX_colorB 71
+#define PARSE_INDEX_colorG 72
+#define PARSE_INDEX_colorR 73
+#define PARSE_INDEX_command 74
+#define PARSE_INDEX_complex 75
+#define PARSE_INDEX_condition 76
+#define PARSE_INDEX_continuous 77
+#define PARSE_INDEX_contour 78
+#define PARSE_INDEX_contour_list 79
+#define PARSE_INDEX_contours 80
+#define PARSE_INDEX_criterion 81
+#define PARSE_INDEX_data 82
+#define PARSE_INDEX_datacache 83
+#define PARSE_INDEX_dataset_type 84
+#define PARSE_INDEX_definition 85
+#define PARSE_INDEX_deleteno 86
+#define PARSE_INDEX_depth 87
+#define PARSE_INDEX_df 88
+#define PARSE_INDEX_dir 89
+#define PARSE_INDEX_directive 90
+#define PARSE_INDEX_directory 91
+#define PARSE_INDEX_discontinuous 92
+#define PARSE_INDEX_display 93
+#define PARSE_INDEX_dpi 94
+#define PARSE_INDEX_eccentricity 95
+#define PARSE_INDEX_editno 96
+#define PARSE_INDEX_end 97
+#define PARSE_INDEX_enlarge 98
+#define PARSE_INDEX_errortype 99
+#define PARSE_INDEX_every_item 100
+#define PARSE_INDEX_every_list 101
+#define PARSE_INDEX_expr 102
+#define PARSE_INDEX_expression 103
+#define PARSE_INDEX_expression_list 104
+#define PARSE_INDEX_expressions 105
+#define PARSE_INDEX_filename 106
+#define PARSE_INDEX_fillcolor 107
+#define PARSE_INDEX_filter 108
+#define PARSE_INDEX_final_value 109
+#define PARSE_INDEX_fit_function 110
+#define PARSE_INDEX_fit_variable 111
+#define PARSE_INDEX_fit_variables 112
+#define PARSE_INDEX_fnname 113
+#define PARSE_INDEX_fnnames 114
+#define PARSE_INDEX_focus 115
+#define PARSE_INDEX_fontsize 116
+#define PARSE_INDEX_format 117
+#define PARSE_INDEX_format_string 118
+#define PARSE_INDEX_function_name 119
+#define PARSE_INDEX_function_names 120
+#define PARSE_INDEX_gap 121
+#define PARSE_INDEX_got_list 122
+#define PARSE_INDEX_gtreq 123
+#define PARSE_INDEX_halign 124
+#define PARSE_INDEX_height 125
+#define PARSE_INDEX_id 126
+#define PARSE_INDEX_in 127
+#define PARSE_INDEX_increment 128
+#define PARSE_INDEX_index 129
+#define PARSE_INDEX_inputvar 130
+#define PARSE_INDEX_invert 131
+#define PARSE_INDEX_invisible 132
+#define PARSE_INDEX_item1 133
+#define PARSE_INDEX_item2 134
+#define PARSE_INDEX_item_list 135
+#define PARSE_INDEX_iterate 136
+#define PARSE_INDEX_key_columns 137
+#define PARSE_INDEX_label 138
+#define PARSE_INDEX_label_id 139
+#define PARSE_INDEX_label_text 140
+#define PARSE_INDEX_land 141
+#define PARSE_INDEX_left 142
+#define PARSE_INDEX_left_expression 143
+#define PARSE_INDEX_linetype 144
+#define PARSE_INDEX_linewidth 145
+#define PARSE_INDEX_linkaxis 146
+#define PARSE_INDEX_linked 147
+#define PARSE_INDEX_linktoid 148
+#define PARSE_INDEX_list 149
+#define PARSE_INDEX_loopname 150
+#define PARSE_INDEX_lr 151
+#define PARSE_INDEX_lt 152
+#define PARSE_INDEX_majoraxis 153
+#define PARSE_INDEX_mask 154
+#define PARSE_INDEX_max 155
+#define PARSE_INDEX_maxauto 156
+#define PARSE_INDEX_message 157
+#define PARSE_INDEX_method 158
+#define PARSE_INDEX_min 159
+#define PARSE_INDEX_minauto 160
+#define PARSE_INDEX_minor 161
+#define PARSE_INDEX_minoraxis 162
+#define PARSE_INDEX_mirror 163
+#define PARSE_INDEX_moveno 164
+#define PARSE_INDEX_namespace 165
+#define PARSE_INDEX_nolabel 166
+#define PARSE_INDEX_nomask 167
+#define PARSE_INDEX_noratio 168
+#define PARSE_INDEX_norenormalise 169
+#define PARSE_INDEX_noreverse 170
+#define PARSE_INDEX_notatzero 171
+#define PARSE_INDEX_notitle 172
+#define PARSE_INDEX_notlinked 173
+#define PARSE_INDEX_notrans 174
+#define PARSE_INDEX_nozratio 175
+#define PARSE_INDEX_number 176
+#define PARSE_INDEX_number_lines 177
+#define PARSE_INDEX_number_significant_figures 178
+#define PARSE_INDEX_object 179
+#define PARSE_INDEX_offset 180
+#define PARSE_INDEX_orient 181
+#define PARSE_INDEX_origin 182
+#define PARSE_INDEX_outvar 183
+#define PARSE_INDEX_p 184
+#define PARSE_INDEX_p1 185
+#define PARSE_INDEX_p2 186
+#define PARSE_INDEX_p3 187
+#define PARSE_INDEX_palette 188
+#define PARSE_INDEX_paper_name 189
+#define PARSE_INDEX_parametric 190
+#define PARSE_INDEX_path 191
+#define PARSE_INDEX_piekeypos 192
+#define PARSE_INDEX_pointlinewidth 193
+#define PARSE_INDEX_pointlist 194
+#define PARSE_INDEX_pointsize 195
+#define PARSE_INDEX_pointtype 196
+#define PARSE_INDEX_pos 197
+#define PARSE_INDEX_preamble 198
+#define PARSE_INDEX_preferred_unit 199
+#define PARSE_INDEX_preferred_units 200
+#define PARSE_INDEX_prefix 201
+#define PARSE_INDEX_quantity 202
+#define PARSE_INDEX_r 203
+#define PARSE_INDEX_range 204
+#define PARSE_INDEX_range_list 205
+#define PARSE_INDEX_ratio 206
+#define PARSE_INDEX_regex 207
+#define PARSE_INDEX_renormalise 208
+#define PARSE_INDEX_restofline 209
+#define PARSE_INDEX_return_value 210
+#define PARSE_INDEX_reverse 211
+#define PARSE_INDEX_right 212
+#define PARSE_INDEX_right_expression 213
+#define PARSE_INDEX_rotation 214
+#define PARSE_INDEX_samples 215
+#define PARSE_INDEX_samplesX 216
+#define PARSE_INDEX_samplesXauto 217
+#define PARSE_INDEX_samplesY 218
+#define PARSE_INDEX_samplesYauto 219
+#define PARSE_INDEX_scheme 220
+#define PARSE_INDEX_seed 221
+#define PARSE_INDEX_select_criterion 222
+#define PARSE_INDEX_semimajoraxis 223
+#define PARSE_INDEX_semiminoraxis 224
+#define PARSE_INDEX_set_option 225
+#define PARSE_INDEX_setting 226
+#define PARSE_INDEX_size 227
+#define PARSE_INDEX_slr 228
+#define PARSE_INDEX_smooth 229
+#define PARSE_INDEX_sort_expression 230
+#define PARSE_INDEX_spacing 231
+#define PARSE_INDEX_square 232
+#define PARSE_INDEX_start 233
+#define PARSE_INDEX_start_value 234
+#define PARSE_INDEX_step 235
+#define PARSE_INDEX_step_size 236
+#define PARSE_INDEX_string 237
+#define PARSE_INDEX_style 238
+#define PARSE_INDEX_style_number 239
+#define PARSE_INDEX_style_set_number 240
+#define PARSE_INDEX_subroutine_name 241
+#define PARSE_INDEX_subroutine_names 242
+#define PARSE_INDEX_term 243
+#define PARSE_INDEX_threads 244
+#define PARSE_INDEX_threedim 245
+#define PARSE_INDEX_timezone 246
+#define PARSE_INDEX_title 247
+#define PARSE_INDEX_tlog 248
+#define PARSE_INDEX_tmax 249
+#define PARSE_INDEX_tmin 250
+#define PARSE_INDEX_top 251
+#define PARSE_INDEX_topic 252
+#define PARSE_INDEX_trans 253
+#define PARSE_INDEX_ulog 254
+#define PARSE_INDEX_undeleteno 255
+#define PARSE_INDEX_unit 256
+#define PARSE_INDEX_unitstyle 257
+#define PARSE_INDEX_unpreferred_unit 258
+#define PARSE_INDEX_use_columns 259
+#define PARSE_INDEX_use_rows 260
+#define PARSE_INDEX_using_item 261
+#define PARSE_INDEX_using_list 262
+#define PARSE_INDEX_usingexp 263
+#define PARSE_INDEX_valign 264
+#define PARSE_INDEX_value 265
+#define PARSE_INDEX_var_name 266
+#define PARSE_INDEX_var_names 267
+#define PARSE_INDEX_variable 268
+#define PARSE_INDEX_variables 269
+#define PARSE_INDEX_varname 270
+#define PARSE_INDEX_varnames 271
+#define PARSE_INDEX_version 272
+#define PARSE_INDEX_viewer 273
+#define PARSE_INDEX_visible 274
+#define PARSE_INDEX_vlog 275
+#define PARSE_INDEX_vmax 276
+#define PARSE_INDEX_vmin 277
+#define PARSE_INDEX_width 278
+#define PARSE_INDEX_window 279
+#define PARSE_INDEX_withouterrors 280
+#define PARSE_INDEX_x 281
+#define PARSE_INDEX_x0 282
+#define PARSE_INDEX_x0_axis 283
+#define PARSE_INDEX_x0_system 284
+#define PARSE_INDEX_x1 285
+#define PARSE_INDEX_x1_axis 286
+#define PARSE_INDEX_x1_system 287
+#define PARSE_INDEX_x_axis 288
+#define PARSE_INDEX_x_system 289
+#define PARSE_INDEX_xorient 290
+#define PARSE_INDEX_xpos 291
+#define PARSE_INDEX_xy_angle 292
+#define PARSE_INDEX_y 293
+#define PARSE_INDEX_y0 294
+#define PARSE_INDEX_y0_axis 295
+#define PARSE_INDEX_y0_system 296
+#define PARSE_INDEX_y1 297
+#define PARSE_INDEX_y1_axis 298
+#define PARSE_INDEX_y1_system 299
+#define PARSE_INDEX_y_axis 300
+#define PARSE_INDEX_y_system 301
+#define PARSE_INDEX_yorient 302
+#define PARSE_INDEX_ypos 303
+#define PARSE_INDEX_yz_angle 304
+#define PARSE_INDEX_z 305
+#define PARSE_INDEX_z0 306
+#define PARSE_INDEX_z0_axis 307
+#define PARSE_INDEX_z0_system 308
+#define PARSE_INDEX_z1 309
+#define PARSE_INDEX_z1_axis 310
+#define PARSE_INDEX_z1_system 311
+#define PARSE_INDEX_z_axis 312
+#define PARSE_INDEX_z_system 313
+#define PARSE_INDEX_zorient 314
+#define PARSE_INDEX_zratio 315
+extern const int PARSE_TABLE_arc_[];
+extern const int PARSE_TABLE_arrow_[];
+extern const int PARSE_TABLE_assert_[];
+extern const int PARSE_TABLE_box_[];
+extern const int PARSE_TABLE_break_[];
+extern const int PARSE_TABLE_call_[];
+extern const int PARSE_TABLE_cd_[];
+extern const int PARSE_TABLE_circle_[];
+extern const int PARSE_TABLE_clear_[];
+extern const int PARSE_TABLE_continue_[];
+extern const int PARSE_TABLE_delete_[];
+extern const int PARSE_TABLE_do_[];
+extern const int PARSE_TABLE_ellipse_[];
+extern const int PARSE_TABLE_eps_[];
+extern const int PARSE_TABLE_exec_[];
+extern const int PARSE_TABLE_fit_[];
+extern const int PARSE_TABLE_for_[];
+extern const int PARSE_TABLE_foreach_[];
+extern const int PARSE_TABLE_foreachdatum_[];
+extern const int PARSE_TABLE_func_set_[];
+extern const int PARSE_TABLE_global_[];
+extern const int PARSE_TABLE_help_[];
+extern const int PARSE_TABLE_histogram_[];
+extern const int PARSE_TABLE_history_[];
+extern const int PARSE_TABLE_if_[];
+extern const int PARSE_TABLE_ifft_[];
+extern const int PARSE_TABLE_image_[];
+extern const int PARSE_TABLE_interpolate2d_[];
+extern const int PARSE_TABLE_list_[];
+extern const int PARSE_TABLE_load_[];
+extern const int PARSE_TABLE_local_[];
+extern const int PARSE_TABLE_maximise_[];
+extern const int PARSE_TABLE_minimise_[];
+extern const int PARSE_TABLE_move_[];
+extern const int PARSE_TABLE_piechart_[];
+extern const int PARSE_TABLE_pling_[];
+extern const int PARSE_TABLE_point_[];
+extern const int PARSE_TABLE_polygon_[];
+extern const int PARSE_TABLE_print_[];
+extern const int PARSE_TABLE_pwd_[];
+extern const int PARSE_TABLE_quit_[];
+extern const int PARSE_TABLE_refresh_[];
+extern const int PARSE_TABLE_replot_[];
+extern const int PARSE_TABLE_reset_[];
+extern const int PARSE_TABLE_return_[];
+extern const int PARSE_TABLE_save_[];
+extern const int PARSE_TABLE_set_arrow_[];
+extern const int PARSE_TABLE_set_autoscale_[];
+extern const int PARSE_TABLE_set_axescolor_[];
+extern const int PARSE_TABLE_set_axis_[];
+extern const int PARSE_TABLE_set_axisunitstyle_[];
+extern const int PARSE_TABLE_set_backup_[];
+extern const int PARSE_TABLE_set_bar_[];
+extern const int PARSE_TABLE_set_binorigin_[];
+extern const int PARSE_TABLE_set_binwidth_[];
+extern const int PARSE_TABLE_set_boxfrom_[];
+extern const int PARSE_TABLE_set_boxwidth_[];
+extern const int PARSE_TABLE_set_c1format_[];
+extern const int PARSE_TABLE_set_c1label_[];
+extern const int PARSE_TABLE_set_c1tics_[];
+extern const int PARSE_TABLE_set_calendar_[];
+extern const int PARSE_TABLE_set_clip_[];
+extern const int PARSE_TABLE_set_colkey_[];
+extern const int PARSE_TABLE_set_colmap_[];
+extern const int PARSE_TABLE_set_contours_[];
+extern const int PARSE_TABLE_set_crange_[];
+extern const int PARSE_TABLE_set_datacache_[];
+extern const int PARSE_TABLE_set_display_[];
+extern const int PARSE_TABLE_set_error_[];
+extern const int PARSE_TABLE_set_filter_[];
+extern const int PARSE_TABLE_set_fontsize_[];
+extern const int PARSE_TABLE_set_grid_[];
+extern const int PARSE_TABLE_set_gridmajcolor_[];
+extern const int PARSE_TABLE_set_gridmincolor_[];
+extern const int PARSE_TABLE_set_key_[];
+extern const int PARSE_TABLE_set_keycolumns_[];
+extern const int PARSE_TABLE_set_label_[];
+extern const int PARSE_TABLE_set_linewidth_[];
+extern const int PARSE_TABLE_set_logscale_[];
+extern const int PARSE_TABLE_set_multiplot_[];
+extern const int PARSE_TABLE_set_noarrow_[];
+extern const int PARSE_TABLE_set_noaxis_[];
+extern const int PARSE_TABLE_set_nobackup_[];
+extern const int PARSE_TABLE_set_noc1format_[];
+extern const int PARSE_TABLE_set_noc1label_[];
+extern const int PARSE_TABLE_set_noc1tics_[];
+extern const int PARSE_TABLE_set_noclip_[];
+extern const int PARSE_TABLE_set_nocolkey_[];
+extern const int PARSE_TABLE_set_nodisplay_[];
+extern const int PARSE_TABLE_set_nogrid_[];
+extern const int PARSE_TABLE_set_nokey_[];
+extern const int PARSE_TABLE_set_nolabel_[];
+extern const int PARSE_TABLE_set_nologscale_[];
+extern const int PARSE_TABLE_set_nomultiplot_[];
+extern const int PARSE_TABLE_set_nostyle_[];
+extern const int PARSE_TABLE_set_notics_[];
+extern const int PARSE_TABLE_set_notitle_[];
+extern const int PARSE_TABLE_set_noxformat_[];
+extern const int PARSE_TABLE_set_noxlabel_[];
+extern const int PARSE_TABLE_set_numerics_[];
+extern const int PARSE_TABLE_set_origin_[];
+extern const int PARSE_TABLE_set_output_[];
+extern const int PARSE_TABLE_set_palette_[];
+extern const int PARSE_TABLE_set_papersize_[];
+extern const int PARSE_TABLE_set_pointlinewidth_[];
+extern const int PARSE_TABLE_set_pointsize_[];
+extern const int PARSE_TABLE_set_preamble_[];
+extern const int PARSE_TABLE_set_range_[];
+extern const int PARSE_TABLE_set_samples_[];
+extern const int PARSE_TABLE_set_seed_[];
+extern const int PARSE_TABLE_set_size_[];
+extern const int PARSE_TABLE_set_style_numbered_[];
+extern const int PARSE_TABLE_set_terminal_[];
+extern const int PARSE_TABLE_set_textcolor_[];
+extern const int PARSE_TABLE_set_texthalign_[];
+extern const int PARSE_TABLE_set_textvalign_[];
+extern const int PARSE_TABLE_set_threads_[];
+extern const int PARSE_TABLE_set_tics_[];
+extern const int PARSE_TABLE_set_timezone_[];
+extern const int PARSE_TABLE_set_title_[];
+extern const int PARSE_TABLE_set_trange_[];
+extern const int PARSE_TABLE_set_unit_[];
+extern const int PARSE_TABLE_set_urange_[];
+extern const int PARSE_TABLE_set_view_[];
+extern const int PARSE_TABLE_set_viewer_[];
+extern const int PARSE_TABLE_set_vrange_[];
+extern const int PARSE_TABLE_set_width_[];
+extern const int PARSE_TABLE_set_xformat_[];
+extern const int PARSE_TABLE_set_xlabel_[];
+extern const int PARSE_TABLE_show_[];
+extern const int PARSE_TABLE_solve_[];
+extern const int PARSE_TABLE_subroutine_[];
+extern const int PARSE_TABLE_swap_[];
+extern const int PARSE_TABLE_tabulate_[];
+extern const int PARSE_TABLE_text_[];
+extern const int PARSE_TABLE_undelete_[];
+extern const int PARSE_TABLE_unset_arrow_[];
+extern const int PARSE_TABLE_unset_autoscale_[];
+extern const int PARSE_TABLE_unset_axescolor_[];
+extern const int PARSE_TABLE_unset_axis_[];
+extern const int PARSE_TABLE_unset_axisunitstyle_[];
+extern const int PARSE_TABLE_unset_backup_[];
+extern const int PARSE_TABLE_unset_bar_[];
+extern const int PARSE_TABLE_unset_binorigin_[];
+extern const int PARSE_TABLE_unset_binwidth_[];
+extern const int PARSE_TABLE_unset_boxfrom_[];
+extern const int PARSE_TABLE_unset_boxwidth_[];
+extern const int PARSE_TABLE_unset_c1format_[];
+extern const int PARSE_TABLE_unset_c1label_[];
+extern const int PARSE_TABLE_unset_c1tics_[];
+extern const int PARSE_TABLE_unset_calendar_[];
+extern const int PARSE_TABLE_unset_clip_[];
+extern const int PARSE_TABLE_unset_colkey_[];
+extern const int PARSE_TABLE_unset_colmap_[];
+extern const int PARSE_TABLE_unset_contours_[];
+extern const int PARSE_TABLE_unset_crange_[];
+extern const int PARSE_TABLE_unset_datacache_[];
+extern const int PARSE_TABLE_unset_display_[];
+extern const int PARSE_TABLE_unset_error_[];
+extern const int PARSE_TABLE_unset_filter_[];
+extern const int PARSE_TABLE_unset_fontsize_[];
+extern const int PARSE_TABLE_unset_grid_[];
+extern const int PARSE_TABLE_unset_gridmajcolor_[];
+extern const int PARSE_TABLE_unset_gridmincolor_[];
+extern const int PARSE_TABLE_unset_key_[];
+extern const int PARSE_TABLE_unset_keycolumns_[];
+extern const int PARSE_TABLE_unset_label_[];
+extern const int PARSE_TABLE_unset_linewidth_[];
+extern const int PARSE_TABLE_unset_logscale_[];
+extern const int PARSE_TABLE_unset_multiplot_[];
+extern const int PARSE_TABLE_unset_numerics_display_[];
+extern const int PARSE_TABLE_unset_origin_[];
+extern const int PARSE_TABLE_unset_output_[];
+extern const int PARSE_TABLE_unset_palette_[];
+extern const int PARSE_TABLE_unset_papersize_[];
+extern const int PARSE_TABLE_unset_pointlinewidth_[];
+extern const int PARSE_TABLE_unset_pointsize_[];
+extern const int PARSE_TABLE_unset_preamble_[];
+extern const int PARSE_TABLE_unset_range_[];
+extern const int PARSE_TABLE_unset_samples_[];
+extern const int PARSE_TABLE_unset_seed_[];
+extern const int PARSE_TABLE_unset_size_[];
+extern const int PARSE_TABLE_unset_style_[];
+extern const int PARSE_TABLE_unset_terminal_[];
+extern const int PARSE_TABLE_unset_textcolor_[];
+extern const int PARSE_TABLE_unset_texthalign_[];
+extern const int PARSE_TABLE_unset_textvalign_[];
+extern const int PARSE_TABLE_unset_threads_[];
+extern const int PARSE_TABLE_unset_tics_[];
+extern const int PARSE_TABLE_unset_title_[];
+extern const int PARSE_TABLE_unset_trange_[];
+extern const int PARSE_TABLE_unset_unit_preferred_[];
+extern const int PARSE_TABLE_unset_urange_[];
+extern const int PARSE_TABLE_unset_view_[];
+extern const int PARSE_TABLE_unset_viewer_[];
+extern const int PARSE_TABLE_unset_vrange_[];
+extern const int PARSE_TABLE_unset_width_[];
+extern const int PARSE_TABLE_unset_xformat_[];
+extern const int PARSE_TABLE_unset_xlabel_[];
+extern const int PARSE_TABLE_var_set_[];
+extern const int PARSE_TABLE_while_[];
+extern const int PARSE_TABLE_with_[];
+
+
+#endif
\ No newline at end of file
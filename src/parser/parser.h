@@ -69,6 +69,10 @@ typedef struct parserLine {
   int         containsMacros, refCount;
   parserAtom *firstAtom, *lastAtom;
   struct parserLine *next, *prev;
+  struct parserOutput *frame; // Output stack kept between executions of this line, to save reallocating it
+  int         frameBusy;
+  char       *macroTxt;       // If line contains macros, its most recent expansion, and the compiled form of that
+  struct parserLine *macroPl;
  } parserLine;
 
 typedef struct parserStatus {
@@ -103,8 +107,10 @@ void    ppl_parserStatReInit(parserStatus *in);
 void    ppl_parserStatAdd   (parserStatus *in, int level, parserLine *pl);
 void    ppl_parserStatFree  (parserStatus **in);
 void    ppl_parserLineInit  (parserLine **in, int srcLineN, long srcId, char *srcFname, char *line);
+char   *ppl_parserMacroExpand(ppl_context *c, char *line, int *failOut);
 int     ppl_parserCompile   (ppl_context *c, parserStatus *s, int srcLineN, long srcId, char *srcFname, char *line, int expandMacros, int blockDepth);
 void    ppl_parserLinePrint (ppl_context *c, parserLine *in);
+void    ppl_parserOutFree   (parserOutput *in);
 void    ppl_parserExecute   (ppl_context *c, parserLine *in, char *dirName, int interactive, int iterDepth);
 void    ppl_parserShell     (ppl_context *c, parserLine *pl, parserOutput *in, int interactive, int iterDepth);
 
@@ -0,0 +1,548 @@
+// parserCache.c
+//
+// The code in this file is part of Pyxplot
+// <http://www.pyxplot.org.uk>
+//
+// Copyright (C) 2006-2013 Dominic Ford <coders@pyxplot.org.uk>
+//               2008-2013 Ross Church
+//
+// $Id$
+//
+// Pyxplot is free software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation; either version 2 of the License, or (at your option) any later
+// version.
+//
+// You should have received a copy of the GNU General Public License along with
+// Pyxplot; if not, write to the Free Software Foundation, Inc., 51 Franklin
+// Street, Fifth Floor, Boston, MA  02110-1301, USA
+
+
+// ----------------------------------------------------------------------------
+
+// Writing and reading of caches of compiled command scripts, whose format is described in parserCache.h
+
+#define _PARSERCACHE_C 1
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "coreUtils/errorReport.h"
+#include "expressions/expCompile.h"
+#include "expressions/expCompile_fns.h"
+#include "parser/cmdList.h"
+#include "parser/parser.h"
+#include "parser/parserCache.h"
+#include "settings/settingTypes.h"
+#include "stringTools/strConstants.h"
+#include "userspace/context.h"
+#include "userspace/garbageCollector.h"
+#include "userspace/pplObj.h"
+#include "userspace/pplObj_fns.h"
+
+// Deepest nesting of code blocks which will be read from a cache file
+#define PARSERCACHE_MAXDEPTH 256
+
+// Continue an FNV-1a hash h over a further len bytes
+static uint64_t ppl_parserCacheHashMore(uint64_t h, const unsigned char *data, size_t len)
+ {
+  size_t i;
+  for (i=0; i<len; i++) { h ^= data[i]; h *= 1099511628211ULL; }
+  return h;
+ }
+
+// FNV-1a hash
+uint64_t ppl_parserCacheHash(const unsigned char *data, size_t len)
+ {
+  return ppl_parserCacheHashMore(14695981039346656037ULL, data, len);
+ }
+
+// The build signature. Cache files written by any other build of Pyxplot are ignored.
+static void ppl_parserCacheSignature(char *out)
+ {
+  sprintf(out, "Pyxplot %s %s; %d %d %d %d", VERSION, DATE, (int)sizeof(long), (int)sizeof(pplObj), (int)sizeof(pplExprBytecode), UNITS_MAX_BASEUNITS);
+ }
+
+void ppl_parserCacheRecordInit(parserCacheRecord *r, int iterDepth, long srcIdBase)
+ {
+  r->iterDepth = iterDepth;
+  r->failed    = 0;
+  r->N         = r->Nalloc = 0;
+  r->srcIdBase = srcIdBase;
+  r->units     = NULL;
+ }
+
+// Record that parserLine pl is about to be executed, together with the lines which follow it. A reference to the
+// chain which contains it is kept until the record is freed.
+void ppl_parserCacheRecordAdd(parserCacheRecord *r, int linenumber, parserLine *pl)
+ {
+  parserLine *head, *item;
+  int         Nlines;
+  if ((r->failed) || (pl==NULL)) return;
+  for (head=pl; head->prev!=NULL; head=head->prev);
+  for (item=pl, Nlines=0; item!=NULL; item=item->next) Nlines++;
+  if (r->N >= r->Nalloc)
+   {
+    long             Nnew = (r->Nalloc<64) ? 64 : (2*r->Nalloc);
+    parserCacheUnit *new  = (parserCacheUnit *)realloc(r->units, Nnew*sizeof(parserCacheUnit));
+    if (new==NULL) { r->failed=1; return; }
+    r->units  = new;
+    r->Nalloc = Nnew;
+   }
+  __sync_add_and_fetch(&head->refCount,1);
+  r->units[r->N].linenumber = linenumber;
+  r->units[r->N].Nlines     = Nlines;
+  r->units[r->N].pl         = pl;
+  r->units[r->N].head       = head;
+  r->N++;
+ }
+
+void ppl_parserCacheRecordFree(parserCacheRecord *r)
+ {
+  long i;
+  for (i=0; i<r->N; i++) ppl_parserLineFree(r->units[i].head);
+  if (r->units!=NULL) free(r->units);
+  r->units = NULL;
+  r->N = r->Nalloc = 0;
+ }
+
+// --------------------------------------------------------------------------------------------------------------------
+// Writing
+// --------------------------------------------------------------------------------------------------------------------
+
+typedef struct cacheWriter {
+  FILE    *f;
+  long     srcIdBase;
+  int      fail;
+  uint64_t checksum; // Hash of everything written so far, which is appended to the end of the file
+ } cacheWriter;
+
+static void cw_bytes(cacheWriter *w, const void *data, size_t n)
+ {
+  if ((!w->fail) && (n>0) && (fwrite(data, 1, n, w->f)!=n)) w->fail=1;
+  w->checksum = ppl_parserCacheHashMore(w->checksum, (const unsigned char *)data, n);
+ }
+
+static void cw_int (cacheWriter *w, int    x) { cw_bytes(w, &x, sizeof(int   )); }
+static void cw_long(cacheWriter *w, long   x) { cw_bytes(w, &x, sizeof(long  )); }
+static void cw_dbl (cacheWriter *w, double x) { cw_bytes(w, &x, sizeof(double)); }
+
+static void cw_str(cacheWriter *w, const char *s)
+ {
+  if (s==NULL) { cw_int(w, -1); return; }
+  cw_int(w, strlen(s));
+  cw_bytes(w, s, strlen(s));
+ }
+
+static void cw_lineChain(cacheWriter *w, parserLine *pl, int N);
+
+static void cw_expr(cacheWriter *w, pplExpr *e)
+ {
+  cw_str (w, e->ascii);
+  cw_str (w, e->srcFname);
+  cw_int (w, e->srcLineN);
+  cw_long(w, e->srcId - w->srcIdBase);
+  cw_int (w, e->bcLen);
+  cw_bytes(w, e->bytecode, e->bcLen);
+  cw_int (w, e->Nslots);
+ }
+
+static void cw_obj(cacheWriter *w, pplObj *o)
+ {
+  int i;
+  cw_int(w, o->objType);
+  switch (o->objType)
+   {
+    case PPLOBJ_NUM:
+    case PPLOBJ_COL:
+      cw_dbl(w, o->real);
+      cw_dbl(w, o->imag);
+      cw_int(w, o->dimensionless);
+      cw_int(w, o->flagComplex);
+      cw_int(w, o->tempType);
+      for (i=0; i<UNITS_MAX_BASEUNITS; i++) cw_dbl(w, o->exponent[i]);
+      break;
+    case PPLOBJ_STR:
+      cw_str(w, (char *)o->auxil);
+      break;
+    case PPLOBJ_EXP:
+      cw_expr(w, (pplExpr *)o->auxil);
+      break;
+    case PPLOBJ_BYT:
+      cw_lineChain(w, (parserLine *)o->auxil, -1);
+      break;
+    default:
+      w->fail=1; // Statement contains a literal which cannot be stored
+      break;
+   }
+ }
+
+// Write the first N lines of the chain which starts at pl, or the whole chain if N is negative
+static void cw_lineChain(cacheWriter *w, parserLine *pl, int N)
+ {
+  parserLine *item;
+  int         Nchain, i;
+  for (item=pl, Nchain=0; item!=NULL; item=item->next) Nchain++;
+  if (N<0) N=Nchain;
+  if (N>Nchain) { w->fail=1; return; } // Chain has been cut short since it was run
+  cw_int(w, N);
+  for (item=pl, i=0; i<N; item=item->next, i++)
+   {
+    parserAtom *a;
+    int         Natoms;
+    for (a=item->firstAtom, Natoms=0; a!=NULL; a=a->next) Natoms++;
+    cw_str (w, item->linetxt);
+    cw_str (w, item->srcFname);
+    cw_int (w, item->srcLineN);
+    cw_long(w, item->srcId - w->srcIdBase);
+    cw_int (w, item->stackLen);
+    cw_int (w, item->stackOffset);
+    cw_int (w, item->containsMacros);
+    cw_int (w, Natoms);
+    for (a=item->firstAtom; a!=NULL; a=a->next)
+     {
+      cw_int  (w, a->stackOutPos);
+      cw_int  (w, a->linePos);
+      cw_bytes(w, a->options, PARSER_TYPE_OPTIONS);
+      cw_int  (w, a->expr   !=NULL); if (a->expr   !=NULL) cw_expr(w, a->expr   );
+      cw_int  (w, a->literal!=NULL); if (a->literal!=NULL) cw_obj (w, a->literal);
+     }
+   }
+ }
+
+// Write the statements recorded in r to a cache file. The file is written under a temporary name, and then renamed,
+// so that a concurrent run of the same script never sees a partially-written file. Returns zero on success.
+int ppl_parserCacheSave(ppl_context *c, char *filename, uint64_t srcHash, long srcLen, parserCacheRecord *r)
+ {
+  cacheWriter w;
+  char        sig[FNAME_LENGTH], tmpname[FNAME_LENGTH];
+  uint64_t    grammarHash = ppl_parserCacheHash((const unsigned char *)ppl_cmdList, strlen(ppl_cmdList));
+  long        i;
+
+  if (r->failed) return 1;
+  if (snprintf(tmpname, FNAME_LENGTH, "%s.%d", filename, (int)getpid()) >= FNAME_LENGTH) return 1;
+  w.f = fopen(tmpname, "w");
+  if (w.f==NULL) return 1; // The script's directory may not be writable; this is not an error
+  w.srcIdBase = r->srcIdBase;
+  w.fail      = 0;
+  w.checksum  = ppl_parserCacheHash(NULL, 0);
+
+  ppl_parserCacheSignature(sig);
+  cw_bytes(&w, PARSERCACHE_MAGIC, PARSERCACHE_MAGICLEN);
+  cw_str  (&w, sig);
+  cw_bytes(&w, &grammarHash, sizeof(uint64_t));
+  cw_bytes(&w, &srcHash    , sizeof(uint64_t));
+  cw_long (&w, srcLen);
+  cw_long (&w, r->N);
+  for (i=0; (i<r->N)&&(!w.fail); i++)
+   {
+    cw_int      (&w, r->units[i].linenumber);
+    cw_lineChain(&w, r->units[i].pl, r->units[i].Nlines);
+   }
+  if ((!w.fail) && (fwrite(&w.checksum, 1, sizeof(uint64_t), w.f)!=sizeof(uint64_t))) w.fail=1;
+
+  if (fclose(w.f)!=0) w.fail=1;
+  if ((!w.fail) && (rename(tmpname, filename)!=0)) w.fail=1;
+  if (w.fail) { remove(tmpname); return 1; }
+  if (DEBUG) { sprintf(c->errcontext.tempErrStr, "Wrote %ld compiled statements to cache file '%s'.", r->N, filename); ppl_log(&c->errcontext, NULL); }
+  return 0;
+ }
+
+// --------------------------------------------------------------------------------------------------------------------
+// Reading
+// --------------------------------------------------------------------------------------------------------------------
+
+typedef struct cacheReader {
+  const unsigned char *p, *end;
+  int    fail;
+  long **srcIds; // Every source id read, which are offset to lie in a block of newly reserved ids once all are read
+  long   NsrcIds, NsrcIdsAlloc, maxSrcId;
+ } cacheReader;
+
+static void cr_bytes(cacheReader *r, void *out, size_t n)
+ {
+  if ((r->fail) || (n > (size_t)(r->end - r->p))) { r->fail=1; memset(out, 0, n); return; }
+  memcpy(out, r->p, n);
+  r->p += n;
+ }
+
+static int    cr_int (cacheReader *r) { int    x; cr_bytes(r, &x, sizeof(int   )); return x; }
+static long   cr_long(cacheReader *r) { long   x; cr_bytes(r, &x, sizeof(long  )); return x; }
+static double cr_dbl (cacheReader *r) { double x; cr_bytes(r, &x, sizeof(double)); return x; }
+
+// Returns a malloced string, or NULL. Sets r->fail if a string was expected but could not be read.
+static char *cr_str(cacheReader *r, int nullAllowed)
+ {
+  int   len = cr_int(r);
+  char *out;
+  if ((r->fail) || (len < -1) || (len > r->end - r->p)) { r->fail=1; return NULL; }
+  if (len<0) { if (!nullAllowed) r->fail=1; return NULL; }
+  out = (char *)malloc(len+1);
+  if (out==NULL) { r->fail=1; return NULL; }
+  memcpy(out, r->p, len);
+  out[len] = '\0';
+  r->p += len;
+  return out;
+ }
+
+static void cr_srcId(cacheReader *r, long *id)
+ {
+  *id = cr_long(r);
+  if ((r->fail) || (*id<0)) { *id=0; r->fail=1; return; }
+  if (*id > r->maxSrcId) r->maxSrcId = *id;
+  if (r->NsrcIds >= r->NsrcIdsAlloc)
+   {
+    long   Nnew = (r->NsrcIdsAlloc<256) ? 256 : (2*r->NsrcIdsAlloc);
+    long **new  = (long **)realloc(r->srcIds, Nnew*sizeof(long *));
+    if (new==NULL) { r->fail=1; return; }
+    r->srcIds       = new;
+    r->NsrcIdsAlloc = Nnew;
+   }
+  r->srcIds[r->NsrcIds++] = id;
+ }
+
+static parserLine *cr_lineChain(cacheReader *r, int depth);
+
+// Check that bytecode read from a cache file can be handed to ppl_expEval() without it reading outside the
+// bytecode or the expression's inline cache slots. Returns zero if it is safe.
+static int cr_checkBytecode(pplExpr *e)
+ {
+  const pplExprBytecode *in = (const pplExprBytecode *)e->bytecode;
+  const int              N  = e->bcLen / sizeof(pplExprBytecode);
+  unsigned char         *isStart;
+  int                    j, end=-1, bad=0;
+
+  if ((N<1) || (e->bcLen % sizeof(pplExprBytecode) != 0)) return 1;
+  if ((isStart = (unsigned char *)calloc(N, 1))==NULL) return 1;
+
+  // Walk the instructions in sequence, which must reach a return before running off the end
+  for (j=0; (j<N)&&(!bad)&&(end<0); j+=in[j].len)
+   {
+    const int o = in[j].opcode, len = in[j].len;
+    isStart[j] = 1;
+    if ((len<1) || (len > N-j) || (o<0) || (o>20)) bad=1;
+    else if ((o>=2) && (o<=6) && (memchr(&in[j+1], '\0', (len-1)*sizeof(pplExprBytecode))==NULL)) bad=1; // String operand must be terminated within the instruction
+    else if (((o==3)||(o==4)) && ((in[j].auxil.i<0) || (in[j].auxil.i>=e->Nslots))) bad=1; // Inline cache slot
+    else if (o==0) end=j;
+   }
+  if (end<0) bad=1;
+
+  // Branches must land on the start of an instruction
+  for (j=0; (j<=end)&&(!bad); j+=in[j].len)
+   {
+    const int o = in[j].opcode, to = in[j].auxil.i;
+    if ((o>=17) && (o<=19) && ((to<0) || (to>=N) || (!isStart[to]))) bad=1;
+   }
+
+  free(isStart);
+  return bad;
+ }
+
+static pplExpr *cr_expr(cacheReader *r)
+ {
+  pplExpr *e = (pplExpr *)malloc(sizeof(pplExpr));
+  if (e==NULL) { r->fail=1; return NULL; }
+  e->refCount = 1;
+  e->bytecode = NULL;
+  e->slots    = NULL;
+  e->Nslots   = 0;
+  e->ascii    = cr_str(r, 1);
+  e->srcFname = cr_str(r, 1);
+  e->srcLineN = cr_int(r);
+  cr_srcId(r, &e->srcId);
+  e->bcLen    = cr_int(r);
+  if ((!r->fail) && ((e->bcLen<0) || (e->bcLen > r->end - r->p))) r->fail=1;
+  if (!r->fail)
+   {
+    e->bytecode = malloc(e->bcLen);
+    if (e->bytecode==NULL) r->fail=1;
+    else                   cr_bytes(r, e->bytecode, e->bcLen);
+   }
+  e->Nslots = cr_int(r);
+  if ((!r->fail) && ((e->Nslots<0) || (e->Nslots>e->bcLen))) r->fail=1; // Every slot is referred to by the bytecode
+  if ((!r->fail) && (e->Nslots>0))
+   {
+    e->slots = (pplExprSlot *)calloc(e->Nslots, sizeof(pplExprSlot));
+    if (e->slots==NULL) r->fail=1;
+   }
+  else e->Nslots = 0;
+  if ((!r->fail) && cr_checkBytecode(e)) r->fail=1;
+  return e; // Caller frees with pplExpr_free() if r->fail is set
+ }
+
+// Read a literal object into out. Returns zero if out holds an object which needs to be garbage collected.
+static int cr_obj(cacheReader *r, pplObj *out, int depth)
+ {
+  int type = cr_int(r), i;
+  out->refCount = 1;
+  if (r->fail) return 1;
+  switch (type)
+   {
+    case PPLOBJ_NUM:
+    case PPLOBJ_COL:
+     {
+      double real = cr_dbl(r), imag = cr_dbl(r);
+      if (type==PPLOBJ_NUM) pplObjNum  (out, 0, real, imag);
+      else                  pplObjColor(out, 0, SW_COLSPACE_RGB, 0, 0, 0, 0);
+      out->real          = real;
+      out->imag          = imag;
+      out->dimensionless = cr_int(r);
+      out->flagComplex   = cr_int(r);
+      out->tempType      = cr_int(r);
+      for (i=0; i<UNITS_MAX_BASEUNITS; i++) out->exponent[i] = cr_dbl(r);
+      return r->fail;
+     }
+    case PPLOBJ_STR:
+     {
+      char *s = cr_str(r, 0);
+      if (s==NULL) return 1;
+      pplObjStr(out, 0, 1, s);
+      return 0;
+     }
+    case PPLOBJ_EXP:
+     {
+      pplExpr *e = cr_expr(r);
+      if (e==NULL) return 1;
+      pplObjExpression(out, 0, (void *)e);
+      return 0;
+     }
+    case PPLOBJ_BYT:
+      pplObjBytecode(out, 0, (void *)cr_lineChain(r, depth+1));
+      return 0;
+   }
+  r->fail=1;
+  return 1;
+ }
+
+static parserLine *cr_lineChain(cacheReader *r, int depth)
+ {
+  parserLine *first=NULL, *last=NULL;
+  int         N = cr_int(r), i;
+  if (depth > PARSERCACHE_MAXDEPTH) r->fail=1;
+  for (i=0; (i<N)&&(!r->fail); i++)
+   {
+    parserLine *pl=NULL;
+    char       *linetxt  = cr_str(r, 0);
+    char       *srcFname = cr_str(r, 0);
+    int         Natoms, j;
+    if (!r->fail) ppl_parserLineInit(&pl, 0, 0, srcFname, linetxt);
+    if (linetxt !=NULL) free(linetxt);
+    if (srcFname!=NULL) free(srcFname);
+    if (pl==NULL) { r->fail=1; break; }
+    if (last==NULL) first=pl;
+    else            { last->next=pl; pl->prev=last; }
+    last = pl;
+
+    pl->srcLineN       = cr_int(r);
+    cr_srcId(r, &pl->srcId);
+    pl->stackLen       = cr_int(r);
+    pl->stackOffset    = cr_int(r);
+    pl->containsMacros = cr_int(r);
+    Natoms             = cr_int(r);
+    if ((!r->fail) && (pl->stackLen<0)) r->fail=1;
+    for (j=0; (j<Natoms)&&(!r->fail); j++)
+     {
+      int      stackOutPos = cr_int(r);
+      int      linePos     = cr_int(r);
+      char     options[PARSER_TYPE_OPTIONS];
+      pplExpr *expr = NULL;
+      pplObj   val, *literal = NULL;
+      parserAtom *prevLast = pl->lastAtom;
+      cr_bytes(r, options, PARSER_TYPE_OPTIONS);
+      options[PARSER_TYPE_OPTIONS-1] = '\0';
+      if (cr_int(r)) expr = cr_expr(r);
+      if ((cr_int(r)) && (!r->fail))
+       {
+        if (cr_obj(r, &val, depth)==0) literal = &val;
+       }
+      if ((!r->fail) && ((stackOutPos<0) || (stackOutPos>=pl->stackLen))) r->fail=1;
+      if (r->fail)
+       {
+        if (expr   !=NULL) pplExpr_free(expr);
+        if (literal!=NULL) ppl_garbageObject(literal);
+        break;
+       }
+      ppl_parserAtomAdd(pl, stackOutPos, linePos, options, expr, literal);
+      if (pl->lastAtom==prevLast) // Out of memory
+       {
+        if (expr   !=NULL) pplExpr_free(expr);
+        if (literal!=NULL) ppl_garbageObject(literal);
+        r->fail=1;
+       }
+     }
+   }
+  if (r->fail) { ppl_parserLineFree(first); return NULL; }
+  return first;
+ }
+
+// Read the statements of a script from a cache file into r, provided that the file was written by this build of
+// Pyxplot, and from a script with the given text. Returns zero on success.
+int ppl_parserCacheLoad(ppl_context *c, char *filename, uint64_t srcHash, long srcLen, parserCacheRecord *r, int iterDepth)
+ {
+  FILE          *f;
+  unsigned char *data;
+  long           len, N, i;
+  cacheReader    rd;
+  char           sig[FNAME_LENGTH], *sigFile;
+  uint64_t       grammarHash = ppl_parserCacheHash((const unsigned char *)ppl_cmdList, strlen(ppl_cmdList));
+  uint64_t       h1, h2, checksum;
+
+  ppl_parserCacheRecordInit(r, iterDepth, 0);
+  if ((f = fopen(filename, "r"))==NULL) return 1;
+  if ((fseek(f, 0, SEEK_END)!=0) || ((len = ftell(f))<=PARSERCACHE_MAGICLEN) || (fseek(f, 0, SEEK_SET)!=0)) { fclose(f); return 1; }
+  data = (unsigned char *)malloc(len);
+  if (data==NULL) { fclose(f); return 1; }
+  if (fread(data, 1, len, f)!=(size_t)len) { fclose(f); free(data); return 1; }
+  fclose(f);
+
+  // Check that the file has not been truncated or corrupted before decoding any of it
+  if (len < PARSERCACHE_MAGICLEN+(long)sizeof(uint64_t)) { free(data); return 1; }
+  len -= sizeof(uint64_t);
+  memcpy(&checksum, data+len, sizeof(uint64_t));
+  if (checksum != ppl_parserCacheHash(data, len)) { free(data); return 1; }
+
+  rd.p = data; rd.end = data+len; rd.fail = 0;
+  rd.srcIds = NULL; rd.NsrcIds = rd.NsrcIdsAlloc = rd.maxSrcId = 0;
+
+  // Check that the file is for this build of Pyxplot, and for this version of the script
+  ppl_parserCacheSignature(sig);
+  if (memcmp(data, PARSERCACHE_MAGIC, PARSERCACHE_MAGICLEN)!=0) rd.fail=1;
+  rd.p += PARSERCACHE_MAGICLEN;
+  sigFile = cr_str(&rd, 0);
+  if ((sigFile==NULL) || (strcmp(sig, sigFile)!=0)) rd.fail=1;
+  if (sigFile!=NULL) free(sigFile);
+  cr_bytes(&rd, &h1, sizeof(uint64_t));
+  cr_bytes(&rd, &h2, sizeof(uint64_t));
+  if ((h1!=grammarHash) || (h2!=srcHash) || (cr_long(&rd)!=srcLen)) rd.fail=1;
+  N = cr_long(&rd);
+  if (N<0) rd.fail=1;
+
+  // Read statements
+  for (i=0; (i<N)&&(!rd.fail); i++)
+   {
+    int         linenumber = cr_int(&rd);
+    parserLine *pl         = cr_lineChain(&rd, 0);
+    if (rd.fail) break;
+    ppl_parserCacheRecordAdd(r, linenumber, pl);
+    ppl_parserLineFree(pl); // The record now holds the only reference
+    if (r->failed) rd.fail=1;
+   }
+  if ((!rd.fail) && (rd.p!=rd.end)) rd.fail=1;
+
+  // Give the lines which were read source ids of their own
+  if (!rd.fail)
+   {
+    long base = ppl_error_reserveSourceIds(rd.maxSrcId+1);
+    for (i=0; i<rd.NsrcIds; i++) *rd.srcIds[i] += base;
+    r->srcIdBase = base;
+   }
+
+  if (rd.srcIds!=NULL) free(rd.srcIds);
+  free(data);
+  if (rd.fail) { ppl_parserCacheRecordFree(r); return 1; }
+  if (DEBUG) { sprintf(c->errcontext.tempErrStr, "Read %ld compiled statements from cache file '%s'.", r->N, filename); ppl_log(&c->errcontext, NULL); }
+  return 0;
+ }
@@ -0,0 +1,70 @@
+// parserCache.h
+//
+// The code in this file is part of Pyxplot
+// <http://www.pyxplot.org.uk>
+//
+// Copyright (C) 2006-2013 Dominic Ford <coders@pyxplot.org.uk>
+//               2008-2013 Ross Church
+//
+// $Id$
+//
+// Pyxplot is free software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation; either version 2 of the License, or (at your option) any later
+// version.
+//
+// You should have received a copy of the GNU General Public License along with
+// Pyxplot; if not, write to the Free Software Foundation, Inc., 51 Franklin
+// Street, Fifth Floor, Boston, MA  02110-1301, USA
+
+
+// ----------------------------------------------------------------------------
+
+// Caches of compiled command scripts. When Pyxplot is run with the -b switch, the compiled form of each statement
+// of a script is written to a file alongside it, whose name is that of the script with "c" appended, so that later
+// runs of the same script need not parse it again. The file contains:
+//
+// magic[8] = "PYXPLC2\n", the build signature string, a hash of the command grammar, the length and a hash of the
+// script's text, the number of statements, and then for each statement, the line number at which it was executed and
+// the chain of parserLines which was executed, i.e. the parserLine and those which followed it when it was run. The file ends with a hash of everything before it, so that a file
+// which has been truncated or corrupted is ignored before any of it is decoded.
+//
+// Values are stored in the native byte order and sizes, since the build signature ties each file to a single build
+// of Pyxplot. A file whose signature or hashes do not match is ignored, and rewritten.
+
+#ifndef _PARSERCACHE_H
+#define _PARSERCACHE_H 1
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "parser/parser.h"
+#include "userspace/context.h"
+
+#define PARSERCACHE_MAGIC    "PYXPLC2\n"
+#define PARSERCACHE_MAGICLEN 8
+
+// A statement of a script, as it was compiled and executed. pl may lie part of the way along a chain of parserLines;
+// the record holds a reference to the first line of the chain, head, which keeps it in memory.
+typedef struct parserCacheUnit {
+  int         linenumber, Nlines;
+  parserLine *pl, *head;
+ } parserCacheUnit;
+
+// The statements of a script, recorded at recursion depth iterDepth as they are executed
+typedef struct parserCacheRecord {
+  int              iterDepth, failed;
+  long             N, Nalloc;
+  long             srcIdBase;
+  parserCacheUnit *units;
+ } parserCacheRecord;
+
+uint64_t      ppl_parserCacheHash      (const unsigned char *data, size_t len);
+void          ppl_parserCacheRecordInit(parserCacheRecord *r, int iterDepth, long srcIdBase);
+void          ppl_parserCacheRecordAdd (parserCacheRecord *r, int linenumber, parserLine *pl);
+void          ppl_parserCacheRecordFree(parserCacheRecord *r);
+int           ppl_parserCacheSave      (ppl_context *c, char *filename, uint64_t srcHash, long srcLen, parserCacheRecord *r);
+int           ppl_parserCacheLoad      (ppl_context *c, char *filename, uint64_t srcHash, long srcLen, parserCacheRecord *r, int iterDepth);
+
+#endif
+
@@ -972,6 +972,10 @@ void ppl_parserLineInit(parserLine **in, int srcLineN, long srcId, char *srcFnam
   output->prev           = NULL;
   output->containsMacros = 0;
   output->refCount       = 1;
+  output->frame          = NULL;
+  output->frameBusy      = 0;
+  output->macroTxt       = NULL;
+  output->macroPl        = NULL;
   output->srcLineN       = srcLineN;
   output->srcId          = srcId;
   output->stackLen       = 16;
@@ -990,6 +994,9 @@ void ppl_parserLineFree(parserLine *in)
    {
     parserLine *next = item->next;
     ppl_parserAtomFree(&item->firstAtom);
+    ppl_parserOutFree(item->frame);
+    ppl_parserLineFree(item->macroPl);
+    if (item->macroTxt!=NULL) free(item->macroTxt);
     if (item->linetxt !=NULL) free(item->linetxt);
     if (item->srcFname!=NULL) free(item->srcFname);
     free(item);
@@ -1024,8 +1031,120 @@ void ppl_parserLineFree(parserLine *in)
   else if ((quoteChar=='\0') && (line[i]=='@')) { containsMacros=1; break; } \
   LOOP_END(0)
 
+// Substitute for any macros and ` ` expressions in line. Returns either line itself, if it contains none, or a
+// malloced copy of the expanded line, which the caller must free. On failure, *failOut is set, and the returned line is
+// the one in which substitution failed.
+char *ppl_parserMacroExpand(ppl_context *c, char *line, int *failOut)
+ {
+  char *lineOriginal = line;
+  char *outbuff = NULL;
+  int   obLen = LSTR_LENGTH, obPos;
+  int   l=0, containsMacros=0, fail=0;
+  for (l=0; (l<16)&&!fail; l++) // Repeatedly test for and substitute macros; nested macros are allowed
+   {
+    TEST_FOR_MACROS;
+    if (fail || !containsMacros) break;
+     {
+      outbuff = (char *)malloc(obLen);
+      obPos   = 0;
+      if (outbuff!=NULL) LOOP_OVER_LINE
+
+      // First, substitute for ` ` expressions
+      else if ((quoteChar=='\0') && (line[i]=='`'))
+       {
+        int   is=++i, status;
+        char *key=NULL;
+        FILE *substPipe;
+        for ( ; ((line[i]!='\0')&&(line[i]!='`')) ; i++); // Find end of ` ` expression
+        if (line[i]!='`') { sprintf(c->errStat.errBuff, "Mismatched `"); fail=1; break; }
+        key = (char *)malloc(i-is+1); // Put macro name into a string
+        if (key==NULL) { sprintf(c->errStat.errBuff,"Out of memory."); fail=1; break; }
+        strncpy(key, line+is, i-is);
+        key[i-is]='\0';
+        if (DEBUG) { sprintf(c->errcontext.tempErrStr, "Shell substitution with command '%s'.", key); ppl_log(&c->errcontext,NULL); }
+        if ((substPipe = popen(key,"r"))==NULL)
+         {
+          sprintf(c->errStat.errBuff, "Could not spawl shell substitution command '%s'.", key);
+          fail=1; goto shellSubstErr;
+         }
+        while ((!feof(substPipe)) && (!ferror(substPipe)))
+         {
+          if (fscanf(substPipe,"%c",outbuff+obPos) == EOF) break;
+          if (outbuff[obPos]=='\n') outbuff[obPos] = ' ';
+          if (outbuff[obPos]!='\0') obPos++;
+          if (obPos > obLen-16) { obLen += LSTR_LENGTH; outbuff = (char *)realloc(outbuff, obLen); if (outbuff==NULL) { sprintf(c->errStat.errBuff, "Out of memory."); fail=1; break; } } \
+         }
+        status = pclose(substPipe);
+        if (fail) goto shellSubstErr;
+
+        if (WIFEXITED(status))
+         {
+          int ec = WEXITSTATUS(status);
+          if (ec) { sprintf(c->errStat.errBuff, "Command failure during ` ` substitution (exit code %d).", ec); fail=1; goto shellSubstErr; }
+         }
+        else if (WIFSIGNALED(status))
+         {
+          sprintf(c->errStat.errBuff, "Command failure during ` ` substitution (terminated by signal %d).", WTERMSIG(status)); fail=1; goto shellSubstErr;
+         }
+        else
+         {
+          sprintf(c->errStat.errBuff, "Command failure during ` ` substitution (fail happened)."); fail=1; goto shellSubstErr;
+         }
+
+shellSubstErr:
+        if (key!=NULL) free(key);
+        if (fail) break;
+       }
+
+      // Second, substitute for macros
+      else if ((quoteChar=='\0') && (line[i]=='@'))
+       {
+        int   is=++i, j, got=0;
+        char *key=NULL;
+        for ( ; (isalnum(line[i])||(line[i]=='_')) ; i++); // Find end of macro name
+        key = (char *)malloc(i-is+1); // Put macro name into a string
+        if (key==NULL) { sprintf(c->errStat.errBuff,"Out of memory."); fail=1; break; }
+        strncpy(key, line+is, i-is);
+        key[i-is]='\0';
+        for (j=1; j>=0 ; j--)
+         {
+          pplObj *obj = (pplObj *)ppl_dictLookup(c->namespaces[j] , key);
+          if (obj==NULL) continue;
+          if ((obj->objType==PPLOBJ_GLOB)||(obj->objType==PPLOBJ_ZOM)) continue;
+          if (obj->objType!=PPLOBJ_STR)
+           {
+            sprintf(c->errStat.errBuff,"Attempt to expand a macro, \"%s\", which is not a string variable.", key);
+            got=-1;
+            break;
+           }
+          if (obPos+strlen((char *)obj->auxil) > obLen-16) { obLen+=strlen((char *)obj->auxil) + LSTR_LENGTH; outbuff = (char *)realloc(outbuff, obLen); if (outbuff==NULL) { got=-2; break; } }
+          strcpy(outbuff+obPos,(char *)obj->auxil);
+          obPos += strlen(outbuff+obPos);
+          got=1;
+          break;
+         }
+        if (got==0) { sprintf(c->errStat.errBuff,"Undefined macro, \"%s\".",key); }
+        free(key);
+        if (got<=0) { fail=1; break; }
+        i--;
+       }
+      LOOP_END(1);
+      outbuff[obPos++]='\0';
+
+      // Clean up after macro substitution
+      if ((!fail)&&(outbuff!=NULL)) { if (line!=lineOriginal) free(line); line = outbuff; }
+      else if (outbuff!=NULL) { free(outbuff); outbuff=NULL; }
+     }
+   }
+  *failOut = fail;
+  return line;
+ }
+
+// If expandMacros is zero, lines containing macros are stored uncompiled, to be expanded when they are executed. If it
+// is positive, macros are expanded now. If it is negative, line has already been expanded and is compiled as it stands.
 int ppl_parserCompile(ppl_context *c, parserStatus *s, int srcLineN, long srcId, char *srcFname, char *line, int expandMacros, int blockDepth)
  {
+  char         *lineOriginal = line;
   listIterator *cmdIter=NULL;
   int           i, cln, containsMacros=0;
   int           obLen = LSTR_LENGTH, obPos;
@@ -1035,7 +1154,7 @@ int ppl_parserCompile(ppl_context *c, parserStatus *s, int srcLineN, long srcId,
   if (blockDepth > MAX_RECURSION_DEPTH) { strcpy(c->errStat.errBuff,"Maximum recursion depth exceeded."); PARSE_TBADD(ERR_OVERFLOW,0,line); ppl_parserStatReInit(s); return 1; }
 
   // Deal with macros and ` ` substitutions
-  if (!expandMacros)
+  if (expandMacros==0)
    {
     int fail=0;
     TEST_FOR_MACROS;
@@ -1061,107 +1180,12 @@ int ppl_parserCompile(ppl_context *c, parserStatus *s, int srcLineN, long srcId,
       return 0;
      }
    }
-  else
+  else if (expandMacros>0)
    {
-    char *lineOriginal = line;
-    int   l=0, fail=0;;
-    for (l=0; (l<16)&&!fail; l++) // Repeatedly test for and substitute macros; nested macros are allowed
-     {
-      TEST_FOR_MACROS;
-      if (fail || !containsMacros) break;
-       {
-        outbuff = (char *)malloc(obLen);
-        obPos   = 0;
-        if (outbuff!=NULL) LOOP_OVER_LINE
-
-        // First, substitute for ` ` expressions
-        else if ((quoteChar=='\0') && (line[i]=='`'))
-         {
-          int   is=++i, status;
-          char *key=NULL;
-          FILE *substPipe;
-          for ( ; ((line[i]!='\0')&&(line[i]!='`')) ; i++); // Find end of ` ` expression
-          if (line[i]!='`') { sprintf(c->errStat.errBuff, "Mismatched `"); fail=1; break; }
-          key = (char *)malloc(i-is+1); // Put macro name into a string
-          if (key==NULL) { sprintf(c->errStat.errBuff,"Out of memory."); fail=1; break; }
-          strncpy(key, line+is, i-is);
-          key[i-is]='\0';
-          if (DEBUG) { sprintf(c->errcontext.tempErrStr, "Shell substitution with command '%s'.", key); ppl_log(&c->errcontext,NULL); }
-          if ((substPipe = popen(key,"r"))==NULL)
-           {
-            sprintf(c->errStat.errBuff, "Could not spawl shell substitution command '%s'.", key);
-            fail=1; goto shellSubstErr;
-           }
-          while ((!feof(substPipe)) && (!ferror(substPipe)))
-           {
-            if (fscanf(substPipe,"%c",outbuff+obPos) == EOF) break;
-            if (outbuff[obPos]=='\n') outbuff[obPos] = ' ';
-            if (outbuff[obPos]!='\0') obPos++;
-            if (obPos > obLen-16) { obLen += LSTR_LENGTH; outbuff = (char *)realloc(outbuff, obLen); if (outbuff==NULL) { sprintf(c->errStat.errBuff, "Out of memory."); fail=1; break; } } \
-           }
-          status = pclose(substPipe);
-          if (fail) goto shellSubstErr;
-
-          if (WIFEXITED(status))
-           {
-            int ec = WEXITSTATUS(status);
-            if (ec) { sprintf(c->errStat.errBuff, "Command failure during ` ` substitution (exit code %d).", ec); fail=1; goto shellSubstErr; }
-           }
-          else if (WIFSIGNALED(status))
-           {
-            sprintf(c->errStat.errBuff, "Command failure during ` ` substitution (terminated by signal %d).", WTERMSIG(status)); fail=1; goto shellSubstErr;
-           }
-          else
-           {
-            sprintf(c->errStat.errBuff, "Command failure during ` ` substitution (fail happened)."); fail=1; goto shellSubstErr;
-           }
-
-  shellSubstErr:
-          if (key!=NULL) free(key);
-          if (fail) break;
-         }
-
-        // Second, substitute for macros
-        else if ((quoteChar=='\0') && (line[i]=='@'))
-         {
-          int   is=++i, j, got=0;
-          char *key=NULL;
-          for ( ; (isalnum(line[i])||(line[i]=='_')) ; i++); // Find end of macro name
-          key = (char *)malloc(i-is+1); // Put macro name into a string
-          if (key==NULL) { sprintf(c->errStat.errBuff,"Out of memory."); fail=1; break; }
-          strncpy(key, line+is, i-is);
-          key[i-is]='\0';
-          for (j=1; j>=0 ; j--)
-           {
-            pplObj *obj = (pplObj *)ppl_dictLookup(c->namespaces[j] , key);
-            if (obj==NULL) continue;
-            if ((obj->objType==PPLOBJ_GLOB)||(obj->objType==PPLOBJ_ZOM)) continue;
-            if (obj->objType!=PPLOBJ_STR)
-             {
-              sprintf(c->errStat.errBuff,"Attempt to expand a macro, \"%s\", which is not a string variable.", key);
-              got=-1;
-              break;
-             }
-            if (obPos+strlen((char *)obj->auxil) > obLen-16) { obLen+=strlen((char *)obj->auxil) + LSTR_LENGTH; outbuff = (char *)realloc(outbuff, obLen); if (outbuff==NULL) { got=-2; break; } }
-            strcpy(outbuff+obPos,(char *)obj->auxil);
-            obPos += strlen(outbuff+obPos);
-            got=1;
-            break;
-           }
-          if (got==0) { sprintf(c->errStat.errBuff,"Undefined macro, \"%s\".",key); }
-          free(key);
-          if (got<=0) { fail=1; break; }
-          i--;
-         }
-        LOOP_END(1);
-        outbuff[obPos++]='\0';
-
-        // Clean up after macro substitution
-        if ((!fail)&&(outbuff!=NULL)) { if (line!=lineOriginal) free(line); line = outbuff; }
-        else if (outbuff!=NULL) { free(outbuff); outbuff=NULL; }
-       }
-     }
-    if (fail) { PARSE_TBADD(ERR_SYNTAX,0,line); ppl_parserStatReInit(s); return 1; }
+    int fail=0;
+    line = ppl_parserMacroExpand(c, line, &fail);
+    if (line!=lineOriginal) outbuff=line;
+    if (fail) { PARSE_TBADD(ERR_SYNTAX,0,line); if (outbuff!=NULL) free(outbuff); ppl_parserStatReInit(s); return 1; }
    }
 
   // If we are returning to add more code into a codeblock, do that now
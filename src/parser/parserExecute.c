@@ -93,6 +93,45 @@ void ppl_parserOutFree(parserOutput *in)
   return;
  }
 
+// Fetch an output stack for executing line <in>. The stack kept from the line's previous execution is reused if no
+// other execution of the same line, e.g. by a recursive subroutine call, is currently using it.
+static parserOutput *ppl_parserFrameGet(ppl_context *c, parserLine *in)
+ {
+  int           i;
+  parserOutput *out;
+  c->execLines++;
+  if ((in->frame!=NULL) && (__sync_lock_test_and_set(&in->frameBusy,1)==0)) return in->frame;
+
+  c->execFrameAllocs++;
+  out = (parserOutput *)malloc(sizeof(parserOutput));
+  if (out==NULL) return NULL;
+  out->stk = (pplObj *)malloc(in->stackLen*sizeof(pplObj));
+  if (out->stk==NULL) { free(out); return NULL; }
+  for (i=0; i<in->stackLen; i++) { out->stk[i].refCount=1; pplObjZom(&out->stk[i],0); }
+  out->stkCharPos = (int *)malloc(in->stackLen*sizeof(int));
+  if (out->stkCharPos==NULL) { free(out->stk); free(out); return NULL; }
+  for (i=0; i<in->stackLen; i++) { out->stkCharPos[i]=-1; }
+  out->stackLen   = in->stackLen;
+  return out;
+ }
+
+// Finish with an output stack fetched by ppl_parserFrameGet(). It is cleared and kept for the line's next execution,
+// unless the line already has one.
+static void ppl_parserFrameRelease(parserLine *in, parserOutput *out)
+ {
+  int i;
+  if (out==NULL) return;
+  for (i=0; i<out->stackLen; i++)
+   {
+    ppl_garbageObject(&out->stk[i]);
+    out->stk[i].refCount=1;
+    pplObjZom(&out->stk[i],0);
+    out->stkCharPos[i]=-1;
+   }
+  if      (out==in->frame)                                        __sync_lock_release(&in->frameBusy);
+  else if (!__sync_bool_compare_and_swap(&in->frame,NULL,out))    ppl_parserOutFree(out);
+ }
+
 #define STACK_POP \
    { \
     c->stackPtr--; \
@@ -104,7 +143,6 @@ void ppl_parserOutFree(parserOutput *in)
 
 void ppl_parserExecute(ppl_context *c, parserLine *in, char *dirName, int interactive, int iterDepth)
  {
-  int           i;
   const int     stkLevelOld = c->stackPtr;
   parserOutput *out  = NULL;
   pplObj       *stk  = NULL;
@@ -123,35 +161,56 @@ void ppl_parserExecute(ppl_context *c, parserLine *in, char *dirName, int intera
 
     //ppl_parserLinePrint(c,in);
 
-    // If line contains macros, need to recompile it now
+    // If line contains macros, need to expand them now. The line is only recompiled if its expansion has changed.
     if (in->containsMacros)
      {
-      int stat=0;
+      int stat=0, fail=0;
       parserStatus *ps = NULL;
-      parserLine   *pl = NULL;
-      ppl_parserStatInit(&ps,&pl);
-      if (ps==NULL) { strcpy(eB,"Out of memory."); TBADD(ERR_MEMORY,0); return; }
-      stat = ppl_parserCompile(c, ps, in->srcLineN, in->srcId, in->srcFname, in->linetxt, 1, iterDepth+1);
-      if (stat || c->errStat.status) break;
-      ppl_parserExecute(c, ps->pl[iterDepth+1], dirName, interactive, iterDepth+1);
-      ppl_parserLineFree(ps->pl[iterDepth+1]);
-      ppl_parserStatFree(&ps);
+      parserLine   *pl = NULL, *root = NULL;
+      char         *expanded = ppl_parserMacroExpand(c, in->linetxt, &fail);
+      if (fail) { ppl_tbAdd(c,in->srcLineN,in->srcId,in->srcFname,1,ERR_SYNTAX,0,expanded,""); if (expanded!=in->linetxt) free(expanded); break; }
+      if ((!c->macroCacheOff) && (in->macroPl!=NULL) && (strcmp(in->macroTxt,expanded)==0))
+       {
+        pl = in->macroPl;
+        __sync_add_and_fetch(&pl->refCount,1);
+       }
+      else
+       {
+        ppl_parserStatInit(&ps,&root);
+        if (ps==NULL) { if (expanded!=in->linetxt) free(expanded); strcpy(eB,"Out of memory."); TBADD(ERR_MEMORY,0); return; }
+        stat = ppl_parserCompile(c, ps, in->srcLineN, in->srcId, in->srcFname, expanded, -1, iterDepth+1); // Already expanded
+        if (stat || c->errStat.status) { if (expanded!=in->linetxt) free(expanded); ppl_parserStatFree(&ps); break; }
+        pl = ps->pl[iterDepth+1];
+        ppl_parserStatFree(&ps);
+
+        // Keep compiled line, replacing whichever was kept previously
+        if (!c->macroCacheOff)
+         {
+          char *txt = (char *)malloc(strlen(expanded)+1);
+          if (txt!=NULL)
+           {
+            parserLine *old = in->macroPl;
+            strcpy(txt, expanded);
+            if (in->macroTxt!=NULL) free(in->macroTxt);
+            __sync_add_and_fetch(&pl->refCount,1);
+            in->macroTxt = txt;
+            in->macroPl  = pl;
+            ppl_parserLineFree(old);
+           }
+         }
+       }
+      if (expanded!=in->linetxt) free(expanded);
+      ppl_parserExecute(c, pl, dirName, interactive, iterDepth+1);
+      ppl_parserLineFree(pl);
       in = in->next;
       continue;
      }
 
     // Initialise output stack
-    out = (parserOutput *)malloc(sizeof(parserOutput));
+    out = ppl_parserFrameGet(c, in);
     if (out==NULL) { strcpy(eB,"Out of memory."); TBADD(ERR_MEMORY,0); return; }
-    stk = (pplObj *)malloc(in->stackLen*sizeof(pplObj));
-    if (stk==NULL) { free(out); strcpy(eB,"Out of memory."); TBADD(ERR_MEMORY,0); return; }
-    for (i=0; i<in->stackLen; i++) { stk[i].refCount=1; pplObjZom(&stk[i],0); }
-    stkCharPos = (int *)malloc(in->stackLen*sizeof(int));
-    if (stkCharPos==NULL) { free(out); free(stk); strcpy(eB,"Out of memory."); TBADD(ERR_MEMORY,0); return; }
-    for (i=0; i<in->stackLen; i++) { stkCharPos[i]=-1; }
-    out->stk        = stk;
-    out->stkCharPos = stkCharPos;
-    out->stackLen   = in->stackLen;
+    stk        = out->stk;
+    stkCharPos = out->stkCharPos;
 
     // Loop over atoms
     while (item != NULL)
@@ -352,9 +411,9 @@ gotTypeCexpression:
       else { ppl_parserShell(c, in, out, interactive, iterDepth); }
      }
 
-    // Free output stack
+    // Clear output stack, ready for the line's next execution
     STACK_CLEAN;
-    ppl_parserOutFree(out);
+    ppl_parserFrameRelease(in, out);
 
     in = in->next;
    }
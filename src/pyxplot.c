@@ -63,15 +63,45 @@
 
 #include "pyxplot.h"
 #include "readConf.h"
+#include "server.h"
 
 // SIGINT Handling information
 
 sigjmp_buf ppl_sigjmpToMain;
 sigjmp_buf *ppl_sigjmpFromSigInt = NULL;
 
+// Timings of the phases of startup, which are reported if the --profile-startup switch is given
+
+#define STARTUP_PHASES_MAX 24
+static int         startupProfile = 0;
+static int         startupNPhases = 0;
+static const char *startupPhaseName[STARTUP_PHASES_MAX];
+static double      startupPhaseTime[STARTUP_PHASES_MAX];
+
+// Record that the phase of startup called name has just finished
+void ppl_startupPhase(const char *name)
+ {
+  struct timespec t;
+  if ((!startupProfile) || (startupNPhases>=STARTUP_PHASES_MAX)) return;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  startupPhaseName[startupNPhases]   = name;
+  startupPhaseTime[startupNPhases++] = t.tv_sec*1e3 + t.tv_nsec*1e-6;
+ }
+
+static void ppl_startupReport()
+ {
+  int i;
+  if ((!startupProfile) || (startupNPhases<1)) return;
+  fprintf(stderr, "Startup profile:\n");
+  for (i=1; i<startupNPhases; i++) fprintf(stderr, "  %-36s %9.3f ms\n", startupPhaseName[i], startupPhaseTime[i]-startupPhaseTime[i-1]);
+  fprintf(stderr, "  %-36s %9.3f ms\n", "Total", startupPhaseTime[startupNPhases-1]-startupPhaseTime[0]);
+  startupProfile = 0;
+ }
+
 int main(int argc, char **argv)
  {
   int          i,fail=0;
+  int          serverArg = -1, latexCacheArg = -1;
   int          tempdirnumber = 1;
   char         tempdirpath[FNAME_LENGTH];
   char        *EnvDisplay;
@@ -80,12 +110,17 @@ int main(int argc, char **argv)
 
   sigset_t sigs;
 
-  struct timespec waitperiod, waitedperiod; // A time.h timespec specifier for a 50ms nanosleep wait
+  struct timespec waitperiod, waitedperiod; // A time.h timespec specifier for a 2ms nanosleep wait
   waitperiod.tv_sec  = 0;
-  waitperiod.tv_nsec = 50000000;
+  waitperiod.tv_nsec = 2000000;
+
+  // Startup is profiled if requested; this switch needs to be acted upon before any other
+  for (i=1; i<argc; i++) if ((strcmp(argv[i], "-profile-startup")==0) || (strcmp(argv[i], "--profile-startup")==0)) startupProfile=1;
+  ppl_startupPhase("start");
 
   // Initialise sub-modules
   ppl_PaperSizeInit();
+  ppl_startupPhase("paper sizes");
   context = ppl_contextInit();
   setenv("TZ","UTC",1);
   if (DEBUG) ppl_log(&context->errcontext,"Initialising Pyxplot.");
@@ -93,6 +128,7 @@ int main(int argc, char **argv)
   ppl_memAlloc_MemoryInit(&context->errcontext, &ppl_error, &ppl_log);
   if (!ppl_inputInit(context)) ppl_fatal(&context->errcontext, __FILE__, __LINE__, "Out of memory." );
   ppltxt_init();
+  ppl_startupPhase("text constants");
 
   // Turn off GSL's automatic error handler
   gsl_set_error_handler_off();
@@ -107,6 +143,7 @@ int main(int argc, char **argv)
   // Set up command-line parser; do this BEFORE reading config files, which may contain a [script] section which needs parsing
   if (DEBUG) ppl_log(&context->errcontext,"Setting up command-line parser from RE++ definitions.");
   ppl_parserInit(context);
+  ppl_startupPhase("command-line parser");
 
   // Set default terminal
   EnvDisplay = getenv("DISPLAY"); // Check whether the environment variable DISPLAY is set
@@ -117,6 +154,7 @@ int main(int argc, char **argv)
   // Initialise settings and read configuration file; do this BEFORE processing command-line arguments which take precedence
   if (DEBUG) ppl_log(&context->errcontext,"Reading configuration file.");
   ppl_readconfig(context);
+  ppl_startupPhase("configuration file");
 
   // Scan command-line options for any switches
   for (i=1; i<argc; i++)
@@ -143,6 +181,21 @@ int main(int argc, char **argv)
     else if (strcmp(argv[i], "--mono"      )==0) context->errcontext.session_default.color  = SW_ONOFF_OFF;
     else if (strcmp(argv[i], "-monochrome" )==0) context->errcontext.session_default.color  = SW_ONOFF_OFF;
     else if (strcmp(argv[i], "--monochrome")==0) context->errcontext.session_default.color  = SW_ONOFF_OFF;
+    else if (strcmp(argv[i], "-b"          )==0) context->scriptCache = 1;
+    else if (strcmp(argv[i], "-bytecode"   )==0) context->scriptCache = 1;
+    else if (strcmp(argv[i], "--bytecode"  )==0) context->scriptCache = 1;
+    else if (strcmp(argv[i], "-profile-startup" )==0) { } // Acted upon above
+    else if (strcmp(argv[i], "--profile-startup")==0) { }
+    else if (((strcmp(argv[i], "-latex-cache")==0) || (strcmp(argv[i], "--latex-cache")==0)) && (i+1<argc))
+     {
+      context->latexCache = argv[++i]; // Next argument is the directory in which to cache typeset text
+      latexCacheArg = i;
+     }
+    else if (((strcmp(argv[i], "-server")==0) || (strcmp(argv[i], "--server")==0)) && (i+1<argc))
+     {
+      serverArg = ++i; // Next argument is the path of the socket to listen on
+      context->willBeInteractive = 0;
+     }
     else if (strcmp(argv[i], "-"           )==0) context->willBeInteractive=2;
     else if ((strcmp(argv[i], "-v")==0) || (strcmp(argv[i], "-version")==0) || (strcmp(argv[i], "--version")==0))
      {
@@ -196,9 +249,11 @@ int main(int argc, char **argv)
   // Launch child process
   if (DEBUG) ppl_log(&context->errcontext,"Launching the Child Support Process.");
   pplcsp_init(context);
+  ppl_startupPhase("child support process");
 
-  // Set program name within kpathsea
+  // Set program name within kpathsea. Font search paths are only looked up when the first font is needed.
   ppl_kpse_wrap_init(context);
+  ppl_startupPhase("kpathsea");
 
   // Set up SIGINT handler
   if (sigsetjmp(ppl_sigjmpToMain, 1) == 0)
@@ -210,7 +265,7 @@ int main(int argc, char **argv)
     // Wait for temporary directory to appear, and change directory into it
     if (DEBUG) ppl_log(&context->errcontext,"Waiting for temporary directory to appear.");
     strcpy(tempdirpath, context->errcontext.session_default.tempdir);
-    for (i=0; i<100; i++) { if (access(tempdirpath, F_OK) == 0) break; nanosleep(&waitperiod,&waitedperiod); } // Wait for temp dir to be created by child process
+    for (i=0; i<2500; i++) { if (access(tempdirpath, F_OK) == 0) break; nanosleep(&waitperiod,&waitedperiod); } // Wait for temp dir to be created by child process
     if (access(tempdirpath, F_OK) != 0) { fail=1; } // If it never turns up, fail.
     else
      {
@@ -219,6 +274,7 @@ int main(int argc, char **argv)
       if (statinfo.st_uid != getuid()) fail=1;
      }
     if (fail==1)                { ppl_fatal(&context->errcontext,__FILE__,__LINE__,"Failed to create temporary directory." ); }
+    ppl_startupPhase("waiting for temporary directory");
 
     // Read GNU Readline history
 #ifdef HAVE_READLINE
@@ -227,11 +283,14 @@ int main(int argc, char **argv)
     read_history(tempdirpath);
     stifle_history(1000);
 #endif
+    ppl_startupPhase("readline history");
+    ppl_startupReport();
 
-    // Scan command line and process all script files we have been given
+    // Scan command line and process all script files we have been given. In server mode, these are run before any
+    // scripts are received, so that their settings and definitions are inherited by all of them.
     for (i=1; i<argc; i++)
      {
-      if (strlen(argv[i])==0) continue;
+      if ((strlen(argv[i])==0) || (i==serverArg) || (i==latexCacheArg)) continue;
       if (argv[i][0]=='-')
        {
         if (argv[i][1]=='\0') ppl_interactiveSession(context);
@@ -240,6 +299,7 @@ int main(int argc, char **argv)
       ppl_processScript(context, argv[i], 0);
      }
     if (context->willBeInteractive==1) ppl_interactiveSession(context);
+    if (serverArg>0) ppl_server(context, argv[serverArg]);
 
    // SIGINT longjmps to main return here
    } else {
@@ -249,6 +309,8 @@ int main(int argc, char **argv)
     ppl_error(&context->errcontext,ERR_PREFORMED, -1, -1, "\nReceived SIGINT. Terminating.");
    }
 
+  ppl_serverStop();
+
   // Notify the CSP that we are about to quit
   pplcsp_sendCommand(context,"B\n");
 
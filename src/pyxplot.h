@@ -28,6 +28,7 @@ extern sigjmp_buf  ppl_sigjmpToMain;
 extern sigjmp_buf *ppl_sigjmpFromSigInt;
 #endif
 void               ppl_sigIntHandle(int signo);
+void               ppl_startupPhase(const char *name);
 
 #endif
 
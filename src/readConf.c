@@ -281,6 +281,11 @@ static void ppl_readConfigFile(ppl_context *c, char *ConfigFname)
         if ((i=ppl_fetchSettingByName(&c->errcontext,setvalue,SW_STYLE_INT, SW_STYLE_STR ))>0) { c->set->graph_default.dataStyle.linespoints = i; c->set->graph_default.dataStyle.USElinespoints=1; }
         else {sprintf(c->errcontext.tempErrStr, "Error in line %d of configuration file %s: Illegal value for setting <dataStyle>."    , linecounter, ConfigFname); ppl_warning(&c->errcontext, ERR_PREFORMED, c->errcontext.tempErrStr); continue; }
        }
+      else if (strcmp(setkey, "DATACACHE"    )==0)
+       {
+        if  (fl=ppl_getFloat(setvalue, &i), ((gsl_finite(fl))&&(i==strlen(setvalue))&&(fl>=0)&&(fl<=1048576)))   c->set->term_default .datacache     = (int)fl;
+        else {sprintf(c->errcontext.tempErrStr, "Error in line %d of configuration file %s: Illegal value for setting <dataCache>."    , linecounter, ConfigFname); ppl_warning(&c->errcontext, ERR_PREFORMED, c->errcontext.tempErrStr); continue; }
+       }
       else if (strcmp(setkey, "DISPLAY"      )==0)
        {
         if ((i=ppl_fetchSettingByName(&c->errcontext,setvalue,SW_ONOFF_INT, SW_ONOFF_STR ))>0)                      c->set->term_default .display       = i;
@@ -537,6 +542,12 @@ static void ppl_readConfigFile(ppl_context *c, char *ConfigFname)
         else if ((i=ppl_fetchSettingByName(&c->errcontext,setvalue,SW_VALIGN_INT,SW_VALIGN_STR))>0)                 c->set->graph_default.TextVAlign    = i;
         else {sprintf(c->errcontext.tempErrStr, "Error in line %d of configuration file %s: Illegal value for setting <textVAlign>."   , linecounter, ConfigFname); ppl_warning(&c->errcontext, ERR_PREFORMED, c->errcontext.tempErrStr); continue; }
        }
+      else if (strcmp(setkey, "THREADS"      )==0)
+       {
+        if      (ppl_strCmpNoCase(setvalue, "auto")==0) { c->set->term_default.threads = 0; }
+        else if (fl=ppl_getFloat(setvalue, &i), ((gsl_finite(fl))&&(i==strlen(setvalue))))      c->set->term_default .threads       = ppl_min(ppl_max((int)fl, 1), 256);
+        else {sprintf(c->errcontext.tempErrStr, "Error in line %d of configuration file %s: Illegal value for setting <threads>."      , linecounter, ConfigFname); ppl_warning(&c->errcontext, ERR_PREFORMED, c->errcontext.tempErrStr); continue; }
+       }
       else if (strcmp(setkey, "TITLE"        )==0)
        {
         strcpy(c->set->graph_default.title  , setvalue);
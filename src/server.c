@@ -0,0 +1,249 @@
+// server.c
+//
+// The code in this file is part of Pyxplot
+// <http://www.pyxplot.org.uk>
+//
+// Copyright (C) 2006-2013 Dominic Ford <coders@pyxplot.org.uk>
+//               2008-2013 Ross Church
+//
+// $Id$
+//
+// Pyxplot is free software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation; either version 2 of the License, or (at your option) any later
+// version.
+//
+// You should have received a copy of the GNU General Public License along with
+// Pyxplot; if not, write to the Free Software Foundation, Inc., 51 Franklin
+// Street, Fifth Floor, Boston, MA  02110-1301, USA
+
+
+// ----------------------------------------------------------------------------
+
+// Server mode, in which one initialised Pyxplot process stays resident and runs scripts which are sent to it over a
+// Unix domain socket. Each script is run by a forked copy of the server, so that it starts from the server's state
+// and cannot alter it, and without paying again for Pyxplot's startup or for launching a Child Support Process.
+//
+// A client connects, sends the text of a script, and then shuts down its side of the connection for writing. Once
+// the script has run, the server replies with:
+//
+//   status <0 if no errors were reported, otherwise 1>
+//   output <full path of a graphical output file which was written>   (one line per file)
+//   stdout <number of bytes>
+//   <the script's standard output>
+//   stderr <number of bytes>
+//   <the script's standard error>
+//
+// and closes the connection. Scripts are run one at a time, in the order in which clients connect, since they share
+// the server's temporary directory and Child Support Process. Each inherits a resident latex process, with the default
+// preamble already loaded, which the server starts while waiting for the next client.
+
+#define _SERVER_C 1
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+
+#include "coreUtils/errorReport.h"
+#include "coreUtils/list.h"
+#include "epsMaker/canvasDraw.h"
+#include "epsMaker/kpse_wrap.h"
+#include "stringTools/strConstants.h"
+#include "userspace/context.h"
+
+#include "children.h"
+#include "input.h"
+#include "server.h"
+
+static int  serverListener = -1;
+static char serverPath[FNAME_LENGTH];
+
+// Write all of a buffer to a socket. Returns zero on success.
+static int ppl_serverWrite(int fd, const char *buf, size_t n)
+ {
+  while (n>0)
+   {
+    ssize_t i = write(fd, buf, n);
+    if ((i<0) && (errno==EINTR)) continue;
+    if (i<=0) return 1;
+    buf += i;
+    n   -= i;
+   }
+  return 0;
+ }
+
+// Send the contents of a temporary file to which the script's output was redirected
+static void ppl_serverSendFile(int fd, const char *name, FILE *f)
+ {
+  char header[64], buf[LSTR_LENGTH];
+  long len;
+  size_t n;
+  fflush(f);
+  len = ftell(f);
+  if (len<0) len=0;
+  rewind(f);
+  sprintf(header, "%s %ld\n", name, len);
+  if (ppl_serverWrite(fd, header, strlen(header))) return;
+  while ((len>0) && ((n = fread(buf, 1, (len<LSTR_LENGTH)?len:LSTR_LENGTH, f)) > 0))
+   {
+    if (ppl_serverWrite(fd, buf, n)) return;
+    len -= n;
+   }
+ }
+
+// Run the script sent over connection conn. This is called in a newly forked child of the server, which exits once
+// the reply has been sent.
+static void ppl_serveRequest(ppl_context *context, int conn)
+ {
+  char   scriptName[FNAME_LENGTH], line[FNAME_LENGTH];
+  char  *buffer = NULL;
+  size_t len = 0, alloc = 0;
+  FILE  *script, *out, *err;
+  long   errorsBefore;
+  int    status;
+
+  signal(SIGINT, SIG_DFL); // SIGINT must not return us to the server's main loop
+  context->scriptCache = 0; // Scripts are written to a new temporary file each time, so there is nothing to reuse
+
+  // Read script from client
+  while (1)
+   {
+    ssize_t n;
+    if (len+LSTR_LENGTH > alloc)
+     {
+      char *new = (char *)realloc(buffer, alloc = len+LSTR_LENGTH*4);
+      if (new==NULL) { ppl_serverWrite(conn, "status 1\n", 9); _exit(1); }
+      buffer = new;
+     }
+    n = read(conn, buffer+len, alloc-len);
+    if ((n<0) && (errno==EINTR)) continue;
+    if (n<=0) break;
+    len += n;
+   }
+
+  snprintf(scriptName, FNAME_LENGTH, "%s%sserver_%d.ppl", context->errcontext.session_default.tempdir, PATHLINK, getpid());
+  scriptName[FNAME_LENGTH-1]='\0';
+  if ( ((script = fopen(scriptName, "w")) == NULL) || ((len>0) && (fwrite(buffer, 1, len, script)!=len)) || (fclose(script)!=0) )
+   { ppl_serverWrite(conn, "status 1\n", 9); _exit(1); }
+  free(buffer);
+
+  // Redirect the script's output to temporary files, so that it can be returned in one piece
+  out = tmpfile();
+  err = tmpfile();
+  if ((out==NULL) || (err==NULL)) { remove(scriptName); ppl_serverWrite(conn, "status 1\n", 9); _exit(1); }
+  fflush(stdout);
+  fflush(stderr);
+  dup2(fileno(out), STDOUT_FILENO);
+  dup2(fileno(err), STDERR_FILENO);
+
+  // Run script
+  context->outputFiles = ppl_listInit(1);
+  errorsBefore = ppl_error_count();
+  ppl_processScript(context, scriptName, 0);
+  status = (ppl_error_count() > errorsBefore);
+  fflush(stdout);
+  fflush(stderr);
+  remove(scriptName);
+
+  // Send reply
+  sprintf(line, "status %d\n", status);
+  ppl_serverWrite(conn, line, strlen(line));
+  if (context->outputFiles!=NULL)
+   {
+    listIterator *iter = ppl_listIterateInit(context->outputFiles);
+    char         *fname;
+    while ((fname = (char *)ppl_listIterate(&iter)) != NULL)
+     {
+      snprintf(line, FNAME_LENGTH, "output %s\n", fname);
+      line[FNAME_LENGTH-1]='\0';
+      ppl_serverWrite(conn, line, strlen(line));
+     }
+   }
+  ppl_serverSendFile(conn, "stdout", out);
+  ppl_serverSendFile(conn, "stderr", err);
+  close(conn);
+
+  pplcsp_killLaTeXResident(context);
+  pplcsp_killAllHelpers(context);
+  _exit(0);
+ }
+
+// Listen for scripts on the Unix domain socket socketPath, until interrupted
+void ppl_server(ppl_context *context, char *socketPath)
+ {
+  struct sockaddr_un addr;
+  struct stat        statinfo;
+  int                listener;
+
+  if (strlen(socketPath) >= sizeof(addr.sun_path)) { sprintf(context->errcontext.tempErrStr, "Socket path '%s' is too long.", socketPath); ppl_error(&context->errcontext, ERR_FILE, -1, -1, NULL); return; }
+  if ((lstat(socketPath, &statinfo)==0) && S_ISSOCK(statinfo.st_mode)) unlink(socketPath); // Remove socket left behind by a previous server
+
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strcpy(addr.sun_path, socketPath);
+  if ( ((listener = socket(AF_UNIX, SOCK_STREAM, 0)) < 0) ||
+       (bind(listener, (struct sockaddr *)&addr, sizeof(addr)) < 0) ||
+       (listen(listener, 64) < 0) )
+   {
+    sprintf(context->errcontext.tempErrStr, "Could not listen on socket '%s': %s", socketPath, strerror(errno));
+    ppl_error(&context->errcontext, ERR_FILE, -1, -1, NULL);
+    if (listener>=0) close(listener);
+    return;
+   }
+  serverListener = listener;
+  snprintf(serverPath, FNAME_LENGTH, "%s", socketPath);
+
+  // Do work now which every script would otherwise repeat in its own forked process
+  ppl_kpse_wrap_load();
+  canvas_forkLaTeXResident(context);
+  fflush(stdout);
+  fflush(stderr);
+
+  if (DEBUG) { sprintf(context->errcontext.tempErrStr, "Listening for scripts on socket '%s'.", socketPath); ppl_log(&context->errcontext, NULL); }
+  while (1)
+   {
+    int conn = accept(listener, NULL, NULL);
+    int pid, residentPid;
+    if (conn<0)
+     {
+      if (errno==EINTR) continue;
+      sprintf(context->errcontext.tempErrStr, "Could not accept connection on socket '%s': %s", socketPath, strerror(errno));
+      ppl_error(&context->errcontext, ERR_FILE, -1, -1, NULL);
+      break;
+     }
+    if ((pid=fork()) < 0)
+     {
+      ppl_error(&context->errcontext, ERR_GENERIC, -1, -1, "Could not fork a process to run a script.");
+      close(conn);
+      continue;
+     }
+    if (pid==0) { close(listener); pplcsp_disableLaTeXResident(context); ppl_serveRequest(context, conn); }
+
+    // The script's process now owns our resident latex process. Reap it once the script has finished, whether or not
+    // it was used, and start another for the next script.
+    residentPid = pplcsp_releaseLaTeXResident(context);
+    close(conn);
+    while ((waitpid(pid, NULL, 0) < 0) && (errno==EINTR));
+    if (residentPid>0) { kill(residentPid, SIGTERM); while ((waitpid(residentPid, NULL, 0) < 0) && (errno==EINTR)); }
+    canvas_forkLaTeXResident(context);
+   }
+  ppl_serverStop();
+ }
+
+// Close the server's socket, if it has one open
+void ppl_serverStop()
+ {
+  if (serverListener<0) return;
+  close(serverListener);
+  unlink(serverPath);
+  serverListener = -1;
+ }
+
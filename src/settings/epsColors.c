@@ -0,0 +1,13 @@
+// This file auto-generated by colorsGenerate.py
+
+#define _EPSCOLORS_C 1
+
+#include "epsColors.h"
+
+char  *SW_COLOR_STR[] = { "apricot" ,  "aquamarine" ,  "bitterSweet" ,  "black" ,  "blue" ,  "blueGreen" ,  "blueViolet" ,  "brickRed" ,  "brown" ,  "burntOrange" ,  "cadetBlue" ,  "carnationPink" ,  "cerulean" ,  "cornflowerBlue" ,  "cyan" ,  "dandelion" ,  "darkOrchid" ,  "emerald" ,  "forestGreen" ,  "fuchsia" ,  "goldenRod" ,  "gray" ,  "gray00" ,  "gray01" ,  "gray02" ,  "gray03" ,  "gray04" ,  "gray05" ,  "gray06" ,  "gray07" ,  "gray08" ,  "gray09" ,  "gray10" ,  "gray100" ,  "gray11" ,  "gray12" ,  "gray13" ,  "gray14" ,  "gray15" ,  "gray16" ,  "gray17" ,  "gray18" ,  "gray19" ,  "gray20" ,  "gray21" ,  "gray22" ,  "gray23" ,  "gray24" ,  "gray25" ,  "gray26" ,  "gray27" ,  "gray28" ,  "gray29" ,  "gray30" ,  "gray31" ,  "gray32" ,  "gray33" ,  "gray34" ,  "gray35" ,  "gray36" ,  "gray37" ,  "gray38" ,  "gray39" ,  "gray40" ,  "gray41" ,  "gray42" ,  "gray43" ,  "gray44" ,  "gray45" ,  "gray46" ,  "gray47" ,  "gray48" ,  "gray49" ,  "gray50" ,  "gray51" ,  "gray52" ,  "gray53" ,  "gray54" ,  "gray55" ,  "gray56" ,  "gray57" ,  "gray58" ,  "gray59" ,  "gray60" ,  "gray61" ,  "gray62" ,  "gray63" ,  "gray64" ,  "gray65" ,  "gray66" ,  "gray67" ,  "gray68" ,  "gray69" ,  "gray70" ,  "gray71" ,  "gray72" ,  "gray73" ,  "gray74" ,  "gray75" ,  "gray76" ,  "gray77" ,  "gray78" ,  "gray79" ,  "gray80" ,  "gray81" ,  "gray82" ,  "gray83" ,  "gray84" ,  "gray85" ,  "gray86" ,  "gray87" ,  "gray88" ,  "gray89" ,  "gray90" ,  "gray91" ,  "gray92" ,  "gray93" ,  "gray94" ,  "gray95" ,  "gray96" ,  "gray97" ,  "gray98" ,  "gray99" ,  "green" ,  "greenYellow" ,  "grey" ,  "grey00" ,  "grey01" ,  "grey02" ,  "grey03" ,  "grey04" ,  "grey05" ,  "grey06" ,  "grey07" ,  "grey08" ,  "grey09" ,  "grey10" ,  "grey100" ,  "grey11" ,  "grey12" ,  "grey13" ,  "grey14" ,  "grey15" ,  "grey16" ,  "grey17" ,  "grey18" ,  "grey19" ,  "grey20" ,  "grey21" ,  "grey22" ,  "grey23" ,  "grey24" ,  "grey25" ,  "grey26" ,  "grey27" ,  "grey28" ,  "grey29" ,  "grey30" ,  "grey31" ,  "grey32" ,  "grey33" ,  "grey34" ,  "grey35" ,  "grey36" ,  "grey37" ,  "grey38" ,  "grey39" ,  "grey40" ,  "grey41" ,  "grey42" ,  "grey43" ,  "grey44" ,  "grey45" ,  "grey46" ,  "grey47" ,  "grey48" ,  "grey49" ,  "grey50" ,  "grey51" ,  "grey52" ,  "grey53" ,  "grey54" ,  "grey55" ,  "grey56" ,  "grey57" ,  "grey58" ,  "grey59" ,  "grey60" ,  "grey61" ,  "grey62" ,  "grey63" ,  "grey64" ,  "grey65" ,  "grey66" ,  "grey67" ,  "grey68" ,  "grey69" ,  "grey70" ,  "grey71" ,  "grey72" ,  "grey73" ,  "grey74" ,  "grey75" ,  "grey76" ,  "grey77" ,  "grey78" ,  "grey79" ,  "grey80" ,  "grey81" ,  "grey82" ,  "grey83" ,  "grey84" ,  "grey85" ,  "grey86" ,  "grey87" ,  "grey88" ,  "grey89" ,  "grey90" ,  "grey91" ,  "grey92" ,  "grey93" ,  "grey94" ,  "grey95" ,  "grey96" ,  "grey97" ,  "grey98" ,  "grey99" ,  "invisible" ,  "jungleGreen" ,  "lavender" ,  "limeGreen" ,  "magenta" ,  "mahogany" ,  "maroon" ,  "melon" ,  "midnightBlue" ,  "mulberry" ,  "navyBlue" ,  "null" ,  "oliveGreen" ,  "orange" ,  "orangeRed" ,  "orchid" ,  "peach" ,  "periwinkle" ,  "pineGreen" ,  "plum" ,  "processBlue" ,  "purple" ,  "rawSienna" ,  "red" ,  "redOrange" ,  "redViolet" ,  "rhodamine" ,  "royalBlue" ,  "royalPurple" ,  "rubineRed" ,  "salmon" ,  "seaGreen" ,  "sepia" ,  "skyBlue" ,  "springGreen" ,  "tan" ,  "tealBlue" ,  "thistle" ,  "transparent" ,  "turquoise" ,  "violet" ,  "violetRed" ,  "white" ,  "wildStrawberry" ,  "yellow" ,  "yellowGreen" ,  "yellowOrange" , };
+int    SW_COLOR_DCL[] = { 7 ,  10 ,  11 ,  5 ,  4 ,  9 ,  10 ,  8 ,  5 ,  11 ,  9 ,  13 ,  8 ,  14 ,  4 ,  9 ,  10 ,  7 ,  11 ,  7 ,  9 ,  4 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  7 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  5 ,  11 ,  4 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  7 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  6 ,  9 ,  11 ,  8 ,  9 ,  7 ,  8 ,  6 ,  5 ,  12 ,  8 ,  8 ,  4 ,  10 ,  6 ,  9 ,  6 ,  5 ,  10 ,  9 ,  4 ,  11 ,  6 ,  9 ,  3 ,  9 ,  9 ,  9 ,  9 ,  11 ,  9 ,  6 ,  8 ,  5 ,  7 ,  11 ,  3 ,  8 ,  7 ,  11 ,  9 ,  6 ,  9 ,  5 ,  14 ,  6 ,  11 ,  12 , };
+int    SW_COLOR_INT[] = { COLOR_APRICOT ,  COLOR_AQUAMARINE ,  COLOR_BITTERSWEET ,  COLOR_BLACK ,  COLOR_BLUE ,  COLOR_BLUEGREEN ,  COLOR_BLUEVIOLET ,  COLOR_BRICKRED ,  COLOR_BROWN ,  COLOR_BURNTORANGE ,  COLOR_CADETBLUE ,  COLOR_CARNATIONPINK ,  COLOR_CERULEAN ,  COLOR_CORNFLOWERBLUE ,  COLOR_CYAN ,  COLOR_DANDELION ,  COLOR_DARKORCHID ,  COLOR_EMERALD ,  COLOR_FORESTGREEN ,  COLOR_FUCHSIA ,  COLOR_GOLDENROD ,  COLOR_GRAY ,  COLOR_GRAY00 ,  COLOR_GRAY01 ,  COLOR_GRAY02 ,  COLOR_GRAY03 ,  COLOR_GRAY04 ,  COLOR_GRAY05 ,  COLOR_GRAY06 ,  COLOR_GRAY07 ,  COLOR_GRAY08 ,  COLOR_GRAY09 ,  COLOR_GRAY10 ,  COLOR_GRAY100 ,  COLOR_GRAY11 ,  COLOR_GRAY12 ,  COLOR_GRAY13 ,  COLOR_GRAY14 ,  COLOR_GRAY15 ,  COLOR_GRAY16 ,  COLOR_GRAY17 ,  COLOR_GRAY18 ,  COLOR_GRAY19 ,  COLOR_GRAY20 ,  COLOR_GRAY21 ,  COLOR_GRAY22 ,  COLOR_GRAY23 ,  COLOR_GRAY24 ,  COLOR_GRAY25 ,  COLOR_GRAY26 ,  COLOR_GRAY27 ,  COLOR_GRAY28 ,  COLOR_GRAY29 ,  COLOR_GRAY30 ,  COLOR_GRAY31 ,  COLOR_GRAY32 ,  COLOR_GRAY33 ,  COLOR_GRAY34 ,  COLOR_GRAY35 ,  COLOR_GRAY36 ,  COLOR_GRAY37 ,  COLOR_GRAY38 ,  COLOR_GRAY39 ,  COLOR_GRAY40 ,  COLOR_GRAY41 ,  COLOR_GRAY42 ,  COLOR_GRAY43 ,  COLOR_GRAY44 ,  COLOR_GRAY45 ,  COLOR_GRAY46 ,  COLOR_GRAY47 ,  COLOR_GRAY48 ,  COLOR_GRAY49 ,  COLOR_GRAY50 ,  COLOR_GRAY51 ,  COLOR_GRAY52 ,  COLOR_GRAY53 ,  COLOR_GRAY54 ,  COLOR_GRAY55 ,  COLOR_GRAY56 ,  COLOR_GRAY57 ,  COLOR_GRAY58 ,  COLOR_GRAY59 ,  COLOR_GRAY60 ,  COLOR_GRAY61 ,  COLOR_GRAY62 ,  COLOR_GRAY63 ,  COLOR_GRAY64 ,  COLOR_GRAY65 ,  COLOR_GRAY66 ,  COLOR_GRAY67 ,  COLOR_GRAY68 ,  COLOR_GRAY69 ,  COLOR_GRAY70 ,  COLOR_GRAY71 ,  COLOR_GRAY72 ,  COLOR_GRAY73 ,  COLOR_GRAY74 ,  COLOR_GRAY75 ,  COLOR_GRAY76 ,  COLOR_GRAY77 ,  COLOR_GRAY78 ,  COLOR_GRAY79 ,  COLOR_GRAY80 ,  COLOR_GRAY81 ,  COLOR_GRAY82 ,  COLOR_GRAY83 ,  COLOR_GRAY84 ,  COLOR_GRAY85 ,  COLOR_GRAY86 ,  COLOR_GRAY87 ,  COLOR_GRAY88 ,  COLOR_GRAY89 ,  COLOR_GRAY90 ,  COLOR_GRAY91 ,  COLOR_GRAY92 ,  COLOR_GRAY93 ,  COLOR_GRAY94 ,  COLOR_GRAY95 ,  COLOR_GRAY96 ,  COLOR_GRAY97 ,  COLOR_GRAY98 ,  COLOR_GRAY99 ,  COLOR_GREEN ,  COLOR_GREENYELLOW ,  COLOR_GREY ,  COLOR_GREY00 ,  COLOR_GREY01 ,  COLOR_GREY02 ,  COLOR_GREY03 ,  COLOR_GREY04 ,  COLOR_GREY05 ,  COLOR_GREY06 ,  COLOR_GREY07 ,  COLOR_GREY08 ,  COLOR_GREY09 ,  COLOR_GREY10 ,  COLOR_GREY100 ,  COLOR_GREY11 ,  COLOR_GREY12 ,  COLOR_GREY13 ,  COLOR_GREY14 ,  COLOR_GREY15 ,  COLOR_GREY16 ,  COLOR_GREY17 ,  COLOR_GREY18 ,  COLOR_GREY19 ,  COLOR_GREY20 ,  COLOR_GREY21 ,  COLOR_GREY22 ,  COLOR_GREY23 ,  COLOR_GREY24 ,  COLOR_GREY25 ,  COLOR_GREY26 ,  COLOR_GREY27 ,  COLOR_GREY28 ,  COLOR_GREY29 ,  COLOR_GREY30 ,  COLOR_GREY31 ,  COLOR_GREY32 ,  COLOR_GREY33 ,  COLOR_GREY34 ,  COLOR_GREY35 ,  COLOR_GREY36 ,  COLOR_GREY37 ,  COLOR_GREY38 ,  COLOR_GREY39 ,  COLOR_GREY40 ,  COLOR_GREY41 ,  COLOR_GREY42 ,  COLOR_GREY43 ,  COLOR_GREY44 ,  COLOR_GREY45 ,  COLOR_GREY46 ,  COLOR_GREY47 ,  COLOR_GREY48 ,  COLOR_GREY49 ,  COLOR_GREY50 ,  COLOR_GREY51 ,  COLOR_GREY52 ,  COLOR_GREY53 ,  COLOR_GREY54 ,  COLOR_GREY55 ,  COLOR_GREY56 ,  COLOR_GREY57 ,  COLOR_GREY58 ,  COLOR_GREY59 ,  COLOR_GREY60 ,  COLOR_GREY61 ,  COLOR_GREY62 ,  COLOR_GREY63 ,  COLOR_GREY64 ,  COLOR_GREY65 ,  COLOR_GREY66 ,  COLOR_GREY67 ,  COLOR_GREY68 ,  COLOR_GREY69 ,  COLOR_GREY70 ,  COLOR_GREY71 ,  COLOR_GREY72 ,  COLOR_GREY73 ,  COLOR_GREY74 ,  COLOR_GREY75 ,  COLOR_GREY76 ,  COLOR_GREY77 ,  COLOR_GREY78 ,  COLOR_GREY79 ,  COLOR_GREY80 ,  COLOR_GREY81 ,  COLOR_GREY82 ,  COLOR_GREY83 ,  COLOR_GREY84 ,  COLOR_GREY85 ,  COLOR_GREY86 ,  COLOR_GREY87 ,  COLOR_GREY88 ,  COLOR_GREY89 ,  COLOR_GREY90 ,  COLOR_GREY91 ,  COLOR_GREY92 ,  COLOR_GREY93 ,  COLOR_GREY94 ,  COLOR_GREY95 ,  COLOR_GREY96 ,  COLOR_GREY97 ,  COLOR_GREY98 ,  COLOR_GREY99 ,  COLOR_INVISIBLE ,  COLOR_JUNGLEGREEN ,  COLOR_LAVENDER ,  COLOR_LIMEGREEN ,  COLOR_MAGENTA ,  COLOR_MAHOGANY ,  COLOR_MAROON ,  COLOR_MELON ,  COLOR_MIDNIGHTBLUE ,  COLOR_MULBERRY ,  COLOR_NAVYBLUE ,  COLOR_NULL ,  COLOR_OLIVEGREEN ,  COLOR_ORANGE ,  COLOR_ORANGERED ,  COLOR_ORCHID ,  COLOR_PEACH ,  COLOR_PERIWINKLE ,  COLOR_PINEGREEN ,  COLOR_PLUM ,  COLOR_PROCESSBLUE ,  COLOR_PURPLE ,  COLOR_RAWSIENNA ,  COLOR_RED ,  COLOR_REDORANGE ,  COLOR_REDVIOLET ,  COLOR_RHODAMINE ,  COLOR_ROYALBLUE ,  COLOR_ROYALPURPLE ,  COLOR_RUBINERED ,  COLOR_SALMON ,  COLOR_SEAGREEN ,  COLOR_SEPIA ,  COLOR_SKYBLUE ,  COLOR_SPRINGGREEN ,  COLOR_TAN ,  COLOR_TEALBLUE ,  COLOR_THISTLE ,  COLOR_TRANSPARENT ,  COLOR_TURQUOISE ,  COLOR_VIOLET ,  COLOR_VIOLETRED ,  COLOR_WHITE ,  COLOR_WILDSTRAWBERRY ,  COLOR_YELLOW ,  COLOR_YELLOWGREEN ,  COLOR_YELLOWORANGE , -1};
+double SW_COLOR_CMYK_C[] = { 0.000000 ,  0.820000 ,  0.000000 ,  0.000000 ,  1.000000 ,  0.850000 ,  0.860000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.620000 ,  0.000000 ,  0.940000 ,  0.650000 ,  1.000000 ,  0.000000 ,  0.400000 ,  1.000000 ,  0.910000 ,  0.470000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  1.000000 ,  0.150000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  -1.000000 ,  0.990000 ,  0.000000 ,  0.500000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.980000 ,  0.340000 ,  0.940000 ,  -1.000000 ,  0.640000 ,  0.000000 ,  0.000000 ,  0.320000 ,  0.000000 ,  0.570000 ,  0.920000 ,  0.500000 ,  0.960000 ,  0.450000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.070000 ,  0.000000 ,  1.000000 ,  0.750000 ,  0.000000 ,  0.000000 ,  0.690000 ,  0.000000 ,  0.620000 ,  0.260000 ,  0.140000 ,  0.860000 ,  0.120000 ,  -1.000000 ,  0.850000 ,  0.790000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.440000 ,  0.000000 , };
+double SW_COLOR_CMYK_M[] = { 0.320000 ,  0.000000 ,  0.750000 ,  0.000000 ,  1.000000 ,  0.000000 ,  0.910000 ,  0.890000 ,  0.810000 ,  0.510000 ,  0.570000 ,  0.630000 ,  0.110000 ,  0.130000 ,  0.000000 ,  0.290000 ,  0.800000 ,  0.000000 ,  0.000000 ,  0.910000 ,  0.100000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  -1.000000 ,  0.000000 ,  0.480000 ,  0.000000 ,  1.000000 ,  0.850000 ,  0.870000 ,  0.460000 ,  0.130000 ,  0.900000 ,  0.540000 ,  -1.000000 ,  0.000000 ,  0.610000 ,  1.000000 ,  0.640000 ,  0.500000 ,  0.550000 ,  0.000000 ,  1.000000 ,  0.000000 ,  0.860000 ,  0.720000 ,  1.000000 ,  0.770000 ,  0.900000 ,  0.820000 ,  0.500000 ,  0.900000 ,  1.000000 ,  0.530000 ,  0.000000 ,  0.830000 ,  0.000000 ,  0.000000 ,  0.420000 ,  0.000000 ,  0.590000 ,  -1.000000 ,  0.000000 ,  0.880000 ,  0.810000 ,  0.000000 ,  0.960000 ,  0.000000 ,  0.000000 ,  0.420000 , };
+double SW_COLOR_CMYK_Y[] = { 0.520000 ,  0.300000 ,  1.000000 ,  0.000000 ,  0.000000 ,  0.330000 ,  0.000000 ,  0.940000 ,  1.000000 ,  1.000000 ,  0.230000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.840000 ,  0.200000 ,  0.500000 ,  0.880000 ,  0.000000 ,  0.840000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  1.000000 ,  0.690000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  -1.000000 ,  0.520000 ,  0.000000 ,  1.000000 ,  0.000000 ,  0.870000 ,  0.680000 ,  0.500000 ,  0.000000 ,  0.000000 ,  0.000000 ,  -1.000000 ,  0.950000 ,  0.870000 ,  0.500000 ,  0.000000 ,  0.700000 ,  0.000000 ,  0.590000 ,  0.000000 ,  0.000000 ,  0.000000 ,  1.000000 ,  1.000000 ,  0.870000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.130000 ,  0.380000 ,  0.500000 ,  1.000000 ,  0.120000 ,  0.760000 ,  0.560000 ,  0.340000 ,  0.000000 ,  -1.000000 ,  0.200000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.390000 ,  1.000000 ,  0.740000 ,  1.000000 , };
+double SW_COLOR_CMYK_K[] = { 0.000000 ,  0.000000 ,  0.240000 ,  1.000000 ,  0.000000 ,  0.000000 ,  0.040000 ,  0.280000 ,  0.600000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.120000 ,  0.080000 ,  0.000000 ,  0.500000 ,  1.000000 ,  0.990000 ,  0.980000 ,  0.970000 ,  0.960000 ,  0.950000 ,  0.940000 ,  0.930000 ,  0.920000 ,  0.910000 ,  0.900000 ,  0.000000 ,  0.890000 ,  0.880000 ,  0.870000 ,  0.860000 ,  0.850000 ,  0.840000 ,  0.830000 ,  0.820000 ,  0.810000 ,  0.800000 ,  0.790000 ,  0.780000 ,  0.770000 ,  0.760000 ,  0.750000 ,  0.740000 ,  0.730000 ,  0.720000 ,  0.710000 ,  0.700000 ,  0.690000 ,  0.680000 ,  0.670000 ,  0.660000 ,  0.650000 ,  0.640000 ,  0.630000 ,  0.620000 ,  0.610000 ,  0.600000 ,  0.590000 ,  0.580000 ,  0.570000 ,  0.560000 ,  0.550000 ,  0.540000 ,  0.530000 ,  0.520000 ,  0.510000 ,  0.500000 ,  0.490000 ,  0.480000 ,  0.470000 ,  0.460000 ,  0.450000 ,  0.440000 ,  0.430000 ,  0.420000 ,  0.410000 ,  0.400000 ,  0.390000 ,  0.380000 ,  0.370000 ,  0.360000 ,  0.350000 ,  0.340000 ,  0.330000 ,  0.320000 ,  0.310000 ,  0.300000 ,  0.290000 ,  0.280000 ,  0.270000 ,  0.260000 ,  0.250000 ,  0.240000 ,  0.230000 ,  0.220000 ,  0.210000 ,  0.200000 ,  0.190000 ,  0.180000 ,  0.170000 ,  0.160000 ,  0.150000 ,  0.140000 ,  0.130000 ,  0.120000 ,  0.110000 ,  0.100000 ,  0.090000 ,  0.080000 ,  0.070000 ,  0.060000 ,  0.050000 ,  0.040000 ,  0.030000 ,  0.020000 ,  0.010000 ,  0.000000 ,  0.000000 ,  0.500000 ,  1.000000 ,  0.990000 ,  0.980000 ,  0.970000 ,  0.960000 ,  0.950000 ,  0.940000 ,  0.930000 ,  0.920000 ,  0.910000 ,  0.900000 ,  0.000000 ,  0.890000 ,  0.880000 ,  0.870000 ,  0.860000 ,  0.850000 ,  0.840000 ,  0.830000 ,  0.820000 ,  0.810000 ,  0.800000 ,  0.790000 ,  0.780000 ,  0.770000 ,  0.760000 ,  0.750000 ,  0.740000 ,  0.730000 ,  0.720000 ,  0.710000 ,  0.700000 ,  0.690000 ,  0.680000 ,  0.670000 ,  0.660000 ,  0.650000 ,  0.640000 ,  0.630000 ,  0.620000 ,  0.610000 ,  0.600000 ,  0.590000 ,  0.580000 ,  0.570000 ,  0.560000 ,  0.550000 ,  0.540000 ,  0.530000 ,  0.520000 ,  0.510000 ,  0.500000 ,  0.490000 ,  0.480000 ,  0.470000 ,  0.460000 ,  0.450000 ,  0.440000 ,  0.430000 ,  0.420000 ,  0.410000 ,  0.400000 ,  0.390000 ,  0.380000 ,  0.370000 ,  0.360000 ,  0.350000 ,  0.340000 ,  0.330000 ,  0.320000 ,  0.310000 ,  0.300000 ,  0.290000 ,  0.280000 ,  0.270000 ,  0.260000 ,  0.250000 ,  0.240000 ,  0.230000 ,  0.220000 ,  0.210000 ,  0.200000 ,  0.190000 ,  0.180000 ,  0.170000 ,  0.160000 ,  0.150000 ,  0.140000 ,  0.130000 ,  0.120000 ,  0.110000 ,  0.100000 ,  0.090000 ,  0.080000 ,  0.070000 ,  0.060000 ,  0.050000 ,  0.040000 ,  0.030000 ,  0.020000 ,  0.010000 ,  -1.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.350000 ,  0.320000 ,  0.000000 ,  0.430000 ,  0.020000 ,  0.000000 ,  -1.000000 ,  0.400000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.250000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.450000 ,  0.000000 ,  0.000000 ,  0.340000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.700000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.020000 ,  0.000000 ,  -1.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 ,  0.000000 , };
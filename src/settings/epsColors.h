@@ -0,0 +1,292 @@
+// This file auto-generated by colorsGenerate.py
+
+#ifndef _EPSCOLORS_H
+#define _EPSCOLORS_H 1
+
+#define COLOR_APRICOT 20000
+#define COLOR_AQUAMARINE 20001
+#define COLOR_BITTERSWEET 20002
+#define COLOR_BLACK 20003
+#define COLOR_BLUE 20004
+#define COLOR_BLUEGREEN 20005
+#define COLOR_BLUEVIOLET 20006
+#define COLOR_BRICKRED 20007
+#define COLOR_BROWN 20008
+#define COLOR_BURNTORANGE 20009
+#define COLOR_CADETBLUE 20010
+#define COLOR_CARNATIONPINK 20011
+#define COLOR_CERULEAN 20012
+#define COLOR_CORNFLOWERBLUE 20013
+#define COLOR_CYAN 20014
+#define COLOR_DANDELION 20015
+#define COLOR_DARKORCHID 20016
+#define COLOR_EMERALD 20017
+#define COLOR_FORESTGREEN 20018
+#define COLOR_FUCHSIA 20019
+#define COLOR_GOLDENROD 20020
+#define COLOR_GRAY 20021
+#define COLOR_GRAY00 20022
+#define COLOR_GRAY01 20023
+#define COLOR_GRAY02 20024
+#define COLOR_GRAY03 20025
+#define COLOR_GRAY04 20026
+#define COLOR_GRAY05 20027
+#define COLOR_GRAY06 20028
+#define COLOR_GRAY07 20029
+#define COLOR_GRAY08 20030
+#define COLOR_GRAY09 20031
+#define COLOR_GRAY10 20032
+#define COLOR_GRAY100 20033
+#define COLOR_GRAY11 20034
+#define COLOR_GRAY12 20035
+#define COLOR_GRAY13 20036
+#define COLOR_GRAY14 20037
+#define COLOR_GRAY15 20038
+#define COLOR_GRAY16 20039
+#define COLOR_GRAY17 20040
+#define COLOR_GRAY18 20041
+#define COLOR_GRAY19 20042
+#define COLOR_GRAY20 20043
+#define COLOR_GRAY21 20044
+#define COLOR_GRAY22 20045
+#define COLOR_GRAY23 20046
+#define COLOR_GRAY24 20047
+#define COLOR_GRAY25 20048
+#define COLOR_GRAY26 20049
+#define COLOR_GRAY27 20050
+#define COLOR_GRAY28 20051
+#define COLOR_GRAY29 20052
+#define COLOR_GRAY30 20053
+#define COLOR_GRAY31 20054
+#define COLOR_GRAY32 20055
+#define COLOR_GRAY33 20056
+#define COLOR_GRAY34 20057
+#define COLOR_GRAY35 20058
+#define COLOR_GRAY36 20059
+#define COLOR_GRAY37 20060
+#define COLOR_GRAY38 20061
+#define COLOR_GRAY39 20062
+#define COLOR_GRAY40 20063
+#define COLOR_GRAY41 20064
+#define COLOR_GRAY42 20065
+#define COLOR_GRAY43 20066
+#define COLOR_GRAY44 20067
+#define COLOR_GRAY45 20068
+#define COLOR_GRAY46 20069
+#define COLOR_GRAY47 20070
+#define COLOR_GRAY48 20071
+#define COLOR_GRAY49 20072
+#define COLOR_GRAY50 20073
+#define COLOR_GRAY51 20074
+#define COLOR_GRAY52 20075
+#define COLOR_GRAY53 20076
+#define COLOR_GRAY54 20077
+#define COLOR_GRAY55 20078
+#define COLOR_GRAY56 20079
+#define COLOR_GRAY57 20080
+#define COLOR_GRAY58 20081
+#define COLOR_GRAY59 20082
+#define COLOR_GRAY60 20083
+#define COLOR_GRAY61 20084
+#define COLOR_GRAY62 20085
+#define COLOR_GRAY63 20086
+#define COLOR_GRAY64 20087
+#define COLOR_GRAY65 20088
+#define COLOR_GRAY66 20089
+#define COLOR_GRAY67 20090
+#define COLOR_GRAY68 20091
+#define COLOR_GRAY69 20092
+#define COLOR_GRAY70 20093
+#define COLOR_GRAY71 20094
+#define COLOR_GRAY72 20095
+#define COLOR_GRAY73 20096
+#define COLOR_GRAY74 20097
+#define COLOR_GRAY75 20098
+#define COLOR_GRAY76 20099
+#define COLOR_GRAY77 20100
+#define COLOR_GRAY78 20101
+#define COLOR_GRAY79 20102
+#define COLOR_GRAY80 20103
+#define COLOR_GRAY81 20104
+#define COLOR_GRAY82 20105
+#define COLOR_GRAY83 20106
+#define COLOR_GRAY84 20107
+#define COLOR_GRAY85 20108
+#define COLOR_GRAY86 20109
+#define COLOR_GRAY87 20110
+#define COLOR_GRAY88 20111
+#define COLOR_GRAY89 20112
+#define COLOR_GRAY90 20113
+#define COLOR_GRAY91 20114
+#define COLOR_GRAY92 20115
+#define COLOR_GRAY93 20116
+#define COLOR_GRAY94 20117
+#define COLOR_GRAY95 20118
+#define COLOR_GRAY96 20119
+#define COLOR_GRAY97 20120
+#define COLOR_GRAY98 20121
+#define COLOR_GRAY99 20122
+#define COLOR_GREEN 20123
+#define COLOR_GREENYELLOW 20124
+#define COLOR_GREY 20125
+#define COLOR_GREY00 20126
+#define COLOR_GREY01 20127
+#define COLOR_GREY02 20128
+#define COLOR_GREY03 20129
+#define COLOR_GREY04 20130
+#define COLOR_GREY05 20131
+#define COLOR_GREY06 20132
+#define COLOR_GREY07 20133
+#define COLOR_GREY08 20134
+#define COLOR_GREY09 20135
+#define COLOR_GREY10 20136
+#define COLOR_GREY100 20137
+#define COLOR_GREY11 20138
+#define COLOR_GREY12 20139
+#define COLOR_GREY13 20140
+#define COLOR_GREY14 20141
+#define COLOR_GREY15 20142
+#define COLOR_GREY16 20143
+#define COLOR_GREY17 20144
+#define COLOR_GREY18 20145
+#define COLOR_GREY19 20146
+#define COLOR_GREY20 20147
+#define COLOR_GREY21 20148
+#define COLOR_GREY22 20149
+#define COLOR_GREY23 20150
+#define COLOR_GREY24 20151
+#define COLOR_GREY25 20152
+#define COLOR_GREY26 20153
+#define COLOR_GREY27 20154
+#define COLOR_GREY28 20155
+#define COLOR_GREY29 20156
+#define COLOR_GREY30 20157
+#define COLOR_GREY31 20158
+#define COLOR_GREY32 20159
+#define COLOR_GREY33 20160
+#define COLOR_GREY34 20161
+#define COLOR_GREY35 20162
+#define COLOR_GREY36 20163
+#define COLOR_GREY37 20164
+#define COLOR_GREY38 20165
+#define COLOR_GREY39 20166
+#define COLOR_GREY40 20167
+#define COLOR_GREY41 20168
+#define COLOR_GREY42 20169
+#define COLOR_GREY43 20170
+#define COLOR_GREY44 20171
+#define COLOR_GREY45 20172
+#define COLOR_GREY46 20173
+#define COLOR_GREY47 20174
+#define COLOR_GREY48 20175
+#define COLOR_GREY49 20176
+#define COLOR_GREY50 20177
+#define COLOR_GREY51 20178
+#define COLOR_GREY52 20179
+#define COLOR_GREY53 20180
+#define COLOR_GREY54 20181
+#define COLOR_GREY55 20182
+#define COLOR_GREY56 20183
+#define COLOR_GREY57 20184
+#define COLOR_GREY58 20185
+#define COLOR_GREY59 20186
+#define COLOR_GREY60 20187
+#define COLOR_GREY61 20188
+#define COLOR_GREY62 20189
+#define COLOR_GREY63 20190
+#define COLOR_GREY64 20191
+#define COLOR_GREY65 20192
+#define COLOR_GREY66 20193
+#define COLOR_GREY67 20194
+#define COLOR_GREY68 20195
+#define COLOR_GREY69 20196
+#define COLOR_GREY70 20197
+#define COLOR_GREY71 20198
+#define COLOR_GREY72 20199
+#define COLOR_GREY73 20200
+#define COLOR_GREY74 20201
+#define COLOR_GREY75 20202
+#define COLOR_GREY76 20203
+#define COLOR_GREY77 20204
+#define COLOR_GREY78 20205
+#define COLOR_GREY79 20206
+#define COLOR_GREY80 20207
+#define COLOR_GREY81 20208
+#define COLOR_GREY82 20209
+#define COLOR_GREY83 20210
+#define COLOR_GREY84 20211
+#define COLOR_GREY85 20212
+#define COLOR_GREY86 20213
+#define COLOR_GREY87 20214
+#define COLOR_GREY88 20215
+#define COLOR_GREY89 20216
+#define COLOR_GREY90 20217
+#define COLOR_GREY91 20218
+#define COLOR_GREY92 20219
+#define COLOR_GREY93 20220
+#define COLOR_GREY94 20221
+#define COLOR_GREY95 20222
+#define COLOR_GREY96 20223
+#define COLOR_GREY97 20224
+#define COLOR_GREY98 20225
+#define COLOR_GREY99 20226
+#define COLOR_INVISIBLE 20227
+#define COLOR_JUNGLEGREEN 20228
+#define COLOR_LAVENDER 20229
+#define COLOR_LIMEGREEN 20230
+#define COLOR_MAGENTA 20231
+#define COLOR_MAHOGANY 20232
+#define COLOR_MAROON 20233
+#define COLOR_MELON 20234
+#define COLOR_MIDNIGHTBLUE 20235
+#define COLOR_MULBERRY 20236
+#define COLOR_NAVYBLUE 20237
+#define COLOR_NULL 20238
+#define COLOR_OLIVEGREEN 20239
+#define COLOR_ORANGE 20240
+#define COLOR_ORANGERED 20241
+#define COLOR_ORCHID 20242
+#define COLOR_PEACH 20243
+#define COLOR_PERIWINKLE 20244
+#define COLOR_PINEGREEN 20245
+#define COLOR_PLUM 20246
+#define COLOR_PROCESSBLUE 20247
+#define COLOR_PURPLE 20248
+#define COLOR_RAWSIENNA 20249
+#define COLOR_RED 20250
+#define COLOR_REDORANGE 20251
+#define COLOR_REDVIOLET 20252
+#define COLOR_RHODAMINE 20253
+#define COLOR_ROYALBLUE 20254
+#define COLOR_ROYALPURPLE 20255
+#define COLOR_RUBINERED 20256
+#define COLOR_SALMON 20257
+#define COLOR_SEAGREEN 20258
+#define COLOR_SEPIA 20259
+#define COLOR_SKYBLUE 20260
+#define COLOR_SPRINGGREEN 20261
+#define COLOR_TAN 20262
+#define COLOR_TEALBLUE 20263
+#define COLOR_THISTLE 20264
+#define COLOR_TRANSPARENT 20265
+#define COLOR_TURQUOISE 20266
+#define COLOR_VIOLET 20267
+#define COLOR_VIOLETRED 20268
+#define COLOR_WHITE 20269
+#define COLOR_WILDSTRAWBERRY 20270
+#define COLOR_YELLOW 20271
+#define COLOR_YELLOWGREEN 20272
+#define COLOR_YELLOWORANGE 20273
+
+#ifndef _EPSCOLORS_C
+extern char  *SW_COLOR_STR[];
+extern int    SW_COLOR_DCL[];
+extern int    SW_COLOR_INT[];
+
+extern double SW_COLOR_CMYK_C[];
+extern double SW_COLOR_CMYK_M[];
+extern double SW_COLOR_CMYK_Y[];
+extern double SW_COLOR_CMYK_K[];
+#endif
+
+#endif
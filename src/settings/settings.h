@@ -36,7 +36,7 @@ extern int cancellationFlag;
 
 // Setting structures
 typedef struct pplset_terminal {
- int    backup, CalendarIn, CalendarOut, color, ComplexNumbers, display, ExplicitErrors, landscape, multiplot, NumDisplay, SignificantFigures, TermAntiAlias, TermType, TermEnlarge, TermInvert, TermTransparent, UnitScheme, UnitDisplayPrefix, UnitDisplayAbbrev, UnitAngleDimless, viewer;
+ int    backup, CalendarIn, CalendarOut, color, ComplexNumbers, datacache, display, ExplicitErrors, landscape, multiplot, NumDisplay, SignificantFigures, TermAntiAlias, TermType, TermEnlarge, TermInvert, TermTransparent, threads, UnitScheme, UnitDisplayPrefix, UnitDisplayAbbrev, UnitAngleDimless, viewer;
  long int RandomSeed;
  double dpi;
  unsigned char BinOriginAuto, BinWidthAuto;
@@ -49,6 +49,8 @@ int cancellationFlag = 0;
 
 #include "userspace/pplObj_fns.h"
 
+#include "datafile_cache.h"
+
 void pplset_makedefault(ppl_context *context)
  {
   FILE  *LocalePipe;
@@ -91,6 +93,7 @@ void pplset_makedefault(ppl_context *context)
   s->term_default.CalendarOut         = SW_CALENDAR_BRITISH;
   s->term_default.color              = SW_ONOFF_ON;
   s->term_default.ComplexNumbers      = SW_ONOFF_OFF;
+  s->term_default.datacache           = DATAFILE_CACHE_DEFAULT;
   s->term_default.display             = SW_ONOFF_ON;
   s->term_default.dpi                 = 300.0;
   s->term_default.ExplicitErrors      = SW_ONOFF_ON;
@@ -115,6 +118,7 @@ void pplset_makedefault(ppl_context *context)
   s->term_default.TermEnlarge         = SW_ONOFF_OFF;
   s->term_default.TermInvert          = SW_ONOFF_OFF;
   s->term_default.TermTransparent     = SW_ONOFF_OFF;
+  s->term_default.threads             = 0;
   s->term_default.UnitScheme          = SW_UNITSCH_SI;
   s->term_default.UnitDisplayPrefix   = SW_ONOFF_ON;
   s->term_default.UnitDisplayAbbrev   = SW_ONOFF_ON;
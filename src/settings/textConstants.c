@@ -56,6 +56,10 @@ Usage: pyxplot <options> <filelist>\n\
   -V, --verbose:    Turn on initial welcome message.\n\
   -c, --color:      Use colored highlighting of output.\n\
   -m, --monochrome: Turn off colored highlighting.\n\
+  -b, --bytecode:   Keep compiled scripts in cache files alongside them.\n\
+  --profile-startup: Report the time taken by each phase of startup.\n\
+  --latex-cache <dir>: Cache typeset text items in the directory <dir>.\n\
+  --server <socket>: Run scripts received on a Unix domain socket.\n\
 \n\
 A brief introduction to Pyxplot can be obtained by typing 'man pyxplot'; the\n\
 full Users' Guide can be found in the file:\n\
@@ -85,17 +89,17 @@ Error: Unrecognised command.\n\
 sprintf(ppltxt_valid_set_options, "\n\
 'arrow', 'autoscale', 'axescolor', 'axis', 'axisunitstyle', 'backup', 'bar',\n\
 'binorigin', 'binwidth', 'boxfrom', 'boxwidth', 'c1format', 'c1label',\n\
-'calendar', 'clip', 'colmap', 'colkey', 'contours', 'c<n>range', 'data style',\n\
-'display', 'filter', 'fontsize', 'function style', 'grid', 'gridmajcolor',\n\
-'gridmincolor', 'key', 'keycolumns', 'label', 'linearscale', 'linewidth',\n\
-'logscale', 'multiplot', 'noarrow', 'noaxis', 'nobackup', 'nodisplay',\n\
-'nogrid', 'nokey', 'nolabel', 'nologscale', 'nomultiplot', 'nostyle',\n\
-'notitle', 'no<m>[xyz]<n>format', 'no<m>[xyz]<n>tics', 'numerics', 'origin',\n\
-'output', 'palette', 'papersize', 'pointlinewidth', 'pointsize', 'preamble',\n\
-'samples', 'seed', 'size', 'size noratio', 'size ratio', 'size square',\n\
-'style', 'terminal', 'textcolor', 'texthalign', 'textvalign', 'title',\n\
-'trange', 'unit', 'urange', 'view', 'viewer', 'vrange', 'width',\n\
-'[xyz]<n>format', '[xyz]<n>label', '[xyz]<n>range', '<m>[xyz]<n>tics'\n\
+'calendar', 'clip', 'colmap', 'colkey', 'contours', 'c<n>range', 'datacache',\n\
+'data style', 'display', 'filter', 'fontsize', 'function style', 'grid',\n\
+'gridmajcolor', 'gridmincolor', 'key', 'keycolumns', 'label', 'linearscale',\n\
+'linewidth', 'logscale', 'multiplot', 'noarrow', 'noaxis', 'nobackup',\n\
+'nodisplay', 'nogrid', 'nokey', 'nolabel', 'nologscale', 'nomultiplot',\n\
+'nostyle', 'notitle', 'no<m>[xyz]<n>format', 'no<m>[xyz]<n>tics', 'numerics',\n\
+'origin', 'output', 'palette', 'papersize', 'pointlinewidth', 'pointsize',\n\
+'preamble', 'samples', 'seed', 'size', 'size noratio', 'size ratio',\n\
+'size square', 'style', 'terminal', 'textcolor', 'texthalign', 'textvalign',\n\
+'threads', 'title', 'trange', 'unit', 'urange', 'view', 'viewer', 'vrange',\n\
+'width', '[xyz]<n>format', '[xyz]<n>label', '[xyz]<n>range', '<m>[xyz]<n>tics'\n\
 ");
 
 sprintf(ppltxt_set_noword, "\n\
@@ -108,16 +112,16 @@ Unset options which Pyxplot recognises are: [] = choose one, <> = optional\n\
 \n\
 'arrow', 'autoscale', 'axescolor', 'axis', 'axisunitstyle', 'backup', 'bar',\n\
 'binorigin', 'binwidth', 'boxfrom', 'boxwidth', 'c1format', 'c1label',\n\
-'calendar', 'clip', 'colmap', 'colkey', 'contours', 'c<n>range', 'data style',\n\
-'display', 'filter', 'fontsize', 'function style', 'grid', 'gridmajcolor',\n\
-'gridmincolor', 'key', 'keycolumns', 'label', 'linewidth', 'logscale',\n\
-'multiplot', 'noarrow', 'noaxis', 'nobackup', 'nodisplay', 'nogrid', 'nokey',\n\
-'nolabel', 'nologscale', 'nomultiplot', 'notitle', 'no<m>[xyz]<n>tics',\n\
-'numerics', 'origin', 'output', 'palette', 'papersize', 'pointlinewidth',\n\
-'pointsize', 'preamble', 'samples', 'size', 'style', 'terminal', 'textcolor',\n\
-'texthalign', 'textvalign', 'title', 'trange', 'unit', 'urange', 'view',\n\
-'viewer', 'vrange', 'width', '[xyz]<n>format', '[xyz]<n>label',\n\
-'[xyz]<n>range', '<m>[xyz]<n>tics'\n\
+'calendar', 'clip', 'colmap', 'colkey', 'contours', 'c<n>range', 'datacache',\n\
+'data style', 'display', 'filter', 'fontsize', 'function style', 'grid',\n\
+'gridmajcolor', 'gridmincolor', 'key', 'keycolumns', 'label', 'linewidth',\n\
+'logscale', 'multiplot', 'noarrow', 'noaxis', 'nobackup', 'nodisplay',\n\
+'nogrid', 'nokey', 'nolabel', 'nologscale', 'nomultiplot', 'notitle',\n\
+'no<m>[xyz]<n>tics', 'numerics', 'origin', 'output', 'palette', 'papersize',\n\
+'pointlinewidth', 'pointsize', 'preamble', 'samples', 'size', 'style',\n\
+'terminal', 'textcolor', 'texthalign', 'textvalign', 'threads', 'title',\n\
+'trange', 'unit', 'urange', 'view', 'viewer', 'vrange', 'width',\n\
+'[xyz]<n>format', '[xyz]<n>label', '[xyz]<n>range', '<m>[xyz]<n>tics'\n\
 ");
 
 sprintf(ppltxt_set, "\n\
@@ -133,20 +137,20 @@ Error: Invalid unset option '%%s'.\n\
 sprintf(ppltxt_show, "\n\
 Valid 'show' options are:\n\
 \n\
-'all', 'arrows', 'axes', 'functions', 'settings', 'labels', 'linestyles',\n\
-'units', 'userfunctions', 'variables'\n\
+'all', 'arrows', 'axes', 'execstats', 'functions', 'settings', 'labels',\n\
+'linestyles', 'units', 'userfunctions', 'variables'\n\
 \n\
 or any of the following set options:\n\
 'arrow', 'autoscale', 'axescolor', 'axis', 'axisunitstyle', 'backup', 'bar',\n\
 'binorigin', 'binwidth', 'boxfrom', 'boxwidth', 'c1format', 'c1label',\n\
-'calendar', 'clip', 'colmap', 'colkey', 'contours', 'c<n>range', 'data style',\n\
-'display', 'filter', 'fontsize', 'function style', 'grid', 'gridmajcolor',\n\
-'gridmincolor', 'key', 'keycolumns', 'label', 'linearscale', 'linewidth',\n\
-'logscale', 'multiplot', 'numerics', 'origin', 'output', 'palette',\n\
-'papersize', 'pointlinewidth', 'pointsize', 'preamble', 'samples', 'seed',\n\
-'size', 'size noratio', 'size ratio', 'size square', 'style', 'terminal',\n\
-'textcolor', 'texthalign', 'textvalign', 'title', 'trange', 'unit', 'urange',\n\
-'view', 'viewer', 'vrange', 'width', '[xyz]<n>format', '[xyz]<n>label',\n\
-'[xyz]<n>range', '<m>[xyz]<n>tics'\n\
+'calendar', 'clip', 'colmap', 'colkey', 'contours', 'c<n>range', 'datacache',\n\
+'data style', 'display', 'filter', 'fontsize', 'function style', 'grid',\n\
+'gridmajcolor', 'gridmincolor', 'key', 'keycolumns', 'label', 'linearscale',\n\
+'linewidth', 'logscale', 'multiplot', 'numerics', 'origin', 'output',\n\
+'palette', 'papersize', 'pointlinewidth', 'pointsize', 'preamble', 'samples',\n\
+'seed', 'size', 'size noratio', 'size ratio', 'size square', 'style',\n\
+'terminal', 'textcolor', 'texthalign', 'textvalign', 'threads', 'title',\n\
+'trange', 'unit', 'urange', 'view', 'viewer', 'vrange', 'width',\n\
+'[xyz]<n>format', '[xyz]<n>label', '[xyz]<n>range', '<m>[xyz]<n>tics'\n\
 "); }
 
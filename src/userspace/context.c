@@ -43,6 +43,8 @@
 #include "defaultObjs/defaultUnits.h"
 #include "defaultObjs/defaultVars.h"
 
+#include "pyxplot.h"
+
 ppl_context *ppl_contextInit()
  {
   int i;
@@ -73,6 +75,16 @@ ppl_context *ppl_contextInit()
   out->stack     = (pplObj *)malloc(STACK_DEFAULT * sizeof(pplObj));
   out->stackPtr  = 0;
   out->stackFull = 0;
+  out->inlineCacheOff = 0;
+  out->macroCacheOff  = 0;
+  out->dataBlockFn    = NULL;
+  out->dataBlockArg   = NULL;
+  out->execLines      = 0;
+  out->execFrameAllocs= 0;
+  out->scriptCache    = 0;
+  out->parserRecord   = NULL;
+  out->latexCache     = NULL;
+  out->outputFiles    = NULL;
   if (out->stack==NULL) { free(out); return NULL; }
 
   out->tokenBuff = NULL;   out->tokenBuffLen = 0;
@@ -96,8 +108,11 @@ ppl_context *ppl_contextInit()
   strcpy(out->errcontext.error_source,"main     ");
 
   pplObjInit(out);
+  ppl_startupPhase("settings and object types");
   ppl_makeDefaultUnits(out);
+  ppl_startupPhase("default units");
   ppl_makeDefaultVars(out);
+  ppl_startupPhase("default variables and modules");
   return out;
  }
 
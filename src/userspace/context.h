@@ -84,12 +84,30 @@ typedef struct ppl_context_struc
   // dollar operator status
   dollarStatus dollarStat;
 
+  // If set, the next data table to be read passes each block of data to this ppldata_blockFn, and then reuses it
+  void *dataBlockFn, *dataBlockArg;
+
   // Buffers for parsing and evaluating expressions
   pplTokenCode   *tokenBuff;   int tokenBuffLen;
   pplExprPStack  *parserStack; int parserStackLen;
   pplObj         *stack;
   int             stackSize, stackFull;
   int             stackPtr;
+  unsigned char   inlineCacheOff; // Set in private contexts used by worker threads, which must not write to shared bytecode
+  unsigned char   macroCacheOff;  // Likewise, stops such contexts from keeping compiled macro expansions on shared parser lines
+
+  // Counts of lines executed by ppl_parserExecute(), and of the output stacks which had to be allocated for them
+  long execLines, execFrameAllocs;
+
+  // If scriptCache is set, the compiled statements of scripts are kept in cache files; parserRecord collects them
+  int   scriptCache;
+  void *parserRecord;
+
+  // If non-NULL, the full path of each graphical output file which is written is appended to this list
+  list *outputFiles;
+
+  // If non-NULL, the directory in which typeset text items are cached (see epsMaker/dvi_cache.h)
+  char *latexCache;
 
   // Settings
   ppl_settings *set;
@@ -47,7 +47,7 @@ void ppl_garbageNamespace(dict *n)
     free(ptr);
     ptr = ptrnext;
    }
-  ppl_dictFreeTree(n->hashTree);
+  ppl_dictFreeTable(n);
   free(n);
   return;
  }
@@ -65,6 +65,7 @@ void ppl_garbageList(list *l)
     free(ptr);
     ptr = ptrnext;
    }
+  if (l->items!=NULL) free(l->items);
   free(l);
   return;
  }
@@ -234,6 +234,34 @@ pplObj *pplObjVector(pplObj *in, unsigned char amMalloced, unsigned char auxilMa
   return in;
  }
 
+// Change the visible size of a vector in place. Its raw gsl_vector is used as a store with spare capacity, grown
+// geometrically, and the vector itself becomes a view onto the start of it; the caller must set any new elements.
+// Returns nonzero if the vector is a slice of another vector or matrix, or if memory runs out, in which case the
+// vector is left unchanged.
+int pplObjVectorResize(pplObj *in, int size)
+ {
+  pplVector    *pv  = (pplVector *)in->auxil;
+  pplVectorRaw *pvr = pv->raw;
+  if ((pvr==NULL)||(pv->rawm!=NULL)||(size<1)) return 1;
+  if ((pv->v->data!=pvr->v->data)||(pv->v->stride!=1)) return 1;
+  if (size > pvr->v->size)
+   {
+    size_t          capacity = pvr->v->size;
+    gsl_vector     *vn;
+    gsl_vector_view vv;
+    if (capacity < 16) capacity = 16;
+    while (capacity < size) capacity *= 2;
+    if ((vn = gsl_vector_calloc(capacity))==NULL) return 1;
+    vv = gsl_vector_subvector(vn, 0, pv->v->size);
+    gsl_vector_memcpy(&vv.vector, pv->v);
+    gsl_vector_free(pvr->v);
+    pvr->v = vn;
+   }
+  pv->view = gsl_vector_subvector(pvr->v, 0, size);
+  pv->v    = &pv->view.vector;
+  return 0;
+ }
+
 pplObj *pplObjMatrix(pplObj *in, unsigned char amMalloced, unsigned char auxilMalloced, int size1, int size2)
  {
   int i;
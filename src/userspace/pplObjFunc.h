@@ -55,6 +55,7 @@ typedef struct functionDescriptor
   char   *argList;
   pplObj *min, *max; // Range of values over which this function definition can be used; used in function splicing
   unsigned char *minActive, *maxActive, numOnly, notNan, realOnly, dimlessOnly, needSelfThis;
+  unsigned char  stateful; // System function which reads and modifies hidden state, e.g. a random number generator
   struct functionDescriptor *next; // A linked list of spliced alternative function definitions
   char   *LaTeX;
   char   *description, *descriptionShort;
@@ -700,6 +700,18 @@ static void pplmethod_colToHSB(ppl_context *c, pplObj *in, int nArgs, int *statu
 
 // Vector methods
 
+// Methods which lengthen a vector do so in place, within spare capacity, when the variable being modified holds the
+// only reference to it. Otherwise, other references would see the change, so a new vector is made and assigned.
+static int pplmethod_vectorOwned(pplObj *st)
+ {
+  pplVector *pv = (pplVector *)st->auxil;
+  pplObj    *o  = st->self_lval;
+  if ((o==NULL)||(o->objType!=PPLOBJ_VEC)||(o->auxil!=st->auxil)||(pv->raw==NULL)||(pv->rawm!=NULL)) return 0;
+  // References to the vector are held by the variable, and by the copy of it which is self_this. Each of these also
+  // holds one reference to the raw store; any further reference to the store belongs to a slice sharing it.
+  return (pv->refCount<=2) && (pv->raw->refCount==pv->refCount);
+ }
+
 static void pplmethod_vectorAppend(ppl_context *c, pplObj *in, int nArgs, int *status, int *errType, char *errText)
  {
   int         i;
@@ -716,6 +728,13 @@ static void pplmethod_vectorAppend(ppl_context *c, pplObj *in, int nArgs, int *s
      { sprintf(errText, "Attempt to append a number to a vector with conflicting dimensions: vector has units of <%s>, while number has units of <%s>.", ppl_printUnit(c, st, NULL, NULL, 0, 1, 0), ppl_printUnit(c, &in[0], NULL, NULL, 1, 1, 0) ); }
     *errType=ERR_UNIT; *status = 1; return;
    }
+  if (pplmethod_vectorOwned(st) && (pplObjVectorResize(st, v->size+1)==0))
+   {
+    v = ((pplVector *)st->auxil)->v;
+    gsl_vector_set(v, v->size-1, in[0].real);
+    pplObjCpy(&OUTPUT,st,0,0,1);
+    return;
+   }
   if (pplObjVector(&OUTPUT,0,1,v->size+1)==NULL) { *status=1; *errType=ERR_MEMORY; sprintf(errText,"Out of memory."); return; }
   vo = ((pplVector *)(OUTPUT.auxil))->v;
   for (i=0; i<v->size; i++) gsl_vector_set(vo , i , gsl_vector_get(v,i));
@@ -736,11 +755,12 @@ static void pplmethod_vectorAppend(ppl_context *c, pplObj *in, int nArgs, int *s
 
 static void pplmethod_vectorExtend(ppl_context *c, pplObj *in, int nArgs, int *status, int *errType, char *errText)
  {
-  int         i,l=0;
+  int         i,l=0,inPlace=0;
   pplObj     *st = in[-1].self_this;
   gsl_vector *va = ((pplVector *)st->auxil)->v;
   gsl_vector *vo;
   int         t  = in[0].objType;
+  const int   n  = va->size;
 
   if      (t==PPLOBJ_VEC)
    {
@@ -765,10 +785,19 @@ static void pplmethod_vectorExtend(ppl_context *c, pplObj *in, int nArgs, int *s
     *status=1; *errType=ERR_TYPE; sprintf(errText, "Argument to the extend(x) method must be either a list or a vector. Supplied argument had type <%s>.", pplObjTypeNames[t]); return;
    }
 
-  if (pplObjVector(&OUTPUT,0,1,va->size+l)==NULL) { *status=1; *errType=ERR_MEMORY; sprintf(errText,"Out of memory."); return; }
-  vo = ((pplVector *)(OUTPUT.auxil))->v;
-  for (i=0; i<va->size; i++) gsl_vector_set(vo , i , gsl_vector_get(va,i));
-  ppl_unitsDimCpy(&OUTPUT,st);
+  if (pplmethod_vectorOwned(st) && (pplObjVectorResize(st, n+l)==0))
+   {
+    inPlace = 1;
+    i  = n;
+    vo = ((pplVector *)st->auxil)->v;
+   }
+  else
+   {
+    if (pplObjVector(&OUTPUT,0,1,va->size+l)==NULL) { *status=1; *errType=ERR_MEMORY; sprintf(errText,"Out of memory."); return; }
+    vo = ((pplVector *)(OUTPUT.auxil))->v;
+    for (i=0; i<va->size; i++) gsl_vector_set(vo , i , gsl_vector_get(va,i));
+    ppl_unitsDimCpy(&OUTPUT,st);
+   }
 
   if (t==PPLOBJ_VEC)
    {
@@ -784,7 +813,7 @@ static void pplmethod_vectorExtend(ppl_context *c, pplObj *in, int nArgs, int *s
     while ((item = (pplObj*)ppl_listIterate(&li))!=NULL)
      {
       if (item->objType!=PPLOBJ_NUM)
-       { *status=1; *errType=ERR_TYPE; sprintf(errText, "Can only append numbers to vectors; supplied object has type <%s>.",pplObjTypeNames[item->objType]); return; }
+       { *status=1; *errType=ERR_TYPE; sprintf(errText, "Can only append numbers to vectors; supplied object has type <%s>.",pplObjTypeNames[item->objType]); goto fail; }
       if (!ppl_unitsDimEqual(st, item))
        {
         if (st->dimensionless)
@@ -793,12 +822,17 @@ static void pplmethod_vectorExtend(ppl_context *c, pplObj *in, int nArgs, int *s
          { sprintf(errText, "Attempt to append a number to a vector with conflicting dimensions: vector has units of <%s>, while number is dimensionless.", ppl_printUnit(c, st, NULL, NULL, 0, 1, 0) ); }
         else
          { sprintf(errText, "Attempt to append a number to a vector with conflicting dimensions: vector has units of <%s>, while number has units of <%s>.", ppl_printUnit(c, st, NULL, NULL, 0, 1, 0), ppl_printUnit(c, item, NULL, NULL, 1, 1, 0) ); }
-        *errType=ERR_UNIT; *status = 1; return;
+        *errType=ERR_UNIT; *status = 1; goto fail;
        }
-      if (item->flagComplex) { *status=1; *errType=ERR_TYPE; sprintf(errText, "Can only append real numbers to vectors; supplied value is complex."); return; }
+      if (item->flagComplex) { *status=1; *errType=ERR_TYPE; sprintf(errText, "Can only append real numbers to vectors; supplied value is complex."); goto fail; }
       gsl_vector_set(vo, i++, item->real);
      }
    }
+  if (inPlace)
+   {
+    pplObjCpy(&OUTPUT,st,0,0,1);
+    return;
+   }
   if (st->self_lval!=NULL)
    {
     pplObj *o = st->self_lval;
@@ -810,6 +844,11 @@ static void pplmethod_vectorExtend(ppl_context *c, pplObj *in, int nArgs, int *s
     o->refCount=rc;
     pplObjCpy(o,&OUTPUT,0,om,1);
    }
+  return;
+
+fail:
+  // Restore the original length of a vector which was being extended in place
+  if (inPlace) pplObjVectorResize(st, n);
  }
 
 static void pplmethod_vectorFilter(ppl_context *c, pplObj *in, int nArgs, int *status, int *errType, char *errText)
@@ -908,6 +947,14 @@ static void pplmethod_vectorInsert(ppl_context *c, pplObj *in, int nArgs, int *s
      { sprintf(errText, "Attempt to append a number to a vector with conflicting dimensions: vector has units of <%s>, while number has units of <%s>.", ppl_printUnit(c, st, NULL, NULL, 0, 1, 0), ppl_printUnit(c, &in[1], NULL, NULL, 1, 1, 0) ); }
     *errType=ERR_UNIT; *status = 1; return;
    }
+  if (pplmethod_vectorOwned(st) && (pplObjVectorResize(st, v->size+1)==0))
+   {
+    v = ((pplVector *)st->auxil)->v;
+    for (i=v->size-1; i>p; i--) gsl_vector_set(v , i , gsl_vector_get(v,i-1));
+    gsl_vector_set(v, p, in[1].real);
+    pplObjCpy(&OUTPUT,st,0,0,1);
+    return;
+   }
   if (pplObjVector(&OUTPUT,0,1,v->size+1)==NULL) { *status=1; *errType=ERR_MEMORY; sprintf(errText,"Out of memory."); return; }
   vo = ((pplVector *)(OUTPUT.auxil))->v;
   gsl_vector_set(vo, p, in[1].real);
@@ -1512,16 +1559,13 @@ static void pplmethod_listReverse(ppl_context *c, pplObj *in, int nArgs, int *st
   long      i;
   pplObj   *st    = in[-1].self_this;
   list     *l     = (list *)st->auxil;
-  listItem *l1    = l->first;
-  listItem *l2    = l->last;
   long      n     = l->length;
   pplObjCpy(&OUTPUT,st,0,0,1);
   if (n<2) return;
 
   for (i=0; i<n/2; i++)
    {
-    void *tmp = l1->data; l1->data=l2->data; l2->data=tmp;
-    l1=l1->next; l2=l2->prev;
+    void *tmp = l->items[i]->data; l->items[i]->data=l->items[n-1-i]->data; l->items[n-1-i]->data=tmp;
    }
  }
 
@@ -1532,15 +1576,13 @@ static void pplmethod_listSort(ppl_context *c, pplObj *in, int nArgs, int *statu
   list    *l  = (list *)st->auxil;
   long     n  = l->length;
   pplObj **items;
-  listIterator *li = ppl_listIterateInit(l);
   pplObjCpy(&OUTPUT,st,0,0,1);
   if (n<2) return;
   items = (pplObj **)malloc(n * sizeof(pplObj *));
   if (items==NULL) { *status=1; *errType=ERR_MEMORY; strcpy(errText, "Out of memory."); return; }
-  i=0; while (li!=NULL) { items[i++]=(pplObj*)li->data; ppl_listIterate(&li); }
+  for (i=0; i<n; i++) items[i]=(pplObj*)l->items[i]->data;
   qsort(items, n, sizeof(pplObj*), pplObjCmpQuiet);
-  li = ppl_listIterateInit(l);
-  i=0; while (li!=NULL) { li->data=(void*)items[i++]; ppl_listIterate(&li); }
+  for (i=0; i<n; i++) l->items[i]->data=(void*)items[i];
   free(items);
  }
 
@@ -1610,7 +1652,6 @@ static void pplmethod_listSortOnCustom(ppl_context *c, pplObj *in, int nArgs, in
   pplObj **items;
   pplFunc *fi;
   int      fail;
-  listIterator *li = ppl_listIterateInit(l);
 
   STACK_MUSTHAVE(c,4);
   if (c->stackFull) { *status=1; *errType=ERR_TYPE; strcpy(errText,"Stack overflow."); return; }
@@ -1622,14 +1663,13 @@ static void pplmethod_listSortOnCustom(ppl_context *c, pplObj *in, int nArgs, in
   if (n<2) return;
   items = (pplObj **)malloc(n * sizeof(pplObj *));
   if (items==NULL) { *status=1; *errType=ERR_MEMORY; strcpy(errText, "Out of memory."); return; }
-  i=0; while (li!=NULL) { items[i++]=(pplObj*)li->data; ppl_listIterate(&li); }
+  for (i=0; i<n; i++) items[i]=(pplObj*)l->items[i]->data;
   pplmethod_listSortOnCustom_fn = &in[0]; pplmethod_listSortOnCustom_errFlag = 0; pplmethod_listSortOnCustom_context = c;
   qsort(items, n, sizeof(pplObj*), pplmethod_listSortOnCustom_slave);
   fail = pplmethod_listSortOnCustom_errFlag;
   pplmethod_listSortOnCustom_fn = NULL; pplmethod_listSortOnCustom_errFlag = 0; pplmethod_listSortOnCustom_context = NULL;
   if (fail) { *status=1; *errType=ERR_GENERIC; strcpy(errText, "Failure of user-supplied comparison function."); return; }
-  li = ppl_listIterateInit(l);
-  i=0; while (li!=NULL) { li->data=(void*)items[i++]; ppl_listIterate(&li); }
+  for (i=0; i<n; i++) l->items[i]->data=(void*)items[i];
   free(items);
  }
 
@@ -1649,19 +1689,15 @@ static void pplmethod_listSortOnElement(ppl_context *c, pplObj *in, int nArgs, i
   if (n<2) return;
   items = (pplObj **)malloc(n * 2 * sizeof(pplObj *));
   if (items==NULL) { *status=1; *errType=ERR_MEMORY; strcpy(errText, "Out of memory."); return; }
-  li = ppl_listIterateInit(l);
-  i=0;
-  while (li!=NULL)
+  for (i=0; i<n; i++)
    {
-    pplObj *o=(pplObj*)li->data;
-    list *l=(list *)o->auxil;
-    items[i++]=ppl_listGetItem(l , (eNum>=0) ? eNum : (l->length+eNum));
-    items[i++]=(pplObj*)li->data;
-    ppl_listIterate(&li);
+    pplObj *o=(pplObj*)l->items[i]->data;
+    list *sl=(list *)o->auxil;
+    items[2*i  ]=ppl_listGetItem(sl , (eNum>=0) ? eNum : (sl->length+eNum));
+    items[2*i+1]=o;
    }
   qsort(items, n, 2*sizeof(pplObj*), pplObjCmpQuiet);
-  li = ppl_listIterateInit(l);
-  i=0; while (li!=NULL) { i++; li->data=(void*)items[i++]; ppl_listIterate(&li); }
+  for (i=0; i<n; i++) l->items[i]->data=(void*)items[2*i+1];
   free(items);
  }
 
@@ -38,6 +38,7 @@ pplObj *pplObjDict     (pplObj *in, unsigned char amMalloced, unsigned char auxi
 pplObj *pplObjModule   (pplObj *in, unsigned char amMalloced, unsigned char auxilMalloced, unsigned char frozen);
 pplObj *pplObjList     (pplObj *in, unsigned char amMalloced, unsigned char auxilMalloced, list *l);
 pplObj *pplObjVector   (pplObj *in, unsigned char amMalloced, unsigned char auxilMalloced, int size);
+int     pplObjVectorResize(pplObj *in, int size);
 pplObj *pplObjMatrix   (pplObj *in, unsigned char amMalloced, unsigned char auxilMalloced, int size1, int size2);
 pplObj *pplObjFile     (pplObj *in, unsigned char amMalloced, unsigned char auxilMalloced, FILE *f, int pipe);
 pplObj *pplObjFunc     (pplObj *in, unsigned char amMalloced, unsigned char auxilMalloced, pplFunc *f);
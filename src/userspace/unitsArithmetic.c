@@ -43,10 +43,9 @@
 
 void ppl_unitsDimCpy(pplObj *o, const pplObj *i)
  {
-  int j;
   o->dimensionless = i->dimensionless;
   o->tempType      = i->tempType;
-  for (j=0; j<UNITS_MAX_BASEUNITS; j++) o->exponent[j] = i->exponent[j];
+  if (o!=i) memcpy(o->exponent, i->exponent, sizeof(o->exponent));
   return;
  }
 
@@ -59,26 +58,31 @@ void ppl_unitsDimInverse(pplObj *o, const pplObj *i)
   return;
  }
 
-int ppl_unitsDimEqual(const pplObj *a, const pplObj *b)
+// Dimensions are almost always either identical bit for bit, having been copied from the same unit definitions, or
+// differ by whole powers of base units. Test for an exact match with a single memcmp before falling back to
+// comparing each exponent to within rounding error.
+static int ppl_unitsExponentsEqual(const double *a, const double *b)
  {
   int j;
-  if (a->dimensionless && b->dimensionless) return 1;
-  for (j=0; j<UNITS_MAX_BASEUNITS; j++) if (ppl_dblEqual(a->exponent[j] , b->exponent[j]) == 0) return 0;
+  if (memcmp(a, b, UNITS_MAX_BASEUNITS*sizeof(double)) == 0) return 1;
+  for (j=0; j<UNITS_MAX_BASEUNITS; j++) if ((a[j]!=b[j]) && (ppl_dblEqual(a[j] , b[j]) == 0)) return 0;
   return 1;
  }
 
+int ppl_unitsDimEqual(const pplObj *a, const pplObj *b)
+ {
+  if (a->dimensionless && b->dimensionless) return 1;
+  return ppl_unitsExponentsEqual(a->exponent, b->exponent);
+ }
+
 int ppl_unitsDimEqual2(const pplObj *a, const unit *b)
  {
-  int j;
-  for (j=0; j<UNITS_MAX_BASEUNITS; j++) if (ppl_dblEqual(a->exponent[j] , b->exponent[j]) == 0) return 0;
-  return 1;
+  return ppl_unitsExponentsEqual(a->exponent, b->exponent);
  }
 
 int ppl_unitsDimEqual3(const unit *a, const unit *b)
  {
-  int j;
-  for (j=0; j<UNITS_MAX_BASEUNITS; j++) if (ppl_dblEqual(a->exponent[j] , b->exponent[j]) == 0) return 0;
-  return 1;
+  return ppl_unitsExponentsEqual(a->exponent, b->exponent);
  }
 
 unsigned char ppl_tempTypeMatch(unsigned char a, unsigned char b)